@@ -22,6 +22,7 @@
  */
 
 #include "../common.hpp"
+#include "../numpy_view.hpp"
 
 #include <geode/basic/attribute.hpp>
 #include <geode/basic/constant_attribute.hpp>
@@ -50,11 +51,32 @@ namespace geode
             .def( "default_value", &ConstantAttribute< type >::default_value );
         const auto variable_name = absl::StrCat( "VariableAttribute", typestr );
         pybind11::class_< VariableAttribute< type >, ReadOnlyAttribute< type >,
-            std::shared_ptr< VariableAttribute< type > > >(
-            module, variable_name.c_str() )
+            std::shared_ptr< VariableAttribute< type > > >
+            variable_class( module, variable_name.c_str() );
+        variable_class
             .def( "set_value", &VariableAttribute< type >::set_value )
             .def(
                 "default_values", &VariableAttribute< type >::default_values );
+        if constexpr( !std::is_same_v< type, bool > )
+        {
+            using Scalar = typename detail::NumpyItem< type >::Scalar;
+            variable_class
+                .def( "values",
+                    []( std::shared_ptr< VariableAttribute< type > >
+                            attribute ) {
+                        const auto values = attribute->modifiable_values();
+                        return numpy_view(
+                            values, pybind11::cast( std::move( attribute ) ) );
+                    } )
+                .def( "set_values",
+                    []( VariableAttribute< type >& attribute,
+                        const pybind11::array_t< Scalar,
+                            pybind11::array::c_style
+                                | pybind11::array::forcecast >& values ) {
+                        copy_from_numpy(
+                            values, attribute.modifiable_values() );
+                    } );
+        }
         const auto sparse_name = absl::StrCat( "SparseAttribute", typestr );
         pybind11::class_< SparseAttribute< type >, ReadOnlyAttribute< type >,
             std::shared_ptr< SparseAttribute< type > > >(
@@ -24,6 +24,7 @@
 #include "../common.hpp"
 #include <pybind11/iostream.h>
 
+#include <geode/basic/compression.hpp>
 #include <geode/basic/library.hpp>
 
 namespace geode
@@ -49,6 +50,10 @@ PYBIND11_MODULE( opengeode_py_basic, module )
     pybind11::class_< geode::OpenGeodeBasicLibrary >(
         module, "OpenGeodeBasicLibrary" )
         .def( "initialize", &geode::OpenGeodeBasicLibrary::initialize );
+    module
+        .def( "is_native_compression_enabled",
+            &geode::is_native_compression_enabled )
+        .def( "set_native_compression", &geode::set_native_compression );
     geode::define_cell_array( module );
     geode::define_uuid( module );
     geode::define_attributes( module );
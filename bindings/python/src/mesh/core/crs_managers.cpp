@@ -22,9 +22,11 @@
  */
 
 #include "../../common.hpp"
+#include "../../numpy_view.hpp"
 
 #include <geode/geometry/point.hpp>
 
+#include <geode/mesh/core/attribute_coordinate_reference_system.hpp>
 #include <geode/mesh/core/coordinate_reference_system_manager.hpp>
 #include <geode/mesh/core/coordinate_reference_system_managers.hpp>
 
@@ -63,10 +65,41 @@
                     main_coordinate_reference_system_manager ),                \
             pybind11::return_value_policy::reference )                         \
         .def(                                                                  \
-            "point", &CoordinateReferenceSystemManagers##dimension##D::point )
+            "point", &CoordinateReferenceSystemManagers##dimension##D::point ) \
+        .def( "points", &points_view< dimension > )
 
 namespace geode
 {
+    namespace detail
+    {
+        template < index_t dimension >
+        struct NumpyItem< Point< dimension > >
+        {
+            using Scalar = double;
+            static constexpr index_t nb_components = dimension;
+        };
+    } // namespace detail
+
+    template < index_t dimension >
+    pybind11::array_t< double > points_view(
+        const CoordinateReferenceSystemManagers< dimension >& managers )
+    {
+        const auto* crs = dynamic_cast<
+            const AttributeCoordinateReferenceSystem< dimension >* >(
+            &managers.main_coordinate_reference_system_manager()
+                 .active_coordinate_reference_system() );
+        if( crs == nullptr )
+        {
+            throw pybind11::value_error(
+                "[CoordinateReferenceSystemManagers::points] Active "
+                "coordinate reference system does not store its points in an "
+                "attribute" );
+        }
+        return numpy_view( crs->points(),
+            pybind11::cast(
+                &managers, pybind11::return_value_policy::reference ) );
+    }
+
     void define_crs_managers( pybind11::module& module )
     {
         PYTHON_CRS_MANAGERS( 1 );
@@ -100,14 +100,16 @@
         .def( "polyhedron_around_vertex",                                      \
             &SolidMesh##dimension##D::polyhedron_around_vertex )               \
         .def( "polyhedra_around_vertex",                                       \
-            static_cast< const PolyhedraAroundVertex& (                        \
+            static_cast< absl::Span< const PolyhedronVertex > (                \
                 SolidMesh##dimension##D::*) ( index_t ) const >(               \
                 &SolidMesh##dimension##D::polyhedra_around_vertex ) )          \
         .def( "polyhedra_around_polyhedron_vertex",                            \
-            static_cast< const PolyhedraAroundVertex& (                        \
+            static_cast< absl::Span< const PolyhedronVertex > (                \
                 SolidMesh##dimension##D::*) ( const PolyhedronVertex& )        \
                     const >(                                                   \
                 &SolidMesh##dimension##D::polyhedra_around_vertex ) )          \
+        .def( "build_polyhedra_around_vertices",                               \
+            &SolidMesh##dimension##D::build_polyhedra_around_vertices )        \
         .def( "polyhedra_around_edge",                                         \
             static_cast< PolyhedraAroundEdge ( SolidMesh##dimension##D::* )(   \
                 const std::array< index_t, 2 >& ) const >(                     \
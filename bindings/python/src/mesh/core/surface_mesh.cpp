@@ -99,14 +99,16 @@
         .def( "polygon_around_vertex",                                         \
             &SurfaceMesh##dimension##D::polygon_around_vertex )                \
         .def( "polygons_around_vertex",                                        \
-            static_cast< const PolygonsAroundVertex& (                         \
+            static_cast< absl::Span< const PolygonVertex > (                   \
                 SurfaceMesh##dimension##D::*) ( index_t ) const >(             \
                 &SurfaceMesh##dimension##D::polygons_around_vertex ) )         \
         .def( "polygons_around_polygon_vertex",                                \
-            static_cast< const PolygonsAroundVertex& (                         \
+            static_cast< absl::Span< const PolygonVertex > (                   \
                 SurfaceMesh##dimension##D::*) ( const PolygonVertex& )         \
                     const >(                                                   \
                 &SurfaceMesh##dimension##D::polygons_around_vertex ) )         \
+        .def( "build_polygons_around_vertices",                                \
+            &SurfaceMesh##dimension##D::build_polygons_around_vertices )       \
         .def( "polygon_edge_from_vertices",                                    \
             &SurfaceMesh##dimension##D::polygon_edge_from_vertices )           \
         .def( "polygons_from_edge_vertices",                                   \
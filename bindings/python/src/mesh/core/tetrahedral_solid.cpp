@@ -22,9 +22,11 @@
  */
 
 #include "../../common.hpp"
+#include "../../numpy_view.hpp"
 
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
 #include <geode/mesh/core/tetrahedral_solid.hpp>
 
 #define PYTHON_TETRAHEDRAL_SOLID( dimension )                                  \
@@ -38,10 +40,29 @@
                 &TetrahedralSolid##dimension##D::create ) )                    \
         .def( "clone", &TetrahedralSolid##dimension##D::clone )                \
         .def( "tetrahedron", &TetrahedralSolid##dimension##D::tetrahedron )    \
-        .def( "triangle", &TetrahedralSolid##dimension##D::triangle )
+        .def( "triangle", &TetrahedralSolid##dimension##D::triangle )          \
+        .def( "tetrahedra_vertices", &tetrahedra_vertices_view< dimension > )
 
 namespace geode
 {
+    template < index_t dimension >
+    pybind11::array_t< index_t > tetrahedra_vertices_view(
+        const TetrahedralSolid< dimension >& solid )
+    {
+        const auto* geode_solid =
+            dynamic_cast< const OpenGeodeTetrahedralSolid< dimension >* >(
+                &solid );
+        if( geode_solid == nullptr )
+        {
+            throw pybind11::value_error(
+                "[TetrahedralSolid::tetrahedra_vertices] Only available for "
+                "OpenGeode implementation" );
+        }
+        return numpy_view( geode_solid->tetrahedra_vertices(),
+            pybind11::cast(
+                &solid, pybind11::return_value_policy::reference ) );
+    }
+
     void define_tetrahedral_solid( pybind11::module& module )
     {
         PYTHON_TETRAHEDRAL_SOLID( 3 );
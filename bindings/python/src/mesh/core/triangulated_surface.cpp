@@ -22,8 +22,10 @@
  */
 
 #include "../../common.hpp"
+#include "../../numpy_view.hpp"
 
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/mesh/core/geode/geode_triangulated_surface.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
 #define PYTHON_TRIANGULATED_SURFACE( dimension )                               \
@@ -37,10 +39,29 @@
                           TriangulatedSurface##dimension##D > ( * )() >(       \
                           &TriangulatedSurface##dimension##D::create ) )       \
         .def( "clone", &TriangulatedSurface##dimension##D::clone )             \
-        .def( "triangle", &TriangulatedSurface##dimension##D::triangle )
+        .def( "triangle", &TriangulatedSurface##dimension##D::triangle )       \
+        .def( "triangles_vertices", &triangles_vertices_view< dimension > )
 
 namespace geode
 {
+    template < index_t dimension >
+    pybind11::array_t< index_t > triangles_vertices_view(
+        const TriangulatedSurface< dimension >& surface )
+    {
+        const auto* geode_surface =
+            dynamic_cast< const OpenGeodeTriangulatedSurface< dimension >* >(
+                &surface );
+        if( geode_surface == nullptr )
+        {
+            throw pybind11::value_error(
+                "[TriangulatedSurface::triangles_vertices] Only available "
+                "for OpenGeode implementation" );
+        }
+        return numpy_view( geode_surface->triangles_vertices(),
+            pybind11::cast(
+                &surface, pybind11::return_value_policy::reference ) );
+    }
+
     void define_triangulated_surface( pybind11::module& module )
     {
         PYTHON_TRIANGULATED_SURFACE( 2 );
@@ -33,5 +33,9 @@ namespace geode
             &euclidean_distance_transform< 2 > );
         module.def( "euclidean_distance_transform3D",
             &euclidean_distance_transform< 3 > );
+        module.def( "euclidean_distance_transform2D",
+            &euclidean_distance_transform< double, 2 > );
+        module.def( "euclidean_distance_transform3D",
+            &euclidean_distance_transform< double, 3 > );
     }
 } // namespace geode
@@ -41,7 +41,14 @@ namespace geode
             .def( pybind11::init<>() )
             .def( "nb_unique_vertices", &VertexIdentifier::nb_unique_vertices )
             .def( "component_mesh_vertices",
-                &VertexIdentifier::component_mesh_vertices )
+                []( const VertexIdentifier& vertex_identifier,
+                    index_t unique_vertex_id ) {
+                    const auto vertices =
+                        vertex_identifier.component_mesh_vertices(
+                            unique_vertex_id );
+                    return std::vector< ComponentMeshVertex >{
+                        vertices.begin(), vertices.end() };
+                } )
             .def( "unique_vertex", &VertexIdentifier::unique_vertex );
     }
 } // namespace geode
@@ -27,13 +27,20 @@
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
 #include <geode/model/representation/io/brep_output.hpp>
+#include <geode/model/representation/io/geode/geode_brep_input.hpp>
+#include <geode/model/representation/io/geode/geode_brep_output.hpp>
 
 namespace geode
 {
     void define_brep_io( pybind11::module& module )
     {
         module.def( "save_brep", &save_brep );
+        module.def( "save_brep_incrementally", &save_brep_incrementally );
         module.def( "load_brep", &load_brep );
+        module.def( "save_brep_to_buffer", []( const BRep& brep ) {
+            return pybind11::bytes( save_brep_to_buffer( brep ) );
+        } );
+        module.def( "load_brep_from_buffer", &load_brep_from_buffer );
         module.def( "brep_object_priority", &brep_object_priority );
         module.def( "is_brep_loadable", &is_brep_loadable );
         module.def( "is_brep_saveable", &is_brep_saveable );
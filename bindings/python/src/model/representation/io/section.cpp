@@ -27,13 +27,20 @@
 #include <geode/model/representation/core/section.hpp>
 #include <geode/model/representation/io/section_input.hpp>
 #include <geode/model/representation/io/section_output.hpp>
+#include <geode/model/representation/io/geode/geode_section_input.hpp>
+#include <geode/model/representation/io/geode/geode_section_output.hpp>
 
 namespace geode
 {
     void define_section_io( pybind11::module& module )
     {
         module.def( "save_section", &save_section );
+        module.def( "save_section_incrementally", &save_section_incrementally );
         module.def( "load_section", &load_section );
+        module.def( "save_section_to_buffer", []( const Section& section ) {
+            return pybind11::bytes( save_section_to_buffer( section ) );
+        } );
+        module.def( "load_section_from_buffer", &load_section_from_buffer );
         module.def( "section_object_priority", &section_object_priority );
         module.def( "is_section_loadable", &is_section_loadable );
         module.def( "is_section_saveable", &is_section_saveable );
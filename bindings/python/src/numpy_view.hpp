@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        template < typename T >
+        struct NumpyItem
+        {
+            using Scalar = T;
+            static constexpr index_t nb_components = 1;
+        };
+
+        template < typename T, size_t N >
+        struct NumpyItem< std::array< T, N > >
+        {
+            using Scalar = T;
+            static constexpr index_t nb_components = N;
+        };
+    } // namespace detail
+
+    /*!
+     * Build a NumPy array sharing the memory of the given values.
+     * Values of fixed size array types (or any type specializing
+     * detail::NumpyItem) are exposed as a 2D array with one row per value.
+     * @param[in] owner Python object keeping the values alive as long as the
+     * array is referenced
+     * @warning The array is invalidated when the number of values changes
+     */
+    template < typename T >
+    pybind11::array_t< typename detail::NumpyItem<
+        std::remove_const_t< T > >::Scalar >
+        numpy_view( absl::Span< T > values, pybind11::handle owner )
+    {
+        using Item = detail::NumpyItem< std::remove_const_t< T > >;
+        using Scalar = typename Item::Scalar;
+        static_assert( sizeof( T ) == Item::nb_components * sizeof( Scalar ),
+            "[numpy_view] Values should be contiguous scalars" );
+        std::vector< pybind11::ssize_t > shape{ static_cast<
+            pybind11::ssize_t >( values.size() ) };
+        std::vector< pybind11::ssize_t > strides{ sizeof( T ) };
+        if constexpr( Item::nb_components > 1 )
+        {
+            shape.push_back( Item::nb_components );
+            strides.push_back( sizeof( Scalar ) );
+        }
+        pybind11::array_t< Scalar > array{ std::move( shape ),
+            std::move( strides ),
+            reinterpret_cast< const Scalar* >( values.data() ), owner };
+        if constexpr( std::is_const_v< T > )
+        {
+            pybind11::detail::array_proxy( array.ptr() )->flags &=
+                ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        }
+        return array;
+    }
+
+    /*!
+     * Copy the content of a NumPy array into the given values at once.
+     * The array shape should match the one returned by numpy_view.
+     */
+    template < typename T >
+    void copy_from_numpy( const pybind11::array_t<
+                              typename detail::NumpyItem< T >::Scalar,
+                              pybind11::array::c_style
+                                  | pybind11::array::forcecast >& array,
+        absl::Span< T > values )
+    {
+        using Item = detail::NumpyItem< T >;
+        const auto expected_ndim = Item::nb_components > 1 ? 2 : 1;
+        if( array.ndim() != expected_ndim
+            || static_cast< size_t >( array.shape( 0 ) ) != values.size()
+            || ( expected_ndim == 2
+                 && static_cast< index_t >( array.shape( 1 ) )
+                        != Item::nb_components ) )
+        {
+            throw pybind11::value_error(
+                "[copy_from_numpy] Array shape should match the number of "
+                "values and their number of components" );
+        }
+        std::copy_n( reinterpret_cast< const T* >( array.data() ),
+            values.size(), values.begin() );
+    }
+} // namespace geode
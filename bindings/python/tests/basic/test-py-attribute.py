@@ -93,6 +93,27 @@ def test_int_variable_attribute(manager):
         raise ValueError("[Test] Should be equal to 5")
 
 
+def test_array_variable_attribute_views(manager):
+    properties = basic.AttributeProperties()
+    values = basic.AttributeValuesArrayDouble3()
+    values.default_value = [1, 2, 3]
+    values.no_value = [1, 2, 3]
+    attribute_id = manager.create_attribute_variable_arraydouble3(
+        "array", values, properties)
+    attribute = manager.find_attribute_variable_arraydouble3(attribute_id)
+    view = attribute.values()
+    if view.shape != (manager.nb_elements(), 3):
+        raise ValueError("[Test] Wrong attribute view shape")
+    view[4][1] = 12
+    if attribute.value(4)[1] != 12:
+        raise ValueError("[Test] Attribute view should share its memory")
+    new_values = [[float(i), 0, 0] for i in range(manager.nb_elements())]
+    attribute.set_values(new_values)
+    if attribute.value(7)[0] != 7 or view[7][0] != 7:
+        raise ValueError("[Test] Attribute values should be set")
+    manager.delete_attribute(attribute_id)
+
+
 def test_double_sparse_attribute(manager):
 
     properties = basic.AttributeProperties()
@@ -163,6 +184,7 @@ if __name__ == '__main__':
         raise ValueError("[Test] Manager should have 10 elements")
     bool_attribute_id = test_constant_attribute(manager)
     test_int_variable_attribute(manager)
+    test_array_variable_attribute_views(manager)
     test_double_sparse_attribute(manager)
     double_attribute_id = test_double_sparse_attribute(manager)
     test_delete_attribute_elements(manager)
@@ -55,6 +55,19 @@ def test_create_tetrahedra(solid, builder):
         raise ValueError("[Test] TetrahedralSolid should have 12 edges")
 
 
+def test_array_views(solid):
+    points = solid.points()
+    if points.shape != (6, 3):
+        raise ValueError("[Test] Wrong points view shape")
+    if points[2][1] != 5.2:
+        raise ValueError("[Test] Wrong point in points view")
+    tetrahedra = solid.tetrahedra_vertices()
+    if tetrahedra.shape != (3, 4):
+        raise ValueError("[Test] Wrong tetrahedra view shape")
+    if list(tetrahedra[1]) != [1, 2, 3, 4]:
+        raise ValueError("[Test] Wrong tetrahedron in tetrahedra view")
+
+
 def test_polyhedron_adjacencies(solid, builder):
     builder.compute_polyhedron_adjacencies()
     if solid.polyhedron_adjacent(mesh.PolyhedronFacet(0, 0)) != 1:
@@ -255,6 +268,7 @@ if __name__ == '__main__':
 
     test_create_vertices(solid, builder)
     test_create_tetrahedra(solid, builder)
+    test_array_views(solid)
     test_polyhedron_adjacencies(solid, builder)
     test_io(solid, "test." + solid.native_extension())
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string_view>
 #include <typeinfo>
@@ -38,6 +39,7 @@
 #include <geode/basic/identifier.hpp>
 #include <geode/basic/mapping.hpp>
 #include <geode/basic/passkey.hpp>
+#include <geode/basic/range.hpp>
 
 namespace geode
 {
@@ -83,6 +85,20 @@ namespace geode
         }
 
     public:
+        /*!
+         * Return true if the values may have been modified since the last
+         * call. The state is reset unless a modifiable view on the values is
+         * still valid, writes through such a view cannot be tracked.
+         */
+        [[nodiscard]] bool check_modification( AttributeKey /*key*/ ) const
+        {
+            if( has_modifiable_view_.load( std::memory_order_relaxed ) )
+            {
+                return true;
+            }
+            return modified_.exchange( false, std::memory_order_relaxed );
+        }
+
         [[nodiscard]] virtual std::shared_ptr< AttributeBase > clone(
             AttributeKey /*key*/ ) const = 0;
 
@@ -123,6 +139,33 @@ namespace geode
             index_t to_element,
             AttributeKey /*key*/ ) = 0;
 
+        /*!
+         * Assign each to_elements[i] value from the from_elements[i] value
+         */
+        virtual void compute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeKey key )
+        {
+            for( const auto i : Indices{ to_elements } )
+            {
+                compute_value( from_elements[i], to_elements[i], key );
+            }
+        }
+
+        /*!
+         * Interpolate each to_elements[i] value using interpolations[i]
+         */
+        virtual void compute_values(
+            absl::Span< const AttributeLinearInterpolation > interpolations,
+            absl::Span< const index_t > to_elements,
+            AttributeKey key )
+        {
+            for( const auto i : Indices{ to_elements } )
+            {
+                compute_value( interpolations[i], to_elements[i], key );
+            }
+        }
+
     private:
         AttributeBase() = default;
 
@@ -154,8 +197,33 @@ namespace geode
             set_name( name );
         }
 
+        void notify_modification()
+        {
+            // Avoid writing the shared flag on each value modification
+            if( !modified_.load( std::memory_order_relaxed ) )
+            {
+                modified_.store( true, std::memory_order_relaxed );
+            }
+        }
+
+        void notify_modifiable_view()
+        {
+            has_modifiable_view_.store( true, std::memory_order_relaxed );
+        }
+
+        void release_modifiable_view()
+        {
+            if( has_modifiable_view_.load( std::memory_order_relaxed ) )
+            {
+                has_modifiable_view_.store( false, std::memory_order_relaxed );
+                notify_modification();
+            }
+        }
+
     private:
         AttributeProperties properties_;
+        mutable std::atomic< bool > modified_{ false };
+        std::atomic< bool > has_modifiable_view_{ false };
     };
 
     /*!
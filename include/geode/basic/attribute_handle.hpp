@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include <geode/basic/attribute.hpp>
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/common.hpp>
+#include <geode/basic/uuid.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        template < typename AttributeType, typename Manager >
+        class AttributeHandleImpl
+        {
+        public:
+            AttributeHandleImpl( Manager& manager, const uuid& attribute_id )
+                : manager_( &manager ), attribute_id_( attribute_id )
+            {
+                refresh();
+            }
+
+            /*!
+             * Return true if attributes were created or removed from the
+             * manager since the last refresh.
+             * The attribute may still be valid, but should be refreshed to
+             * be sure.
+             */
+            [[nodiscard]] bool is_outdated() const
+            {
+                return generation_ != manager_->generation();
+            }
+
+            /*!
+             * Find again the attribute in the manager.
+             * @exception OpenGeodeException if the attribute does not exist
+             * anymore or has another type.
+             */
+            void refresh()
+            {
+                generation_ = manager_->generation();
+                owner_ = std::dynamic_pointer_cast< AttributeType >(
+                    manager_->find_generic_attribute( attribute_id_ ) );
+                OpenGeodeBasicException::check_exception( owner_.get(),
+                    nullptr, OpenGeodeException::TYPE::data,
+                    "[AttributeHandle::refresh] Could not find attribute "
+                    "with id: '",
+                    attribute_id_.string(), "' and the given type" );
+                attribute_ = owner_.get();
+            }
+
+            [[nodiscard]] const uuid& attribute_id() const
+            {
+                return attribute_id_;
+            }
+
+            [[nodiscard]] AttributeType& attribute() const
+            {
+                OpenGeodeBasicException::check_assertion( !is_outdated(),
+                    "[AttributeHandle::attribute] Handle is outdated" );
+                return *attribute_;
+            }
+
+            [[nodiscard]] AttributeType* operator->() const
+            {
+                return &attribute();
+            }
+
+        private:
+            Manager* manager_;
+            uuid attribute_id_;
+            std::shared_ptr< AttributeType > owner_;
+            AttributeType* attribute_{ nullptr };
+            index_t generation_{ 0 };
+        };
+    } // namespace detail
+
+    /*!
+     * Typed access to an attribute resolved once from its AttributeManager.
+     * Accessing the attribute through the handle needs neither lock nor
+     * shared_ptr copy, it is meant to be shared by reference in parallel
+     * loops. The handle keeps the attribute alive.
+     * The manager generation is used to detect attribute creation or
+     * deletion, call refresh() when is_outdated() returns true.
+     * @warning The handle keeps a pointer to the manager, it should not
+     * outlive it.
+     */
+    template < typename T >
+    using ReadOnlyAttributeHandle =
+        detail::AttributeHandleImpl< const ReadOnlyAttribute< T >,
+            const AttributeManager >;
+
+    template < template < typename > class Attribute, typename T >
+    using AttributeHandle =
+        detail::AttributeHandleImpl< Attribute< T >, AttributeManager >;
+} // namespace geode
@@ -185,6 +185,29 @@ namespace geode
             const AttributeLinearInterpolation& interpolation,
             index_t to_element );
 
+        /*!
+         * Assign attribute values from other values in the same attribute
+         * @param[in] from_elements Attribute values to assign
+         * @param[in] to_elements Where the values are assigned, to_elements[i]
+         * receives the value of from_elements[i]
+         * @warning Only affect Attributes created with its AttributeProperties
+         * assignable flag set to true
+         */
+        void assign_attribute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements );
+
+        /*!
+         * Interpolate attribute values from other values in the same attribute
+         * @param[in] interpolations Attribute interpolators
+         * @param[in] to_elements Where the values are assigned, to_elements[i]
+         * is computed with interpolations[i]
+         * @warning Only affect Attributes created with its AttributeProperties
+         * interpolable flag set to true
+         */
+        void interpolate_attribute_values(
+            absl::Span< const AttributeLinearInterpolation > interpolations,
+            absl::Span< const index_t > to_elements );
+
         [[nodiscard]] bool has_assignable_attributes() const;
 
         [[nodiscard]] bool has_interpolable_attributes() const;
@@ -250,6 +273,28 @@ namespace geode
         [[nodiscard]] std::optional< std::vector< uuid > >
             attribute_ids_matching_name( std::string_view name ) const;
 
+        /*!
+         * Get a counter incremented each time an attribute is created or
+         * removed from the manager.
+         * It can be used to know if a previously found attribute is still
+         * managed, without any synchronization (see AttributeHandle).
+         */
+        [[nodiscard]] index_t generation() const;
+
+        /*!
+         * Get a counter incremented each time the attributes may have been
+         * modified, i.e. by the modifying functions of the manager and by
+         * the values written in the attributes since the previous call.
+         * @note An attribute is considered as modified as long as a view
+         * given by VariableAttribute::modifiable_values() is valid.
+         */
+        [[nodiscard]] index_t modification_count() const;
+
+        /*!
+         * Increment the modification_count()
+         */
+        void notify_modification();
+
         void copy( const AttributeManager& attribute_manager );
 
         void import( const AttributeManager& attribute_manager,
@@ -34,6 +34,7 @@
 #include <geode/basic/attribute.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/common.hpp>
+#include <geode/basic/detail/bitsery_raw_values.hpp>
 #include <geode/basic/range.hpp>
 
 namespace geode
@@ -42,7 +43,8 @@ namespace geode
         bitsery::ext::PolymorphicContext< bitsery::ext::StandardRTTI >;
     using TContext = std::tuple< PContext,
         bitsery::ext::PointerLinkingContext,
-        bitsery::ext::InheritanceContext >;
+        bitsery::ext::InheritanceContext,
+        detail::RawValuesContext >;
     using Serializer =
         bitsery::Serializer< bitsery::OutputBufferedStreamAdapter, TContext >;
     using Deserializer =
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <geode/basic/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Compressed framing of binary buffers.
+     * The buffer is split into blocks of fixed size which are byte-shuffled
+     * and compressed with zlib independently, so that both compression and
+     * decompression are done in parallel. The framed buffer starts with a
+     * magic header to be distinguished from raw content.
+     */
+    [[nodiscard]] std::string opengeode_basic_api compress_buffer(
+        std::string_view buffer );
+
+    [[nodiscard]] bool opengeode_basic_api is_compressed_buffer(
+        std::string_view buffer );
+
+    /*!
+     * Decompresses a buffer created by compress_buffer
+     * @exception OpenGeodeException if the buffer is not valid
+     */
+    [[nodiscard]] std::string opengeode_basic_api decompress_buffer(
+        std::string_view buffer );
+
+    /*!
+     * Reads the whole stream if it starts with a compressed buffer and
+     * returns its decompressed content. Otherwise, the stream is rewound to
+     * its initial position and nothing is returned.
+     */
+    [[nodiscard]] std::optional< std::string > opengeode_basic_api
+        read_compressed_stream( std::istream& stream );
+
+    /*!
+     * Native files (e.g. standalone meshes) are written compressed when
+     * enabled. Compressed and raw files are both read whatever this option.
+     * Default is disabled.
+     */
+    [[nodiscard]] bool opengeode_basic_api is_native_compression_enabled();
+
+    void opengeode_basic_api set_native_compression( bool enabled );
+} // namespace geode
@@ -84,6 +84,7 @@ namespace geode
         void set_value( T value )
         {
             value_ = std::move( value );
+            this->notify_modification();
         }
 
         [[nodiscard]] const T& default_value() const
@@ -95,6 +96,7 @@ namespace geode
         void modify_value( Modifier modifier )
         {
             modifier( value_ );
+            this->notify_modification();
         }
 
     public:
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <bitsery/bitsery.h>
+
+#include <geode/basic/mapped_file.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Types whose values can be written and read as a raw memory block.
+         * They should be trivially copyable, have no padding, the same size
+         * on every platform and be made of Scalar values of 1, 2, 4 or 8
+         * bytes.
+         * Specialize this struct to enable raw serialization of other types.
+         */
+        template < typename T >
+        struct RawSerializable
+            : std::bool_constant< std::is_arithmetic_v< T >
+                                  && !std::is_same_v< T, bool >
+                                  && !std::is_same_v< T, long double > >
+        {
+            using Scalar = T;
+        };
+
+        template < typename T, std::size_t N >
+        struct RawSerializable< std::array< T, N > > : RawSerializable< T >
+        {
+        };
+
+        template < typename T >
+        inline constexpr bool is_raw_serializable_v =
+            RawSerializable< T >::value;
+
+        template < std::size_t size >
+        struct RawWord;
+
+        template <>
+        struct RawWord< 1 >
+        {
+            using type = std::uint8_t;
+        };
+
+        template <>
+        struct RawWord< 2 >
+        {
+            using type = std::uint16_t;
+        };
+
+        template <>
+        struct RawWord< 4 >
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct RawWord< 8 >
+        {
+            using type = std::uint64_t;
+        };
+
+        template < typename T >
+        struct RawWords
+        {
+            static_assert( is_raw_serializable_v< T > );
+            using Scalar = typename RawSerializable< T >::Scalar;
+            static_assert( sizeof( T ) % sizeof( Scalar ) == 0 );
+            using type = typename RawWord< sizeof( Scalar ) >::type;
+            static constexpr std::size_t PER_VALUE{ sizeof( T )
+                                                    / sizeof( Scalar ) };
+        };
+
+        template < typename Adapter, typename T >
+        void write_raw_values( Adapter& adapter, absl::Span< const T > values )
+        {
+            using Word = typename RawWords< T >::type;
+            adapter.template writeBuffer< sizeof( Word ) >(
+                reinterpret_cast< const Word* >( values.data() ),
+                values.size() * RawWords< T >::PER_VALUE );
+        }
+
+        /*!
+         * Values are read by chunks, so a corrupted size fails on the end of
+         * the input instead of allocating the whole announced size.
+         */
+        template < typename Adapter, typename T >
+        void read_raw_values(
+            Adapter& adapter, std::vector< T >& values, std::uint64_t size )
+        {
+            using Word = typename RawWords< T >::type;
+            constexpr std::size_t CHUNK_BYTES{ 1 << 20 };
+            constexpr auto CHUNK_SIZE =
+                std::max( CHUNK_BYTES / sizeof( T ), std::size_t{ 1 } );
+            values.clear();
+            while( values.size() < size
+                   && adapter.error() == bitsery::ReaderError::NoError )
+            {
+                const auto offset = values.size();
+                const auto chunk =
+                    static_cast< std::size_t >( std::min< std::uint64_t >(
+                        size - offset, CHUNK_SIZE ) );
+                values.resize( offset + chunk );
+                adapter.template readBuffer< sizeof( Word ) >(
+                    reinterpret_cast< Word* >( values.data() + offset ),
+                    chunk * RawWords< T >::PER_VALUE );
+            }
+            if( adapter.error() != bitsery::ReaderError::NoError )
+            {
+                values.clear();
+            }
+        }
+
+        /*!
+         * Bitsery extension writing a vector as its size followed by its
+         * values as a single memory block, instead of serializing each value
+         * independently. The block is written with the archive endianness,
+         * bytes are only swapped on hosts of the other endianness.
+         */
+        class RawValues
+        {
+        public:
+            template < typename Serializer, typename T, typename Fnc >
+            void serialize( Serializer& serializer,
+                const std::vector< T >& values,
+                Fnc&& /*unused*/ ) const
+            {
+                std::uint64_t size = values.size();
+                serializer.value8b( size );
+                write_raw_values(
+                    serializer.adapter(), absl::MakeConstSpan( values ) );
+            }
+
+            template < typename Deserializer, typename T, typename Fnc >
+            void deserialize( Deserializer& deserializer,
+                std::vector< T >& values,
+                Fnc&& /*unused*/ ) const
+            {
+                std::uint64_t size{ 0 };
+                deserializer.value8b( size );
+                read_raw_values( deserializer.adapter(), values, size );
+            }
+        };
+
+        /*!
+         * Archive context of the raw blocks: the stream being written, used
+         * to align the blocks, or the mapped file being read, in which the
+         * blocks are used in place.
+         */
+        struct RawValuesContext
+        {
+            std::ostream* output{ nullptr };
+            MappedFileBuffer* input{ nullptr };
+        };
+
+        /*!
+         * Values used in place in a mapped file, which is kept mapped as long
+         * as the values are used.
+         */
+        template < typename T >
+        class MappedRawValues
+        {
+        public:
+            MappedRawValues() = default;
+            MappedRawValues( std::shared_ptr< const MappedFile > file,
+                const T* data,
+                std::size_t size )
+                : file_( std::move( file ) ), data_( data ), size_( size )
+            {
+            }
+
+            [[nodiscard]] bool is_mapped() const
+            {
+                return file_ != nullptr;
+            }
+
+            [[nodiscard]] absl::Span< const T > values() const
+            {
+                return { data_, size_ };
+            }
+
+            void reset()
+            {
+                file_.reset();
+                data_ = nullptr;
+                size_ = 0;
+            }
+
+        private:
+            std::shared_ptr< const MappedFile > file_;
+            const T* data_{ nullptr };
+            std::size_t size_{ 0 };
+        };
+
+        /*!
+         * Values stored either in a vector or in a mapped file
+         */
+        template < typename T >
+        struct MappableValues
+        {
+            std::vector< T >& values;
+            MappedRawValues< T >& mapped;
+        };
+
+        /*!
+         * Bitsery extension writing values as RawValues, with the memory
+         * block aligned from the beginning of the written stream.
+         * When a mapped file is read (see RawValuesContext), the aligned
+         * blocks are used in place without being copied, their pages are
+         * only loaded on access.
+         */
+        class MappableRawValues
+        {
+            static constexpr std::uint8_t ALIGNMENT{ 64 };
+
+        public:
+            template < typename Serializer, typename T, typename Fnc >
+            void serialize( Serializer& serializer,
+                const MappableValues< T >& storage,
+                Fnc&& /*unused*/ ) const
+            {
+                const auto values = storage.mapped.is_mapped()
+                                        ? storage.mapped.values()
+                                        : absl::MakeConstSpan( storage.values );
+                std::uint64_t size = values.size();
+                serializer.value8b( size );
+                std::uint8_t padding{ 0 };
+                const auto* context =
+                    serializer.template contextOrNull< RawValuesContext >();
+                if( context != nullptr && context->output != nullptr )
+                {
+                    serializer.adapter().flush();
+                    const auto position =
+                        static_cast< std::uint64_t >( context->output->tellp() )
+                        + 1;
+                    padding = static_cast< std::uint8_t >(
+                        ( ALIGNMENT - position % ALIGNMENT ) % ALIGNMENT );
+                }
+                serializer.value1b( padding );
+                const std::array< std::uint8_t, ALIGNMENT > zeros{};
+                serializer.adapter().template writeBuffer< 1 >(
+                    zeros.data(), padding );
+                write_raw_values( serializer.adapter(), values );
+            }
+
+            template < typename Deserializer, typename T, typename Fnc >
+            void deserialize( Deserializer& deserializer,
+                MappableValues< T >& storage,
+                Fnc&& /*unused*/ ) const
+            {
+                storage.mapped.reset();
+                std::uint64_t size{ 0 };
+                deserializer.value8b( size );
+                std::uint8_t padding{ 0 };
+                deserializer.value1b( padding );
+                auto& adapter = deserializer.adapter();
+                if( padding >= ALIGNMENT )
+                {
+                    adapter.error( bitsery::ReaderError::InvalidData );
+                    return;
+                }
+                std::array< std::uint8_t, ALIGNMENT > skipped;
+                adapter.template readBuffer< 1 >( skipped.data(), padding );
+                if( map_values( deserializer, storage, size ) )
+                {
+                    return;
+                }
+                read_raw_values( adapter, storage.values, size );
+            }
+
+        private:
+            template < typename Deserializer, typename T >
+            static bool map_values( Deserializer& deserializer,
+                MappableValues< T >& storage,
+                std::uint64_t size )
+            {
+                const auto* context =
+                    deserializer.template contextOrNull< RawValuesContext >();
+                if( context == nullptr || context->input == nullptr
+                    || !is_little_endian_host()
+                    || deserializer.adapter().error()
+                           != bitsery::ReaderError::NoError )
+                {
+                    return false;
+                }
+                auto& input = *context->input;
+                const auto* data = input.position();
+                if( reinterpret_cast< std::uintptr_t >( data ) % alignof( T )
+                        != 0
+                    || size > std::numeric_limits< std::size_t >::max()
+                                  / sizeof( T )
+                    || !input.skip( size * sizeof( T ) ) )
+                {
+                    return false;
+                }
+                storage.values.clear();
+                storage.mapped = { input.file(),
+                    reinterpret_cast< const T* >( data ),
+                    static_cast< std::size_t >( size ) };
+                return true;
+            }
+
+            /* Archives are little-endian, as bitsery default configuration */
+            static bool is_little_endian_host()
+            {
+                const std::uint16_t probe{ 1 };
+                std::uint8_t first_byte;
+                std::memcpy( &first_byte, &probe, 1 );
+                return first_byte == 1;
+            }
+        };
+    } // namespace detail
+} // namespace geode
+
+namespace bitsery::traits
+{
+    template < typename T >
+    struct ExtensionTraits< geode::detail::RawValues, std::vector< T > >
+    {
+        using TValue = void;
+        static constexpr bool SupportValueOverload = false;
+        static constexpr bool SupportObjectOverload = true;
+        static constexpr bool SupportLambdaOverload = false;
+    };
+
+    template < typename T >
+    struct ExtensionTraits< geode::detail::MappableRawValues,
+        geode::detail::MappableValues< T > >
+    {
+        using TValue = void;
+        static constexpr bool SupportValueOverload = false;
+        static constexpr bool SupportObjectOverload = true;
+        static constexpr bool SupportLambdaOverload = false;
+    };
+} // namespace bitsery::traits
@@ -115,6 +115,32 @@ namespace geode
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
+
+    /*!
+     * Set the Logger level for the lifetime of the guard.
+     * The previous level is restored on destruction, even if an exception
+     * is thrown in the meantime.
+     */
+    class LoggerLevelGuard
+    {
+    public:
+        explicit LoggerLevelGuard( Logger::LEVEL level )
+            : previous_level_{ Logger::level() }
+        {
+            Logger::set_level( level );
+        }
+
+        ~LoggerLevelGuard()
+        {
+            Logger::set_level( previous_level_ );
+        }
+
+        LoggerLevelGuard( const LoggerLevelGuard & ) = delete;
+        LoggerLevelGuard &operator=( const LoggerLevelGuard & ) = delete;
+
+    private:
+        Logger::LEVEL previous_level_;
+    };
 } // namespace geode
 
 #include <geode/basic/detail/enable_debug_logger.hpp>
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+#include <string_view>
+
+#include <geode/basic/common.hpp>
+#include <geode/basic/pimpl.hpp>
+
+namespace geode
+{
+    /*!
+     * Read-only memory mapping of a whole file.
+     * Pages are loaded by the system when they are first accessed, opening a
+     * large file is therefore immediate.
+     * @warning The file should not be modified, truncated or removed while it
+     * is mapped.
+     */
+    class opengeode_basic_api MappedFile
+    {
+        OPENGEODE_DISABLE_COPY_AND_MOVE( MappedFile );
+
+    public:
+        /*!
+         * @exception OpenGeodeException if the file cannot be mapped
+         */
+        explicit MappedFile( std::string_view filename );
+        ~MappedFile();
+
+        [[nodiscard]] std::string_view content() const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+
+    /*!
+     * Stream buffer reading a mapped file without copying it.
+     * The current position in the file is exposed so that raw blocks can be
+     * used in place instead of being read.
+     */
+    class MappedFileBuffer : public std::streambuf
+    {
+    public:
+        explicit MappedFileBuffer( std::shared_ptr< const MappedFile > file )
+            : file_( std::move( file ) )
+        {
+            auto* begin = const_cast< char* >( file_->content().data() );
+            setg( begin, begin, begin + file_->content().size() );
+        }
+
+        [[nodiscard]] const std::shared_ptr< const MappedFile >& file() const
+        {
+            return file_;
+        }
+
+        [[nodiscard]] const char* position() const
+        {
+            return gptr();
+        }
+
+        /*!
+         * Move the position forward without reading
+         * @return false if there are not enough remaining bytes
+         */
+        [[nodiscard]] bool skip( std::size_t nb_bytes )
+        {
+            if( nb_bytes > static_cast< std::size_t >( egptr() - gptr() ) )
+            {
+                return false;
+            }
+            setg( eback(), gptr() + nb_bytes, egptr() );
+            return true;
+        }
+
+    protected:
+        pos_type seekoff( off_type offset,
+            std::ios_base::seekdir direction,
+            std::ios_base::openmode /*unused*/ ) override
+        {
+            const auto* origin = direction == std::ios_base::beg   ? eback()
+                                 : direction == std::ios_base::cur ? gptr()
+                                                                   : egptr();
+            return seekpos( pos_type( origin - eback() + offset ),
+                std::ios_base::in );
+        }
+
+        pos_type seekpos(
+            pos_type position, std::ios_base::openmode /*unused*/ ) override
+        {
+            const auto offset = static_cast< off_type >( position );
+            if( offset < 0 || offset > egptr() - eback() )
+            {
+                return pos_type( off_type( -1 ) );
+            }
+            setg( eback(), eback() + offset, egptr() );
+            return position;
+        }
+
+    private:
+        std::shared_ptr< const MappedFile > file_;
+    };
+
+    /*!
+     * Uncompressed native files (e.g. standalone meshes) are mapped in memory
+     * when enabled, their plain-old-data attribute values are then used in
+     * place and copied on their first modification.
+     * Default is disabled.
+     * @warning A mapped file should not be overwritten while a mesh loaded
+     * from it is alive.
+     */
+    [[nodiscard]] bool opengeode_basic_api is_native_mapping_enabled();
+
+    void opengeode_basic_api set_native_mapping( bool enabled );
+} // namespace geode
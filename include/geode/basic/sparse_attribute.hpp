@@ -94,6 +94,7 @@ namespace geode
         void set_value( index_t element, T value )
         {
             values_[element] = std::move( value );
+            this->notify_modification();
         }
 
         [[nodiscard]] const AttributeValues< T >& default_values() const
@@ -107,6 +108,7 @@ namespace geode
             auto [value_it, _] =
                 values_.emplace( element, default_values_.default_value );
             modifier( value_it->second );
+            this->notify_modification();
         }
 
     public:
@@ -34,6 +34,7 @@
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/attribute.hpp>
 #include <geode/basic/common.hpp>
+#include <geode/basic/detail/bitsery_raw_values.hpp>
 #include <geode/basic/detail/mapping_after_deletion.hpp>
 #include <geode/basic/growable.hpp>
 #include <geode/basic/identifier_builder.hpp>
@@ -68,12 +69,12 @@ namespace geode
 
         [[nodiscard]] const T& value( index_t element ) const override
         {
-            return values_[element];
+            return values()[element];
         }
 
         [[nodiscard]] bool has_value( index_t element ) const override
         {
-            if( values_[element] == default_values_.no_value )
+            if( values()[element] == default_values_.no_value )
             {
                 return false;
             }
@@ -82,7 +83,56 @@ namespace geode
 
         void set_value( index_t element, T value )
         {
+            unmap();
             values_[element] = std::move( value );
+            this->notify_modification();
+        }
+
+        /*!
+         * Get a view on all the attribute values
+         * @warning The view is invalidated when the number of elements
+         * changes, or on the first modification of values used in place in
+         * a mapped file (see set_native_mapping)
+         */
+        [[nodiscard]] absl::Span< const T > values() const
+        {
+            if constexpr( detail::is_raw_serializable_v< T > )
+            {
+                if( mapped_.is_mapped() )
+                {
+                    return mapped_.values();
+                }
+            }
+            return values_;
+        }
+
+        /*!
+         * Get a modifiable view on all the attribute values
+         * @warning The view is invalidated when the number of elements
+         * changes. Until then, the attribute is considered as modified.
+         */
+        [[nodiscard]] absl::Span< T > modifiable_values()
+        {
+            unmap();
+            this->notify_modifiable_view();
+            return absl::MakeSpan( values_ );
+        }
+
+        /*!
+         * Set all the attribute values at once
+         * @param[in] values New values, one per element
+         */
+        void set_values( absl::Span< const T > values )
+        {
+            OpenGeodeBasicException::check_exception(
+                values.size() == size(), nullptr,
+                OpenGeodeException::TYPE::data,
+                "[VariableAttribute::set_values] Number of values (",
+                values.size(), ") should match the number of elements (",
+                size(), ")" );
+            unmap();
+            absl::c_copy( values, values_.begin() );
+            this->notify_modification();
         }
 
         [[nodiscard]] const AttributeValues< T >& default_values() const
@@ -93,12 +143,14 @@ namespace geode
         template < typename Modifier >
         void modify_value( index_t element, Modifier modifier )
         {
+            unmap();
             modifier( values_[element] );
+            this->notify_modification();
         }
 
         [[nodiscard]] index_t size() const
         {
-            return values_.size();
+            return values().size();
         }
 
     public:
@@ -116,6 +168,30 @@ namespace geode
             set_value( to_element, interpolation.compute_value( *this ) );
         }
 
+        void compute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeBase::AttributeKey /*key*/ ) override
+        {
+            unmap();
+            for( const auto i : Indices{ to_elements } )
+            {
+                values_[to_elements[i]] = values_[from_elements[i]];
+            }
+        }
+
+        void compute_values(
+            absl::Span< const AttributeLinearInterpolation > interpolations,
+            absl::Span< const index_t > to_elements,
+            AttributeBase::AttributeKey /*key*/ ) override
+        {
+            unmap();
+            for( const auto i : Indices{ to_elements } )
+            {
+                values_[to_elements[i]] =
+                    interpolations[i].compute_value( *this );
+            }
+        }
+
     protected:
         VariableAttribute( AttributeValues< T > default_values,
             std::string_view name,
@@ -163,6 +239,49 @@ namespace geode
                                 []( Archive& archive2, T& item ) {
                                     archive2( item );
                                 } );
+                        },
+                        []( Archive& archive,
+                            VariableAttribute< T >& attribute ) {
+                            archive.ext(
+                                attribute, bitsery::ext::BaseClass<
+                                               ReadOnlyAttribute< T > >{} );
+                            archive( attribute.default_values_ );
+                            if constexpr( detail::is_raw_serializable_v< T > )
+                            {
+                                archive.ext(
+                                    attribute.values_, detail::RawValues{} );
+                            }
+                            else
+                            {
+                                archive.container( attribute.values_,
+                                    attribute.values_.max_size(),
+                                    []( Archive& archive2, T& item ) {
+                                        archive2( item );
+                                    } );
+                            }
+                        },
+                        []( Archive& archive,
+                            VariableAttribute< T >& attribute ) {
+                            archive.ext(
+                                attribute, bitsery::ext::BaseClass<
+                                               ReadOnlyAttribute< T > >{} );
+                            archive( attribute.default_values_ );
+                            if constexpr( detail::is_raw_serializable_v< T > )
+                            {
+                                detail::MappableValues< T > storage{
+                                    attribute.values_, attribute.mapped_
+                                };
+                                archive.ext(
+                                    storage, detail::MappableRawValues{} );
+                            }
+                            else
+                            {
+                                archive.container( attribute.values_,
+                                    attribute.values_.max_size(),
+                                    []( Archive& archive2, T& item ) {
+                                        archive2( item );
+                                    } );
+                            }
                         } } } );
             values_.reserve( 10 );
         }
@@ -170,6 +289,12 @@ namespace geode
         void resize(
             index_t size, AttributeBase::AttributeKey /*key*/ ) override
         {
+            if( size == this->size() )
+            {
+                return;
+            }
+            this->release_modifiable_view();
+            unmap();
             const auto capacity = static_cast< index_t >( values_.capacity() );
             if( size > capacity )
             {
@@ -182,18 +307,26 @@ namespace geode
         void reserve(
             index_t capacity, AttributeBase::AttributeKey /*key*/ ) override
         {
+            if( mapped_.is_mapped() )
+            {
+                // Reserved on the first modification
+                return;
+            }
             values_.reserve( capacity );
         }
 
         void delete_elements( const std::vector< bool >& to_delete,
             AttributeBase::AttributeKey /*key*/ ) override
         {
+            this->release_modifiable_view();
+            unmap();
             delete_vector_elements( to_delete, values_ );
         }
 
         void permute_elements( absl::Span< const index_t > permutation,
             AttributeBase::AttributeKey /*key*/ ) override
         {
+            unmap();
             permute( values_, permutation );
         }
 
@@ -207,6 +340,7 @@ namespace geode
             IdentifierBuilder builder{ *attribute };
             builder.set_id( this->id() );
             attribute->values_ = values_;
+            attribute->mapped_ = mapped_;
             return attribute;
         }
 
@@ -219,6 +353,7 @@ namespace geode
             default_values_ = typed_attribute.default_values_;
             if( nb_elements != 0 )
             {
+                unmap();
                 values_.resize( nb_elements, default_values_.default_value );
                 for( const auto i : Range{ nb_elements } )
                 {
@@ -307,9 +442,28 @@ namespace geode
             }
         }
 
+    private:
+        /*!
+         * Copy values used in place in a mapped file before their first
+         * modification
+         */
+        void unmap()
+        {
+            if constexpr( detail::is_raw_serializable_v< T > )
+            {
+                if( mapped_.is_mapped() )
+                {
+                    const auto values = mapped_.values();
+                    values_.assign( values.begin(), values.end() );
+                    mapped_.reset();
+                }
+            }
+        }
+
     private:
         AttributeValues< T > default_values_;
         std::vector< T > values_{};
+        detail::MappedRawValues< T > mapped_;
     };
 
     /*!
@@ -348,6 +502,7 @@ namespace geode
         void set_value( index_t element, bool value )
         {
             values_[element] = std::move( value );
+            this->notify_modification();
         }
 
         [[nodiscard]] AttributeValues< bool > default_values() const
@@ -359,6 +514,7 @@ namespace geode
         void modify_value( index_t element, Modifier modifier )
         {
             modifier( reinterpret_cast< bool& >( values_[element] ) );
+            this->notify_modification();
         }
 
         [[nodiscard]] index_t size() const
@@ -23,7 +23,12 @@
 
 #pragma once
 
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <absl/types/span.h>
 
@@ -31,6 +36,11 @@
 
 #include <geode/basic/pimpl.hpp>
 
+namespace geode
+{
+    class MappedFile;
+} // namespace geode
+
 namespace geode
 {
     class opengeode_basic_api ZipFile
@@ -38,12 +48,45 @@ namespace geode
     public:
         ZipFile(
             std::string_view file, std::string_view archive_temp_filename );
+        /*!
+         * Creates an archive written in memory instead of on disk.
+         * Its content is given by release_buffer() once all the files are
+         * archived.
+         */
+        explicit ZipFile( std::string_view archive_temp_filename );
         ~ZipFile();
 
         void archive_files( absl::Span< const std::string_view >& files ) const;
 
         void archive_file( std::string_view file ) const;
 
+        /*!
+         * Adds a file to the archive directly from memory
+         * @param[in] file_name Name of the file inside the archive
+         * @param[in] content Content of the file
+         * @note This function can be called concurrently, files are appended
+         * to the archive one at a time.
+         */
+        void archive_buffer(
+            std::string_view file_name, std::string_view content ) const;
+
+        /*!
+         * Adds files of an existing archive to this archive. Their data are
+         * copied byte-for-byte, without being extracted nor compressed again.
+         * @param[in] archive Path to the existing archive
+         * @param[in] file_names Names of the files inside the existing archive
+         */
+        void archive_files_from( std::string_view archive,
+            absl::Span< const std::string > file_names ) const;
+
+        /*!
+         * Closes an archive written in memory and returns its content.
+         * No file can be archived afterwards.
+         * @exception OpenGeodeException if the archive exceeds 2 GiB, the
+         * maximum size of an archive written in memory.
+         */
+        [[nodiscard]] std::string release_buffer();
+
         [[nodiscard]] std::string directory() const;
 
     private:
@@ -55,10 +98,51 @@ namespace geode
     public:
         UnzipFile(
             std::string_view file, std::string_view unarchive_temp_filename );
+        /*!
+         * @param[in] load_in_memory If false, the archive is read from disk
+         * and nothing is loaded in memory until files are extracted.
+         */
+        UnzipFile( std::string_view file,
+            std::string_view unarchive_temp_filename,
+            bool load_in_memory );
+        /*!
+         * Opens an archive from a memory buffer, the buffer is copied.
+         * Its files are never extracted on disk: extract_file() only gives
+         * their path in the directory() and open_input_file() reads them
+         * from memory.
+         * @exception OpenGeodeException if the buffer exceeds 2 GiB.
+         */
+        UnzipFile( absl::Span< const uint8_t > buffer,
+            std::string_view unarchive_temp_filename );
         ~UnzipFile();
 
+        /*!
+         * Extracts all the files of the archive in the directory().
+         * Files are extracted in parallel, each thread reading the archive
+         * with its own handle.
+         */
         void extract_all() const;
 
+        /*!
+         * Extracts a single file of the archive in the directory()
+         * @return the path of the extracted file
+         * @note This function can be called concurrently.
+         */
+        std::string extract_file( std::string_view file_name ) const;
+
+        [[nodiscard]] bool has_file( std::string_view file_name ) const;
+
+        /*!
+         * Reads a single file of the archive in memory
+         * @note This function can be called concurrently.
+         */
+        [[nodiscard]] std::string read_file( std::string_view file_name ) const;
+
+        /*!
+         * Returns the names of all the files of the archive
+         */
+        [[nodiscard]] std::vector< std::string > file_names() const;
+
         [[nodiscard]] std::string directory() const;
 
     private:
@@ -66,4 +150,56 @@ namespace geode
     };
 
     [[nodiscard]] bool opengeode_basic_api is_zip_file( std::string_view file );
+
+    /*!
+     * Binary output stream given by open_output_file()
+     */
+    class opengeode_basic_api OutputFile : public std::ostream
+    {
+    public:
+        ~OutputFile() override;
+
+        /*!
+         * Saves the written content, i.e. flushes it on disk or adds it to
+         * its archive. This function has to be called once everything is
+         * written, further calls do nothing.
+         * @exception OpenGeodeException if the content cannot be saved
+         * @note If the stream is destroyed without being closed, the content
+         * is saved by the destructor and failures are only logged.
+         */
+        virtual void close() = 0;
+
+    protected:
+        OutputFile();
+    };
+
+    /*!
+     * Opens a binary output stream to write a file.
+     * Each ZipFile registers its directory() when created and unregisters it
+     * when destroyed. If \p file is located in the directory() of an existing
+     * ZipFile, the content is kept in memory and added to this archive when
+     * the stream is closed: the file is never written on disk. Otherwise, the
+     * file is written on disk at the given path.
+     * @warning OutputFile::close() has to be called to know if the content
+     * was correctly saved.
+     */
+    [[nodiscard]] std::unique_ptr< OutputFile > opengeode_basic_api
+        open_output_file( std::string_view file );
+
+    /*!
+     * Opens a binary input stream to read a file.
+     * If the file is located in the directory() of an UnzipFile opened from a
+     * memory buffer, the content is read from this archive, no file is read
+     * on disk.
+     */
+    [[nodiscard]] std::unique_ptr< std::istream > opengeode_basic_api
+        open_input_file( std::string_view file );
+
+    /*!
+     * Maps a file in memory to read it without copying it.
+     * @return nullptr if the file is not on disk, e.g. if it is read from an
+     * UnzipFile opened from a memory buffer.
+     */
+    [[nodiscard]] std::shared_ptr< const MappedFile > opengeode_basic_api
+        map_input_file( std::string_view file );
 } // namespace geode
\ No newline at end of file
@@ -45,6 +45,25 @@ namespace geode
     {
         OPENGEODE_DISABLE_COPY( AABBTree );
 
+    public:
+        /*!
+         * Flat storage of the boxes found for a batch of queries.
+         * Boxes of the query q are stored in boxes between offsets[q] and
+         * offsets[q + 1].
+         */
+        struct BoxesBatch
+        {
+            [[nodiscard]] absl::Span< const index_t > query_boxes(
+                index_t query ) const
+            {
+                return absl::MakeConstSpan( boxes ).subspan(
+                    offsets[query], offsets[query + 1] - offsets[query] );
+            }
+
+            std::vector< index_t > offsets;
+            std::vector< index_t > boxes;
+        };
+
     public:
         /*!
          * @brief AABB is a search tree for fast spatial request using the
@@ -77,6 +96,16 @@ namespace geode
         [[nodiscard]] std::vector< index_t > containing_boxes(
             const Point< dimension >& query ) const;
 
+        /*!
+         * @brief Gets all the boxes containing each point of a batch
+         * @param[in] queries the points to test
+         * @return the boxes of each query, in the same order as \p queries
+         * @note Queries are processed in parallel following their Morton
+         * order to improve the tree traversal coherence.
+         */
+        [[nodiscard]] BoxesBatch containing_boxes(
+            absl::Span< const Point< dimension > > queries ) const;
+
         /*!
          * @brief Gets the closest element to a point
          * @param[in] query the point to test
@@ -100,6 +129,51 @@ namespace geode
         [[nodiscard]] std::tuple< index_t, double > closest_element_box(
             const Point< dimension >& query, const EvalDistance& action ) const;
 
+        /*!
+         * @brief Gets the closest element to a point, stopping the search as
+         * soon as an element nearer than a given distance is found
+         * @param[in] query the point to test
+         * @param[in] action the functor to compute the distance between
+         * the \p query and the tree element in boxes
+         * @param[in] stop_distance the search stops when an element at a
+         * distance lower or equal to this value is found
+         * @return a tuple containing the index of the element/box and its
+         * distance to the \p query. If this distance is greater than \p
+         * stop_distance, the element is the closest one. Otherwise, the element
+         * is only guaranteed to be nearer than \p stop_distance.
+         *
+         * @tparam EvalDistance same requirements as in closest_element_box.
+         * @note This is useful when only the distances greater than a known
+         * bound matter, e.g. to compute a maximum of minimal distances.
+         */
+        template < typename EvalDistance >
+        [[nodiscard]] std::tuple< index_t, double > closest_element_box(
+            const Point< dimension >& query,
+            const EvalDistance& action,
+            double stop_distance ) const;
+
+        /*!
+         * @brief Gets the closest element to each point of a batch
+         * @param[in] queries the points to test
+         * @param[in] action the functor to compute the distance between
+         * a query and the tree element in boxes
+         * @return for each query, in the same order as \p queries, a tuple
+         * containing:
+         * - the index of the closest element/box.
+         * - the distance between the query and this element.
+         *
+         * @tparam EvalDistance same requirements as in closest_element_box.
+         * @warning The \p action is called concurrently, it should be
+         * thread-safe.
+         * @note Queries are processed in parallel following their Morton
+         * order to improve the tree traversal coherence.
+         */
+        template < typename EvalDistance >
+        [[nodiscard]] std::vector< std::tuple< index_t, double > >
+            closest_element_boxes(
+                absl::Span< const Point< dimension > > queries,
+                const EvalDistance& action ) const;
+
         /*!
          * @brief Computes the intersections between a given
          * box and the all element boxes.
@@ -176,6 +250,49 @@ namespace geode
         void compute_ray_element_bbox_intersections(
             const Ray< dimension >& ray, EvalIntersection& action ) const;
 
+        /*!
+         * @brief Computes the intersections between a batch of rays and all
+         * element boxes.
+         * @param[in] rays The rays to test.
+         * @param[in] action The functor to run when a box is intersected by a
+         * ray.
+         * @tparam EvalIntersection this functor should have an operator()
+         * defined like this:
+         * bool operator()( index_t ray_id, index_t cur_element_box ) ;
+         * @note the operator define what to do with the box \p
+         * cur_element_box if it is intersected by the ray \p ray_id.
+         * @note The returned boolean indicates if the search for this ray
+         * should stop or continue. Return true to stop the search, false to
+         * continue.
+         * @warning The \p action is called concurrently, it should be
+         * thread-safe.
+         * @note Rays are processed in parallel following the Morton order of
+         * their origins to improve the tree traversal coherence.
+         */
+        template < class EvalIntersection >
+        void compute_ray_element_bbox_intersections(
+            absl::Span< const Ray< dimension > > rays,
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a packet of rays and all
+         * element boxes, traversing the tree once for the whole packet.
+         * @param[in] rays The rays to test, coherent rays (e.g. sharing the
+         * same origin) benefit the most from the shared traversal.
+         * @param[in] action The functor to run when a box is intersected by a
+         * ray.
+         * @tparam EvalIntersection this functor should have an operator()
+         * defined like this:
+         * bool operator()( index_t ray_id, index_t cur_element_box ) ;
+         * @note The returned boolean indicates if the search for this ray
+         * should stop or continue. Return true to stop the search, false to
+         * continue.
+         */
+        template < class EvalIntersection >
+        void compute_ray_packet_element_bbox_intersections(
+            absl::Span< const Ray< dimension > > rays,
+            EvalIntersection& action ) const;
+
         /*!
          * @brief Computes the intersections between a given infinite line and
          * all element boxes.
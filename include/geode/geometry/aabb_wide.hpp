@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/geometry/basic_objects/infinite_line.hpp>
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Bounding volume hierarchy where each node stores the boxes of its
+     * AABBTreeWide::WIDTH children as a structure of arrays, so that a
+     * point or a ray can be tested against all of them in one vectorizable
+     * loop. It is an alternative to AABBTree with fewer and wider levels,
+     * useful for ray tracing and closest element queries on large meshes.
+     */
+    template < index_t dimension >
+    class AABBTreeWide
+    {
+        OPENGEODE_DISABLE_COPY( AABBTreeWide );
+        OPENGEODE_TEMPLATE_ASSERT_2D_OR_3D( dimension );
+
+    public:
+        static constexpr local_index_t WIDTH{ 4 };
+
+    public:
+        /*!
+         * @param bboxes container containing elements bounding boxes.
+         * Each element can then be accessed using the index of its box in the
+         * tree which should match the index in its initial container.
+         */
+        AABBTreeWide();
+        explicit AABBTreeWide(
+            absl::Span< const BoundingBox< dimension > > bboxes );
+        AABBTreeWide( AABBTreeWide&& other ) noexcept;
+        ~AABBTreeWide();
+
+        AABBTreeWide& operator=( AABBTreeWide&& other ) noexcept;
+
+        [[nodiscard]] index_t nb_bboxes() const;
+
+        [[nodiscard]] const BoundingBox< dimension >& bounding_box() const;
+
+        /*!
+         * @brief Gets all the boxes containing a point
+         * @param[in] query the point to test
+         */
+        [[nodiscard]] std::vector< index_t > containing_boxes(
+            const Point< dimension >& query ) const;
+
+        /*!
+         * @brief Gets the closest element to a point
+         * @param[in] query the point to test
+         * @param[in] action the functor to compute the distance between
+         * the \p query and the tree element in boxes
+         * @return a tuple containing:
+         * - the index of the closest element/box.
+         * - the distance between the \p query and this element.
+         * @tparam EvalDistance same requirements as in
+         * AABBTree::closest_element_box.
+         */
+        template < typename EvalDistance >
+        [[nodiscard]] std::tuple< index_t, double > closest_element_box(
+            const Point< dimension >& query, const EvalDistance& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given box and all
+         * element boxes.
+         * @tparam EvalIntersection same requirements as in
+         * AABBTree::compute_bbox_element_bbox_intersections.
+         */
+        template < class EvalIntersection >
+        void compute_bbox_element_bbox_intersections(
+            const BoundingBox< dimension >& box,
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given ray and all
+         * element boxes.
+         * @tparam EvalIntersection same requirements as in
+         * AABBTree::compute_ray_element_bbox_intersections.
+         */
+        template < class EvalIntersection >
+        void compute_ray_element_bbox_intersections(
+            const Ray< dimension >& ray, EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between any object and all
+         * element boxes.
+         * @note Children boxes have to be rebuilt from the node storage before
+         * calling the \p box_filter, prefer the dedicated methods when
+         * available.
+         * @tparam EvalBox, EvalIntersection same requirements as in
+         * AABBTree::compute_generic_element_bbox_intersections.
+         */
+        template < class EvalBox, class EvalIntersection >
+        void compute_generic_element_bbox_intersections(
+            const EvalBox& box_filter, EvalIntersection& action ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( AABBTreeWide );
+} // namespace geode
+
+#include <geode/geometry/detail/aabb_wide_impl.hpp>
@@ -29,7 +29,14 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <limits>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/inlined_vector.h>
+
+#include <async++.h>
 
 #include <geode/basic/pimpl_impl.hpp>
 
@@ -50,12 +57,17 @@ namespace geode
      *                  B1     B2   B3    B4
      *  where B* are the input bboxes
      *  Storage: |empty|ROOT|A1|A2|B1|B2|B3|B4|
+     * Subtrees larger than PARALLEL_BUILD_THRESHOLD elements are built
+     * concurrently, smaller ones are built by a single task to keep their
+     * nodes in cache.
      */
     template < index_t dimension >
     class AABBTree< dimension >::Impl
     {
     public:
         static constexpr index_t ROOT_INDEX{ 1 };
+        static constexpr index_t PARALLEL_BUILD_THRESHOLD{ 4096 };
+        static constexpr index_t PACKET_SIZE{ 16 };
 
         struct Iterator
         {
@@ -71,10 +83,11 @@ namespace geode
             : mapping_morton_( [&bboxes]() {
                   absl::FixedArray< Point< dimension > > points(
                       bboxes.size() );
-                  for( const auto i : Indices{ bboxes } )
-                  {
-                      points[i] = bboxes[i].min() + bboxes[i].max();
-                  }
+                  async::parallel_for(
+                      async::irange( size_t{ 0 }, bboxes.size() ),
+                      [&bboxes, &points]( size_t i ) {
+                          points[i] = bboxes[i].min() + bboxes[i].max();
+                      } );
                   return morton_mapping< dimension >( points );
               }() )
         {
@@ -139,10 +152,25 @@ namespace geode
             }
             const auto it = get_recursive_iterators(
                 node_index, element_begin, element_end );
-            const auto node_left = max_node_index_recursive(
-                it.child_left, element_begin, it.element_middle );
-            const auto node_right = max_node_index_recursive(
-                it.child_right, it.element_middle, element_end );
+            index_t node_left{ NO_ID };
+            index_t node_right{ NO_ID };
+            const auto compute_left = [&node_left, &it, element_begin] {
+                node_left = max_node_index_recursive(
+                    it.child_left, element_begin, it.element_middle );
+            };
+            const auto compute_right = [&node_right, &it, element_end] {
+                node_right = max_node_index_recursive(
+                    it.child_right, it.element_middle, element_end );
+            };
+            if( element_end - element_begin > PARALLEL_BUILD_THRESHOLD )
+            {
+                async::parallel_invoke( compute_left, compute_right );
+            }
+            else
+            {
+                compute_left();
+                compute_right();
+            }
             return std::max( node_left, node_right );
         }
 
@@ -168,10 +196,23 @@ namespace geode
                 it.child_left < tree_.size(), "Left index out of tree" );
             OpenGeodeGeometryException::check_assertion(
                 it.child_right < tree_.size(), "Right index out of tree" );
-            initialize_tree_recursive(
-                bboxes, it.child_left, element_begin, it.element_middle );
-            initialize_tree_recursive(
-                bboxes, it.child_right, it.element_middle, element_end );
+            const auto initialize_left = [this, &bboxes, &it, element_begin] {
+                initialize_tree_recursive(
+                    bboxes, it.child_left, element_begin, it.element_middle );
+            };
+            const auto initialize_right = [this, &bboxes, &it, element_end] {
+                initialize_tree_recursive(
+                    bboxes, it.child_right, it.element_middle, element_end );
+            };
+            if( element_end - element_begin > PARALLEL_BUILD_THRESHOLD )
+            {
+                async::parallel_invoke( initialize_left, initialize_right );
+            }
+            else
+            {
+                initialize_left();
+                initialize_right();
+            }
             // before box_union
             tree_[node_index].add_box( node( it.child_left ) );
             tree_[node_index].add_box( node( it.child_right ) );
@@ -184,6 +225,7 @@ namespace geode
             index_t node_index,
             index_t element_begin,
             index_t element_end,
+            double stop_distance,
             const ACTION& action ) const
         {
             OpenGeodeGeometryException::check_assertion(
@@ -191,6 +233,10 @@ namespace geode
             OpenGeodeGeometryException::check_assertion(
                 element_begin != element_end,
                 "Begin and End indices should be different" );
+            if( distance <= stop_distance )
+            {
+                return;
+            }
 
             // If node is a leaf: compute point-element distance
             // and replace current if nearer
@@ -221,13 +267,13 @@ namespace geode
                 {
                     closest_element_box_recursive( query, nearest_box, distance,
                         it.child_left, element_begin, it.element_middle,
-                        action );
+                        stop_distance, action );
                 }
                 if( distance_right < distance )
                 {
                     closest_element_box_recursive( query, nearest_box, distance,
                         it.child_right, it.element_middle, element_end,
-                        action );
+                        stop_distance, action );
                 }
             }
             else
@@ -236,13 +282,13 @@ namespace geode
                 {
                     closest_element_box_recursive( query, nearest_box, distance,
                         it.child_right, it.element_middle, element_end,
-                        action );
+                        stop_distance, action );
                 }
                 if( distance_left < distance )
                 {
                     closest_element_box_recursive( query, nearest_box, distance,
                         it.child_left, element_begin, it.element_middle,
-                        action );
+                        stop_distance, action );
                 }
             }
         }
@@ -420,6 +466,117 @@ namespace geode
                 it.element_middle, element_end, action );
         }
 
+        /*!
+         * Rays of a packet stored as structure of arrays so that the slab
+         * tests of a node are computed in a single loop over the rays.
+         */
+        class RayPacket
+        {
+        public:
+            explicit RayPacket( absl::Span< const Ray< dimension > > rays )
+                : stopped_( rays.size(), false )
+            {
+                for( const auto d : LRange{ dimension } )
+                {
+                    origins_[d].resize( rays.size() );
+                    inverse_directions_[d].resize( rays.size() );
+                    for( const auto r : Indices{ rays } )
+                    {
+                        origins_[d][r] = rays[r].origin().value( d );
+                        inverse_directions_[d][r] =
+                            1. / rays[r].direction().value( d );
+                    }
+                }
+            }
+
+            [[nodiscard]] index_t nb_rays() const
+            {
+                return stopped_.size();
+            }
+
+            void stop( index_t ray_id )
+            {
+                stopped_[ray_id] = true;
+            }
+
+            template < typename Container >
+            void hit_rays( const BoundingBox< dimension >& box,
+                absl::Span< const index_t > rays,
+                Container& hits ) const
+            {
+                absl::InlinedVector< double, PACKET_SIZE > t_near(
+                    rays.size(), 0. );
+                absl::InlinedVector< double, PACKET_SIZE > t_far(
+                    rays.size(), std::numeric_limits< double >::max() );
+                for( const auto d : LRange{ dimension } )
+                {
+                    const auto min = box.min().value( d ) - GLOBAL_EPSILON;
+                    const auto max = box.max().value( d ) + GLOBAL_EPSILON;
+                    const auto* origins = origins_[d].data();
+                    const auto* inverse_directions =
+                        inverse_directions_[d].data();
+                    for( const auto r : Indices{ rays } )
+                    {
+                        const auto ray_id = rays[r];
+                        const auto t0 = ( min - origins[ray_id] )
+                                        * inverse_directions[ray_id];
+                        const auto t1 = ( max - origins[ray_id] )
+                                        * inverse_directions[ray_id];
+                        t_near[r] = std::max( t_near[r], std::fmin( t0, t1 ) );
+                        t_far[r] = std::min( t_far[r], std::fmax( t0, t1 ) );
+                    }
+                }
+                for( const auto r : Indices{ rays } )
+                {
+                    if( t_near[r] <= t_far[r] && !stopped_[rays[r]] )
+                    {
+                        hits.push_back( rays[r] );
+                    }
+                }
+            }
+
+        private:
+            std::array< std::vector< double >, dimension > origins_;
+            std::array< std::vector< double >, dimension > inverse_directions_;
+            std::vector< bool > stopped_;
+        };
+
+        template < typename ACTION >
+        void ray_packet_intersect_recursive( RayPacket& packet,
+            absl::Span< const index_t > rays,
+            index_t node_index,
+            index_t element_begin,
+            index_t element_end,
+            ACTION& action ) const
+        {
+            OpenGeodeGeometryException::check_assertion(
+                node_index < tree_.size(), "Node out of tree range" );
+            absl::InlinedVector< index_t, PACKET_SIZE > hits;
+            packet.hit_rays( node( node_index ), rays, hits );
+            if( hits.empty() )
+            {
+                return;
+            }
+            if( is_leaf( element_begin, element_end ) )
+            {
+                const auto element = mapping_morton( element_begin );
+                for( const auto ray_id : hits )
+                {
+                    if( action( ray_id, element ) )
+                    {
+                        packet.stop( ray_id );
+                    }
+                }
+                return;
+            }
+            const auto it = get_recursive_iterators(
+                node_index, element_begin, element_end );
+            ray_packet_intersect_recursive( packet, hits, it.child_left,
+                element_begin, it.element_middle, action );
+            ray_packet_intersect_recursive( packet, hits, it.child_right,
+                it.element_middle, element_end, action );
+        }
+
         [[nodiscard]] index_t closest_element_box_hint(
             const Point< dimension >& query ) const
         {
@@ -483,6 +640,17 @@ namespace geode
     template < typename EvalDistance >
     std::tuple< index_t, double > AABBTree< dimension >::closest_element_box(
         const Point< dimension >& query, const EvalDistance& action ) const
+    {
+        return closest_element_box(
+            query, action, std::numeric_limits< double >::lowest() );
+    }
+
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::tuple< index_t, double > AABBTree< dimension >::closest_element_box(
+        const Point< dimension >& query,
+        const EvalDistance& action,
+        double stop_distance ) const
     {
         if( nb_bboxes() == 0 )
         {
@@ -491,12 +659,35 @@ namespace geode
         auto nearest_box = impl_->closest_element_box_hint( query );
         auto distance = action( query, nearest_box );
         impl_->closest_element_box_recursive( query, nearest_box, distance,
-            Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+            Impl::ROOT_INDEX, 0, nb_bboxes(), stop_distance, action );
         OpenGeodeGeometryException::check_assertion(
             nearest_box != NO_ID, "No box found" );
         return { nearest_box, distance };
     }
 
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::vector< std::tuple< index_t, double > >
+        AABBTree< dimension >::closest_element_boxes(
+            absl::Span< const Point< dimension > > queries,
+            const EvalDistance& action ) const
+    {
+        std::vector< std::tuple< index_t, double > > result(
+            queries.size(), std::make_tuple( NO_ID, 0. ) );
+        if( nb_bboxes() == 0 )
+        {
+            return result;
+        }
+        const auto order = morton_mapping< dimension >( queries );
+        async::parallel_for( async::irange( size_t{ 0 }, order.size() ),
+            [this, &queries, &action, &order, &result]( size_t i ) {
+                const auto query_id = order[i];
+                result[query_id] =
+                    closest_element_box( queries[query_id], action );
+            } );
+        return result;
+    }
+
     template < index_t dimension >
     template < class EvalIntersection >
     void AABBTree< dimension >::compute_bbox_element_bbox_intersections(
@@ -546,6 +737,54 @@ namespace geode
         compute_generic_element_bbox_intersections( box_filter, action );
     }
 
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void AABBTree< dimension >::compute_ray_element_bbox_intersections(
+        absl::Span< const Ray< dimension > > rays,
+        EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        absl::FixedArray< Point< dimension > > origins( rays.size() );
+        for( const auto r : Indices{ rays } )
+        {
+            origins[r] = rays[r].origin();
+        }
+        const auto order = morton_mapping< dimension >( origins );
+        async::parallel_for( async::irange( size_t{ 0 }, order.size() ),
+            [this, &rays, &action, &order]( size_t i ) {
+                const auto ray_id = order[i];
+                const auto& ray = rays[ray_id];
+                const auto box_filter = [&ray]( const auto& box ) {
+                    return box.epsilon_intersects( ray );
+                };
+                auto ray_action = [&action, ray_id]( index_t element_box ) {
+                    return action( ray_id, element_box );
+                };
+                impl_->generic_intersect_recursive(
+                    box_filter, Impl::ROOT_INDEX, 0, nb_bboxes(), ray_action );
+            } );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void AABBTree< dimension >::compute_ray_packet_element_bbox_intersections(
+        absl::Span< const Ray< dimension > > rays,
+        EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 || rays.empty() )
+        {
+            return;
+        }
+        typename Impl::RayPacket packet{ rays };
+        absl::FixedArray< index_t > ray_ids( rays.size() );
+        absl::c_iota( ray_ids, 0 );
+        impl_->ray_packet_intersect_recursive(
+            packet, ray_ids, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+    }
+
     template < index_t dimension >
     template < class EvalIntersection >
     void AABBTree< dimension >::compute_line_element_bbox_intersections(
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/inlined_vector.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+namespace geode
+{
+    /*!
+     * Wide AABB tree structure implementation.
+     * Nodes are stored in depth-first order in a single vector, the root
+     * being the first one. Each node stores up to WIDTH children, a child
+     * being either another node or an input bbox (leaf):
+     *                                ROOT
+     *                     /      /          \        \
+     *                   A1     A2           B3        A4
+     *                 / | \ \    ...
+     *               B1 B2 ... ...
+     *  where B* are the input bboxes
+     *  Storage: |ROOT|A1|A2|A4|
+     * Children bounds are stored per coordinate (min[d][child],
+     * max[d][child]) so that tests on all children are simple loops over
+     * contiguous values which the compiler can vectorize.
+     */
+    template < index_t dimension >
+    class AABBTreeWide< dimension >::Impl
+    {
+    public:
+        static constexpr index_t ROOT_INDEX{ 0 };
+        static constexpr index_t PARALLEL_BUILD_THRESHOLD{ 4096 };
+        static constexpr index_t STACK_SIZE{ 64 };
+
+        struct alignas( 64 ) Node
+        {
+            std::array< std::array< double, WIDTH >, dimension > min;
+            std::array< std::array< double, WIDTH >, dimension > max;
+            std::array< index_t, WIDTH > children;
+            std::array< bool, WIDTH > is_leaf;
+            local_index_t nb_children{ 0 };
+        };
+
+        using ChildrenFlags = std::array< bool, WIDTH >;
+        using ChildrenValues = std::array< double, WIDTH >;
+
+    public:
+        Impl() = default;
+
+        explicit Impl( absl::Span< const BoundingBox< dimension > > bboxes );
+
+        [[nodiscard]] index_t nb_bboxes() const
+        {
+            return nb_bboxes_;
+        }
+
+        [[nodiscard]] const BoundingBox< dimension >& bounding_box() const
+        {
+            return bbox_;
+        }
+
+        [[nodiscard]] BoundingBox< dimension > child_box(
+            const Node& node, local_index_t child ) const
+        {
+            Point< dimension > min;
+            Point< dimension > max;
+            for( const auto d : LRange{ dimension } )
+            {
+                min.set_value( d, node.min[d][child] );
+                max.set_value( d, node.max[d][child] );
+            }
+            return { std::move( min ), std::move( max ) };
+        }
+
+        [[nodiscard]] static ChildrenFlags valid_children( const Node& node )
+        {
+            ChildrenFlags result;
+            for( const auto c : LRange{ WIDTH } )
+            {
+                result[c] = c < node.nb_children;
+            }
+            return result;
+        }
+
+        [[nodiscard]] static ChildrenFlags children_containing(
+            const Node& node, const Point< dimension >& query )
+        {
+            auto result = valid_children( node );
+            for( const auto d : LRange{ dimension } )
+            {
+                const auto value = query.value( d );
+                const auto& mins = node.min[d];
+                const auto& maxs = node.max[d];
+                for( const auto c : LRange{ WIDTH } )
+                {
+                    result[c] &= ( value >= mins[c] - GLOBAL_EPSILON )
+                                 & ( value <= maxs[c] + GLOBAL_EPSILON );
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] static ChildrenFlags children_intersecting(
+            const Node& node, const BoundingBox< dimension >& box )
+        {
+            auto result = valid_children( node );
+            for( const auto d : LRange{ dimension } )
+            {
+                const auto box_min = box.min().value( d ) - GLOBAL_EPSILON;
+                const auto box_max = box.max().value( d ) + GLOBAL_EPSILON;
+                const auto& mins = node.min[d];
+                const auto& maxs = node.max[d];
+                for( const auto c : LRange{ WIDTH } )
+                {
+                    result[c] &=
+                        ( maxs[c] >= box_min ) & ( mins[c] <= box_max );
+                }
+            }
+            return result;
+        }
+
+        /*!
+         * Slab test of the ray against the epsilon extension of all the
+         * children boxes.
+         */
+        [[nodiscard]] static ChildrenFlags children_intersecting(
+            const Node& node, const Ray< dimension >& ray )
+        {
+            auto result = valid_children( node );
+            ChildrenValues t_min;
+            t_min.fill( 0 );
+            ChildrenValues t_max;
+            t_max.fill( std::numeric_limits< double >::max() );
+            for( const auto d : LRange{ dimension } )
+            {
+                const auto origin = ray.origin().value( d );
+                const auto direction = ray.direction().value( d );
+                const auto& mins = node.min[d];
+                const auto& maxs = node.max[d];
+                if( direction == 0 )
+                {
+                    for( const auto c : LRange{ WIDTH } )
+                    {
+                        result[c] &= ( origin >= mins[c] - GLOBAL_EPSILON )
+                                     & ( origin <= maxs[c] + GLOBAL_EPSILON );
+                    }
+                    continue;
+                }
+                const auto inverse = 1. / direction;
+                for( const auto c : LRange{ WIDTH } )
+                {
+                    const auto t0 =
+                        ( mins[c] - GLOBAL_EPSILON - origin ) * inverse;
+                    const auto t1 =
+                        ( maxs[c] + GLOBAL_EPSILON - origin ) * inverse;
+                    t_min[c] = std::max( t_min[c], std::min( t0, t1 ) );
+                    t_max[c] = std::min( t_max[c], std::max( t0, t1 ) );
+                }
+            }
+            for( const auto c : LRange{ WIDTH } )
+            {
+                result[c] &= t_min[c] <= t_max[c];
+            }
+            return result;
+        }
+
+        /*!
+         * Distances between the query and all the children boxes, null if
+         * the query is inside the box and infinite for unused children.
+         */
+        [[nodiscard]] static ChildrenValues children_distances(
+            const Node& node, const Point< dimension >& query )
+        {
+            ChildrenValues result;
+            result.fill( 0 );
+            for( const auto d : LRange{ dimension } )
+            {
+                const auto value = query.value( d );
+                const auto& mins = node.min[d];
+                const auto& maxs = node.max[d];
+                for( const auto c : LRange{ WIDTH } )
+                {
+                    const auto outside = std::max(
+                        0., std::max( mins[c] - value, value - maxs[c] ) );
+                    result[c] += outside * outside;
+                }
+            }
+            for( const auto c : LRange{ WIDTH } )
+            {
+                result[c] = c < node.nb_children
+                                ? std::sqrt( result[c] )
+                                : std::numeric_limits< double >::max();
+            }
+            return result;
+        }
+
+        template < typename ACTION >
+        void closest_element_box( const Point< dimension >& query,
+            index_t& nearest_box,
+            double& distance,
+            const ACTION& action ) const
+        {
+            absl::InlinedVector< std::pair< index_t, double >, STACK_SIZE >
+                stack;
+            stack.emplace_back( ROOT_INDEX, 0. );
+            while( !stack.empty() )
+            {
+                const auto [node_id, node_distance] = stack.back();
+                stack.pop_back();
+                if( node_distance >= distance )
+                {
+                    continue;
+                }
+                const auto& node = nodes_[node_id];
+                const auto distances = children_distances( node, query );
+                std::array< local_index_t, WIDTH > order;
+                for( const auto c : LRange{ WIDTH } )
+                {
+                    order[c] = c;
+                }
+                std::sort( order.begin(), order.end(),
+                    [&distances]( local_index_t c0, local_index_t c1 ) {
+                        return distances[c0] < distances[c1];
+                    } );
+                // Evaluate the nearest leaves first to prune more nodes
+                for( const auto c : order )
+                {
+                    if( c >= node.nb_children || distances[c] >= distance )
+                    {
+                        break;
+                    }
+                    if( !node.is_leaf[c] )
+                    {
+                        continue;
+                    }
+                    const auto cur_distance =
+                        action( query, node.children[c] );
+                    if( cur_distance < distance )
+                    {
+                        nearest_box = node.children[c];
+                        distance = cur_distance;
+                    }
+                }
+                // Push the farthest nodes first to traverse the nearest ones
+                // first
+                for( auto c = order.rbegin(); c != order.rend(); ++c )
+                {
+                    if( *c >= node.nb_children || node.is_leaf[*c]
+                        || distances[*c] >= distance )
+                    {
+                        continue;
+                    }
+                    stack.emplace_back( node.children[*c], distances[*c] );
+                }
+            }
+        }
+
+        template < typename CHILDREN_FILTER, typename ACTION >
+        bool filtered_intersect( const CHILDREN_FILTER& children_filter,
+            ACTION& action ) const
+        {
+            absl::InlinedVector< index_t, STACK_SIZE > stack;
+            stack.push_back( ROOT_INDEX );
+            while( !stack.empty() )
+            {
+                const auto& node = nodes_[stack.back()];
+                stack.pop_back();
+                const auto intersecting = children_filter( node );
+                for( const auto c : LRange{ node.nb_children } )
+                {
+                    if( !intersecting[c] )
+                    {
+                        continue;
+                    }
+                    if( !node.is_leaf[c] )
+                    {
+                        stack.push_back( node.children[c] );
+                        continue;
+                    }
+                    if( action( node.children[c] ) )
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        void containing_boxes( const Point< dimension >& query,
+            std::vector< index_t >& result ) const
+        {
+            const auto children_filter = [&query]( const Node& node ) {
+                return children_containing( node, query );
+            };
+            auto action = [&result]( index_t box ) {
+                result.push_back( box );
+                return false;
+            };
+            filtered_intersect( children_filter, action );
+        }
+
+    private:
+        [[nodiscard]] BoundingBox< dimension > build_node(
+            absl::Span< const BoundingBox< dimension > > bboxes,
+            absl::Span< const index_t > mapping,
+            const absl::flat_hash_map< index_t, index_t >& nb_nodes,
+            index_t node_id,
+            index_t element_begin,
+            index_t element_end );
+
+    private:
+        index_t nb_bboxes_{ 0 };
+        BoundingBox< dimension > bbox_;
+        std::vector< Node > nodes_;
+    };
+
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::tuple< index_t, double >
+        AABBTreeWide< dimension >::closest_element_box(
+            const Point< dimension >& query, const EvalDistance& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return { NO_ID, 0 };
+        }
+        index_t nearest_box{ NO_ID };
+        auto distance = std::numeric_limits< double >::max();
+        impl_->closest_element_box( query, nearest_box, distance, action );
+        OpenGeodeGeometryException::check_assertion(
+            nearest_box != NO_ID, "No box found" );
+        return { nearest_box, distance };
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void AABBTreeWide< dimension >::compute_bbox_element_bbox_intersections(
+        const BoundingBox< dimension >& box, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        const auto children_filter = [&box]( const auto& node ) {
+            return Impl::children_intersecting( node, box );
+        };
+        impl_->filtered_intersect( children_filter, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void AABBTreeWide< dimension >::compute_ray_element_bbox_intersections(
+        const Ray< dimension >& ray, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        const auto children_filter = [&ray]( const auto& node ) {
+            return Impl::children_intersecting( node, ray );
+        };
+        impl_->filtered_intersect( children_filter, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalBox, class EvalIntersection >
+    void AABBTreeWide< dimension >::compute_generic_element_bbox_intersections(
+        const EvalBox& box_filter, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        const auto children_filter = [this, &box_filter]( const auto& node ) {
+            auto result = Impl::valid_children( node );
+            for( const auto c : LRange{ node.nb_children } )
+            {
+                result[c] = box_filter( impl_->child_box( node, c ) );
+            }
+            return result;
+        };
+        impl_->filtered_intersect( children_filter, action );
+    }
+} // namespace geode
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/mapping.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -94,6 +96,51 @@ namespace geode
             std::vector< index_t > colocated_input_points;
         };
 
+        /*!
+         * Results of a batch of neighbor queries stored in a compressed
+         * layout: the neighbors of query q are stored between offsets[q] and
+         * offsets[q + 1] in the neighbors and distances vectors.
+         * The same object can be given to successive batches to reuse its
+         * memory.
+         */
+        struct NeighborsBatch
+        {
+            [[nodiscard]] index_t nb_queries() const
+            {
+                return offsets.empty() ? 0 : offsets.size() - 1;
+            }
+
+            [[nodiscard]] absl::Span< const index_t > query_neighbors(
+                index_t query_id ) const
+            {
+                return absl::MakeConstSpan( neighbors ).subspan(
+                    offsets[query_id],
+                    offsets[query_id + 1] - offsets[query_id] );
+            }
+
+            [[nodiscard]] absl::Span< const double > query_distances(
+                index_t query_id ) const
+            {
+                return absl::MakeConstSpan( distances )
+                    .subspan( offsets[query_id],
+                        offsets[query_id + 1] - offsets[query_id] );
+            }
+
+            std::vector< index_t > offsets;
+            std::vector< index_t > neighbors;
+            /*!
+             * Distances between each query point and its neighbors
+             */
+            std::vector< double > distances;
+            /*!
+             * Per chunk buffers filled by radius queries before they are
+             * gathered in neighbors and distances, kept between batches to
+             * reuse their memory
+             */
+            std::vector< std::vector< index_t > > chunk_neighbors;
+            std::vector< std::vector< double > > chunk_distances;
+        };
+
     public:
         explicit NNSearch( std::vector< Point< dimension > > points );
         NNSearch( NNSearch&& other ) noexcept;
@@ -143,6 +190,32 @@ namespace geode
         [[nodiscard]] std::vector< index_t > neighbors(
             const Point< dimension >& point, index_t nb_neighbors ) const;
 
+        /*!
+         * Get the close neighbors of several points in parallel.
+         * Use nb_neighbors = 1 to get the closest neighbor of each point.
+         * @param[in] points The requested points
+         * @param[in] nb_neighbors The number of neighbors to return per
+         * point, it is bounded by the number of points in the tree
+         * @param[out] results The neighbors of each point sorted by
+         * increasing distance, previous content is overwritten
+         */
+        void neighbors( absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors,
+            NeighborsBatch& results ) const;
+
+        /*!
+         * Get the neighbors of several points in parallel within a
+         * distance.
+         * @param[in] points The requested points
+         * @param[in] threshold_distance The searching distance around each
+         * point
+         * @param[out] results The neighbors of each point sorted by
+         * increasing distance, previous content is overwritten
+         */
+        void radius_neighbors( absl::Span< const Point< dimension > > points,
+            double threshold_distance,
+            NeighborsBatch& results ) const;
+
         /*!
          * Compute a colocation mapping from the list of points
          * @param[in] epsilon The approximation allowed to test if two points
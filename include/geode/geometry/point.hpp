@@ -28,6 +28,7 @@
 #include <absl/hash/hash.h>
 
 #include <geode/basic/attribute_utils.hpp>
+#include <geode/basic/detail/bitsery_raw_values.hpp>
 #include <geode/basic/range.hpp>
 
 #include <geode/geometry/common.hpp>
@@ -98,6 +99,17 @@ namespace geode
     };
     ALIAS_1D_AND_2D_AND_3D( Point );
 
+    namespace detail
+    {
+        template < index_t dimension >
+        struct RawSerializable< Point< dimension > > : std::true_type
+        {
+            using Scalar = double;
+            static_assert( sizeof( Point< dimension > )
+                           == dimension * sizeof( double ) );
+        };
+    } // namespace detail
+
     template < index_t dimension >
     struct AttributeLinearInterpolationImpl< Point< dimension > >
     {
@@ -27,6 +27,8 @@
 #include <string>
 #include <vector>
 
+#include <geode/basic/zip_file.hpp>
+
 #include <geode/image/core/bitsery_archive.hpp>
 #include <geode/image/io/raster_image_output.hpp>
 
@@ -44,12 +46,11 @@ namespace geode
         std::vector< std::string > write(
             const RasterImage< dimension >& mesh ) const final
         {
-            std::ofstream file{ to_string( this->filename() ),
-                std::ofstream::binary };
+            const auto file = open_output_file( this->filename() );
             TContext context{};
             BitseryExtensions::register_serialize_pcontext(
                 std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, *file };
             archive.object( mesh );
             archive.adapter().flush();
             OpenGeodeImageException::check_exception(
@@ -57,6 +58,7 @@ namespace geode
                 OpenGeodeException::TYPE::internal,
                 "[Bitsery::write] Error while writing file: ",
                 this->filename() );
+            file->close();
             return { to_string( this->filename() ) };
         }
     };
@@ -50,9 +50,9 @@ namespace geode
 
     public:
         PASSKEY( VertexSet, VertexSetKey /*key*/ );
-        VertexSetBuilder( VertexSetBuilder&& ) noexcept = default;
+        VertexSetBuilder( VertexSetBuilder&& other ) noexcept;
 
-        virtual ~VertexSetBuilder() = default;
+        virtual ~VertexSetBuilder();
 
         /*!
          * Create the builder associated with a VertexSet.
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/mesh/common.hpp>
@@ -67,6 +69,12 @@ namespace geode
 
         [[nodiscard]] index_t nb_points() const;
 
+        /*!
+         * Get a view on all the points
+         * @warning The view is invalidated when the number of points changes
+         */
+        [[nodiscard]] absl::Span< const Point< dimension > > points() const;
+
         [[nodiscard]] uuid attribute_id() const;
 
     protected:
@@ -79,4 +87,4 @@ namespace geode
         IMPLEMENTATION_MEMBER( impl_ );
     };
     ALIAS_1D_AND_2D_AND_3D( AttributeCoordinateReferenceSystem );
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
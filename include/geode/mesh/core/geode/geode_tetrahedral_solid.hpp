@@ -25,6 +25,8 @@
 
 #include <array>
 
+#include <absl/types/span.h>
+
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
@@ -86,6 +88,14 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Get a view on the vertices of all the tetrahedra
+         * @warning The view is invalidated when the number of tetrahedra
+         * changes
+         */
+        [[nodiscard]] absl::Span< const std::array< index_t, 4 > >
+            tetrahedra_vertices() const;
+
     public:
         void set_polyhedron_vertex( const PolyhedronVertex& polyhedron_vertex,
             index_t vertex_id,
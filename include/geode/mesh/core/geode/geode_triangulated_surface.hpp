@@ -25,6 +25,8 @@
 
 #include <array>
 
+#include <absl/types/span.h>
+
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
@@ -87,6 +89,14 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Get a view on the vertices of all the triangles
+         * @warning The view is invalidated when the number of triangles
+         * changes
+         */
+        [[nodiscard]] absl::Span< const std::array< index_t, 3 > >
+            triangles_vertices() const;
+
     public:
         void set_polygon_vertex( const PolygonVertex& polygon_vertex,
             index_t vertex_id,
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/types/span.h>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Compressed storage of the elements around each vertex of a mesh
+         * and of their border flag, filled in parallel by chunks of vertices.
+         * It is an alternative to the per-vertex cached values of the mesh
+         * for meshes which are only queried.
+         */
+        template < typename ElementVertex >
+        class ElementsAroundVertexIndex
+        {
+        public:
+            /*!
+             * @param[in] compute Function appending the elements around the
+             * given vertex to the given vector and returning true if the
+             * vertex is on the border.
+             */
+            template < typename Compute >
+            ElementsAroundVertexIndex(
+                index_t nb_vertices, const Compute& compute )
+            {
+                static constexpr index_t MIN_CHUNK_SIZE{ 4096 };
+                const auto nb_chunks = std::max< index_t >(
+                    std::min< index_t >(
+                        4 * std::max( std::thread::hardware_concurrency(), 1u ),
+                        nb_vertices / MIN_CHUNK_SIZE ),
+                    1 );
+                std::vector< index_t > bounds( nb_chunks + 1 );
+                for( const auto c : Range{ nb_chunks + 1 } )
+                {
+                    bounds[c] = static_cast< index_t >(
+                        std::uint64_t{ nb_vertices } * c / nb_chunks );
+                }
+                offsets_.assign( nb_vertices + 1, 0 );
+                on_border_.assign( nb_vertices, 0 );
+                std::vector< std::vector< ElementVertex > > chunk_elements(
+                    nb_chunks );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                    [&]( index_t c ) {
+                        auto& elements = chunk_elements[c];
+                        for( const auto v : Range{ bounds[c], bounds[c + 1] } )
+                        {
+                            const auto nb_before = elements.size();
+                            on_border_[v] = compute( v, elements );
+                            offsets_[v + 1] = static_cast< index_t >(
+                                elements.size() - nb_before );
+                        }
+                    } );
+                for( const auto v : Range{ nb_vertices } )
+                {
+                    offsets_[v + 1] += offsets_[v];
+                }
+                elements_.resize( offsets_.back() );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                    [&]( index_t c ) {
+                        absl::c_copy( chunk_elements[c],
+                            elements_.begin() + offsets_[bounds[c]] );
+                        chunk_elements[c] = {};
+                    } );
+            }
+
+            [[nodiscard]] index_t nb_vertices() const
+            {
+                return static_cast< index_t >( on_border_.size() );
+            }
+
+            [[nodiscard]] absl::Span< const ElementVertex > elements_around(
+                index_t vertex_id ) const
+            {
+                return absl::MakeConstSpan( elements_ ).subspan(
+                    offsets_[vertex_id],
+                    offsets_[vertex_id + 1] - offsets_[vertex_id] );
+            }
+
+            [[nodiscard]] bool is_on_border( index_t vertex_id ) const
+            {
+                return on_border_[vertex_id] != 0;
+            }
+
+            /*!
+             * Return true if the stored elements around the vertex match
+             * the given first element, i.e. contain it or are empty when
+             * there is none.
+             */
+            [[nodiscard]] bool matches( index_t vertex_id,
+                const std::optional< ElementVertex >& first_element ) const
+            {
+                if( vertex_id >= nb_vertices() )
+                {
+                    return false;
+                }
+                const auto elements = elements_around( vertex_id );
+                if( !first_element )
+                {
+                    return elements.empty();
+                }
+                return absl::c_contains( elements, first_element.value() );
+            }
+
+        private:
+            std::vector< index_t > offsets_;
+            std::vector< ElementVertex > elements_;
+            std::vector< std::uint8_t > on_border_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -94,6 +94,11 @@ namespace geode
                 return points_->size();
             }
 
+            [[nodiscard]] absl::Span< const Point< dimension > > points() const
+            {
+                return points_->values();
+            }
+
             [[nodiscard]] std::string_view attribute_name() const
             {
                 return points_->name().value();
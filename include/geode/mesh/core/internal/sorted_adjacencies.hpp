@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/types/span.h>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Number of elements to connect above which adjacencies are computed
+         * by sorting element sides instead of hashing them.
+         */
+        static constexpr index_t SORTED_ADJACENCY_THRESHOLD{ 4096 };
+
+        /*!
+         * Side (edge or facet) of an element identified by a normalized
+         * vertex key. Two sides sharing the same key are adjacent.
+         */
+        template < typename Key >
+        struct SideRecord
+        {
+            [[nodiscard]] bool operator<( const SideRecord& other ) const
+            {
+                return std::tie( key, element, side )
+                       < std::tie( other.key, other.element, other.side );
+            }
+
+            Key key;
+            index_t element;
+            local_index_t side;
+        };
+
+        /*!
+         * Sort the given values by sorting contiguous chunks in parallel
+         * and then merging them pairwise in parallel rounds.
+         */
+        template < typename T >
+        void parallel_sort( std::vector< T >& values )
+        {
+            static constexpr index_t MIN_CHUNK_SIZE{ 16384 };
+            const auto nb_values = values.size();
+            const auto nb_chunks = std::min< size_t >(
+                std::max( std::thread::hardware_concurrency(), 1u ),
+                nb_values / MIN_CHUNK_SIZE );
+            if( nb_chunks < 2 )
+            {
+                absl::c_sort( values );
+                return;
+            }
+            std::vector< size_t > bounds( nb_chunks + 1 );
+            for( const auto c : Range{ nb_chunks + 1 } )
+            {
+                bounds[c] = nb_values * c / nb_chunks;
+            }
+            const auto begin = values.begin();
+            async::parallel_for(
+                async::irange( size_t{ 0 }, nb_chunks ), [&]( size_t c ) {
+                    std::sort( begin + bounds[c], begin + bounds[c + 1] );
+                } );
+            for( size_t width = 1; width < nb_chunks; width *= 2 )
+            {
+                const auto nb_merges = ( nb_chunks + 2 * width - 1 )
+                                       / ( 2 * width );
+                async::parallel_for( async::irange( size_t{ 0 }, nb_merges ),
+                    [&]( size_t m ) {
+                        const auto first = 2 * width * m;
+                        const auto middle =
+                            std::min( first + width, nb_chunks );
+                        const auto last =
+                            std::min( first + 2 * width, nb_chunks );
+                        if( middle < last )
+                        {
+                            std::inplace_merge( begin + bounds[first],
+                                begin + bounds[middle], begin + bounds[last] );
+                        }
+                    } );
+            }
+        }
+
+        /*!
+         * Compute the side records of the given elements in parallel, sort
+         * them and call the action on each group of at least two records
+         * sharing the same key, in increasing key order. Records of a group
+         * are sorted by element and side.
+         * @param[in] nb_sides Function returning the maximum number of
+         * records of an element.
+         * @param[in] fill_sides Function writing the records of an element
+         * in the given span and returning the number of records written.
+         */
+        template < typename Key,
+            typename NbSides,
+            typename FillSides,
+            typename Action >
+        void pair_sorted_sides( absl::Span< const index_t > elements,
+            const NbSides& nb_sides,
+            const FillSides& fill_sides,
+            const Action& action )
+        {
+            std::vector< index_t > offsets( elements.size() + 1, 0 );
+            async::parallel_for(
+                async::irange( size_t{ 0 }, elements.size() ), [&]( size_t e ) {
+                    offsets[e + 1] = nb_sides( elements[e] );
+                } );
+            for( const auto e : Range{ elements.size() } )
+            {
+                offsets[e + 1] += offsets[e];
+            }
+            std::vector< SideRecord< Key > > records( offsets.back() );
+            std::vector< index_t > nb_filled( elements.size() );
+            async::parallel_for(
+                async::irange( size_t{ 0 }, elements.size() ), [&]( size_t e ) {
+                    nb_filled[e] = fill_sides( elements[e],
+                        absl::MakeSpan( records.data() + offsets[e],
+                            offsets[e + 1] - offsets[e] ) );
+                } );
+            index_t nb_records{ 0 };
+            for( const auto e : Range{ elements.size() } )
+            {
+                for( const auto r : Range{ nb_filled[e] } )
+                {
+                    records[nb_records++] = records[offsets[e] + r];
+                }
+            }
+            records.resize( nb_records );
+            parallel_sort( records );
+            for( index_t begin = 0; begin < records.size(); )
+            {
+                auto end = begin + 1;
+                while( end < records.size()
+                       && records[end].key == records[begin].key )
+                {
+                    end++;
+                }
+                if( end - begin > 1 )
+                {
+                    action( absl::MakeConstSpan(
+                        records.data() + begin, end - begin ) );
+                }
+                begin = end;
+            }
+        }
+    } // namespace internal
+} // namespace geode
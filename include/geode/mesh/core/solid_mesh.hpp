@@ -28,6 +28,7 @@
 
 #include <absl/container/inlined_vector.h>
 #include <absl/hash/hash.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/passkey.hpp>
@@ -508,18 +509,31 @@ namespace geode
          * Get all the polyhedra with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
          * @pre This function needs that polyhedron adjacencies are computed
+         * @warning The returned view is invalidated by any mesh modification
          */
-        [[nodiscard]] const PolyhedraAroundVertex& polyhedra_around_vertex(
-            index_t vertex_id ) const;
+        [[nodiscard]] absl::Span< const PolyhedronVertex >
+            polyhedra_around_vertex( index_t vertex_id ) const;
 
         /*!
          * Get all the polyhedra with one of the vertices matching given
          * polyhedron vertex.
          * @param[in] polyhedron_vertex Local index of vertex in polyhedron.
          * @pre This function needs that polyhedron adjacencies are computed
+         * @warning The returned view is invalidated by any mesh modification
          */
-        [[nodiscard]] const PolyhedraAroundVertex& polyhedra_around_vertex(
-            const PolyhedronVertex& polyhedron_vertex ) const;
+        [[nodiscard]] absl::Span< const PolyhedronVertex >
+            polyhedra_around_vertex(
+                const PolyhedronVertex& polyhedron_vertex ) const;
+
+        /*!
+         * Compute in parallel the polyhedra around all the vertices and store
+         * them in a compressed index read by polyhedra_around_vertex and
+         * is_vertex_on_border, instead of the per-vertex cache.
+         * The index is dropped by the next modification of the polyhedra.
+         * @pre This function needs that polyhedron adjacencies are computed
+         * @warning Not thread-safe with the other queries of the mesh
+         */
+        void build_polyhedra_around_vertices() const;
 
         /*!
          * Return true if at least one of the polyhedron facets around the
@@ -722,4 +736,4 @@ namespace std
         size_t operator()(
             const geode::PolyhedronFacetEdge& polyhedron_facet_edge ) const;
     };
-} // namespace std
\ No newline at end of file
+} // namespace std
\ No newline at end of file
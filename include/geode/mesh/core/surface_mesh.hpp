@@ -27,6 +27,7 @@
 
 #include <absl/container/inlined_vector.h>
 #include <absl/hash/hash.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/passkey.hpp>
@@ -400,18 +401,30 @@ namespace geode
          * Get all the polygons with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
          * @pre This function needs that polygon adjacencies are computed
+         * @warning The returned view is invalidated by any mesh modification
          */
-        [[nodiscard]] const PolygonsAroundVertex& polygons_around_vertex(
+        [[nodiscard]] absl::Span< const PolygonVertex > polygons_around_vertex(
             index_t vertex_id ) const;
 
         /*!
          * Get all the polygons with one of the vertices matching given vertex.
          * @param[in] polygon_vertex Local index of vertex in polygon.
          * @pre This function needs that polygon adjacencies are computed
+         * @warning The returned view is invalidated by any mesh modification
          */
-        [[nodiscard]] const PolygonsAroundVertex& polygons_around_vertex(
+        [[nodiscard]] absl::Span< const PolygonVertex > polygons_around_vertex(
             const PolygonVertex& vertex ) const;
 
+        /*!
+         * Compute in parallel the polygons around all the vertices and store
+         * them in a compressed index read by polygons_around_vertex and
+         * is_vertex_on_border, instead of the per-vertex cache.
+         * The index is dropped by the next modification of the polygons.
+         * @pre This function needs that polygon adjacencies are computed
+         * @warning Not thread-safe with the other queries of the mesh
+         */
+        void build_polygons_around_vertices() const;
+
         /*!
          * Find the polygon edge corresponding to an ordered pair of vertex
          * indices.
@@ -518,4 +531,4 @@ namespace std
     {
         size_t operator()( const geode::PolygonEdge& polygon_edge ) const;
     };
-} // namespace std
\ No newline at end of file
+} // namespace std
\ No newline at end of file
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <geode/basic/identifier.hpp>
+#include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/mesh/common.hpp>
@@ -47,6 +48,7 @@ namespace geode
 
     public:
         using Builder = VertexSetBuilder;
+        PASSKEY( VertexSetBuilder, VertexSetBuilderKey );
 
         virtual ~VertexSet();
 
@@ -76,10 +78,29 @@ namespace geode
          */
         [[nodiscard]] AttributeManager& vertex_attribute_manager() const;
 
+        /*!
+         * Return true if a builder of this mesh exists, the mesh may then be
+         * modified at any time.
+         */
+        [[nodiscard]] bool has_alive_builders() const;
+
+        /*!
+         * Get a counter incremented each time a builder of this mesh is
+         * created or destroyed. Since a mesh is modified through a builder,
+         * the mesh is unchanged as long as this counter stays the same and no
+         * builder is alive.
+         */
+        [[nodiscard]] index_t builder_generation() const;
+
         [[nodiscard]] virtual MeshImpl impl_name() const = 0;
 
         [[nodiscard]] virtual MeshType type_name() const = 0;
 
+    public:
+        void register_builder( VertexSetBuilderKey /*key*/ );
+
+        void unregister_builder( VertexSetBuilderKey /*key*/ );
+
     protected:
         VertexSet();
         VertexSet( VertexSet&& other ) noexcept;
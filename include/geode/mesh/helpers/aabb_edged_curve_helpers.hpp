@@ -35,6 +35,7 @@ namespace geode
 {
     FORWARD_DECLARATION_DIMENSION_CLASS( Point );
     FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTreeWide );
     FORWARD_DECLARATION_DIMENSION_CLASS( EdgedCurve );
     FORWARD_DECLARATION_DIMENSION_CLASS( CoordinateSystem );
     ALIAS_2D_AND_3D( CoordinateSystem );
@@ -48,6 +49,15 @@ namespace geode
     [[nodiscard]] AABBTree< dimension > create_aabb_tree(
         const EdgedCurve< dimension >& mesh );
 
+    /*!
+     * Builds a wide AABB tree on the mesh edges. It can be used with the same
+     * actions as the tree given by create_aabb_tree (e.g. DistanceToEdge or
+     * RayTracing2D) and is faster to query on large meshes.
+     */
+    template < index_t dimension >
+    [[nodiscard]] AABBTreeWide< dimension > create_aabb_tree_wide(
+        const EdgedCurve< dimension >& mesh );
+
     template < index_t dimension >
     class DistanceToEdge
     {
@@ -29,6 +29,7 @@ namespace geode
 {
     FORWARD_DECLARATION_DIMENSION_CLASS( Point );
     FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTreeWide );
     FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
     FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
     FORWARD_DECLARATION_DIMENSION_CLASS( CoordinateSystem );
@@ -43,6 +44,15 @@ namespace geode
     [[nodiscard]] AABBTree< dimension > create_aabb_tree(
         const SolidMesh< dimension >& mesh );
 
+    /*!
+     * Builds a wide AABB tree on the mesh polyhedra. It can be used with the
+     * same actions as the tree given by create_aabb_tree (e.g.
+     * DistanceToTetrahedron) and is faster to query on large meshes.
+     */
+    template < index_t dimension >
+    [[nodiscard]] AABBTreeWide< dimension > create_aabb_tree_wide(
+        const SolidMesh< dimension >& mesh );
+
     template < index_t dimension >
     class DistanceToTetrahedron
     {
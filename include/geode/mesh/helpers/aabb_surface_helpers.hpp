@@ -35,6 +35,7 @@ namespace geode
 {
     FORWARD_DECLARATION_DIMENSION_CLASS( Point );
     FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTreeWide );
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
     FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
     FORWARD_DECLARATION_DIMENSION_CLASS( CoordinateSystem );
@@ -49,6 +50,16 @@ namespace geode
     [[nodiscard]] AABBTree< dimension > create_aabb_tree(
         const SurfaceMesh< dimension >& mesh );
 
+    /*!
+     * Builds a wide AABB tree on the mesh polygons. It can be used with the
+     * same actions as the tree given by create_aabb_tree (e.g.
+     * DistanceToTriangle or RayTracing3D) and is faster to query on large
+     * meshes.
+     */
+    template < index_t dimension >
+    [[nodiscard]] AABBTreeWide< dimension > create_aabb_tree_wide(
+        const SurfaceMesh< dimension >& mesh );
+
     template < index_t dimension >
     class DistanceToTriangle
     {
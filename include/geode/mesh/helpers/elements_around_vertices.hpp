@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+namespace geode
+{
+    /*!
+     * Read-only compressed index of the polygons around each vertex of a
+     * SurfaceMesh, computed in parallel in one pass over the polygons.
+     * Contrary to SurfaceMesh::polygons_around_vertex, it does not need
+     * polygon adjacencies nor per-vertex caches, and contains all the
+     * polygons incident to a vertex sorted by polygon index.
+     * @warning The index is not updated when the mesh is modified.
+     */
+    template < index_t dimension >
+    class PolygonsAroundVertices
+    {
+    public:
+        explicit PolygonsAroundVertices( const SurfaceMesh< dimension >& mesh );
+
+        [[nodiscard]] index_t nb_vertices() const;
+
+        [[nodiscard]] absl::Span< const PolygonVertex > polygons_around_vertex(
+            index_t vertex_id ) const;
+
+    private:
+        std::vector< index_t > offsets_;
+        std::vector< PolygonVertex > polygon_vertices_;
+    };
+    ALIAS_2D_AND_3D( PolygonsAroundVertices );
+
+    /*!
+     * Read-only compressed index of the polyhedra around each vertex of a
+     * SolidMesh, computed in parallel in one pass over the polyhedra.
+     * Contrary to SolidMesh::polyhedra_around_vertex, it does not need
+     * polyhedron adjacencies nor per-vertex caches, and contains all the
+     * polyhedra incident to a vertex sorted by polyhedron index.
+     * @warning The index is not updated when the mesh is modified.
+     */
+    template < index_t dimension >
+    class PolyhedraAroundVertices
+    {
+    public:
+        explicit PolyhedraAroundVertices( const SolidMesh< dimension >& mesh );
+
+        [[nodiscard]] index_t nb_vertices() const;
+
+        [[nodiscard]] absl::Span< const PolyhedronVertex >
+            polyhedra_around_vertex( index_t vertex_id ) const;
+
+    private:
+        std::vector< index_t > offsets_;
+        std::vector< PolyhedronVertex > polyhedron_vertices_;
+    };
+    ALIAS_3D( PolyhedraAroundVertices );
+} // namespace geode
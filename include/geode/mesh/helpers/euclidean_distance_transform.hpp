@@ -59,4 +59,31 @@ namespace geode
             absl::Span< const typename Grid< dimension >::CellIndices >
                 grid_cell_ids,
             std::string_view distance_map_name );
+
+    /*!
+     * Compute the exact euclidean distance map from rasterized objects, only
+     * up to a maximal distance.
+     * Computations are restricted to the cells around the objects, cells
+     * farther than \param max_distance from every object are set to the
+     * maximal value of T.
+     *
+     * @tparam T Type of the stored distances (e.g. float to halve memory).
+     * @param[in] grid Regular grid on which the euclidean distance map is
+     * computed.
+     * @param[in] grid_cell_ids Rasterization of every objects from which the
+     * distance will be computed.
+     * @param[in] distance_map_name Name of the attribute to store the map on
+     * the \param grid.
+     * @param[in] max_distance Distance beyond which no value is computed.
+     * @exception OpenGeodeException if the attribute named \param
+     * distance_map_name cannot be accessed.
+     * @return the created attribute
+     */
+    template < typename T, index_t dimension >
+    [[nodiscard]] std::shared_ptr< VariableAttribute< T > >
+        euclidean_distance_transform( const Grid< dimension >& grid,
+            absl::Span< const typename Grid< dimension >::CellIndices >
+                grid_cell_ids,
+            std::string_view distance_map_name,
+            double max_distance );
 } // namespace geode
\ No newline at end of file
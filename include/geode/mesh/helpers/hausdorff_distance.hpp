@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <geode/mesh/common.hpp>
 
 namespace geode
@@ -33,7 +35,54 @@ namespace geode
 
 namespace geode
 {
+    /*!
+     * Both one-sided Hausdorff distances between two surfaces A and B
+     */
+    struct HausdorffDistances
+    {
+        [[nodiscard]] double value() const
+        {
+            return std::max( A_to_B, B_to_A );
+        }
+
+        /*!
+         * Maximal distance from a sample of A to surface B
+         */
+        double A_to_B{ 0 };
+        /*!
+         * Maximal distance from a sample of B to surface A
+         */
+        double B_to_A{ 0 };
+    };
+
+    /*!
+     * Computes the Hausdorff distance between two surfaces using their
+     * vertices as samples.
+     */
     [[nodiscard]] double opengeode_mesh_api hausdorff_distance(
         const TriangulatedSurface3D& mesh_A,
         const TriangulatedSurface3D& mesh_B );
+
+    /*!
+     * Computes the one-sided Hausdorff distance from surface A to surface B,
+     * i.e. the maximal distance from a sample of A to B.
+     * @param[in] sampling_distance Maximal spacing between samples inside the
+     * triangles of A. If zero, only the vertices of A are sampled.
+     * @note Samples are processed in parallel and each closest triangle search
+     * stops as soon as it cannot increase the current maximal distance.
+     */
+    [[nodiscard]] double opengeode_mesh_api one_sided_hausdorff_distance(
+        const TriangulatedSurface3D& mesh_A,
+        const TriangulatedSurface3D& mesh_B,
+        double sampling_distance );
+
+    /*!
+     * Computes both one-sided Hausdorff distances between two surfaces.
+     * @param[in] sampling_distance Maximal spacing between samples inside the
+     * triangles. If zero, only the vertices are sampled.
+     */
+    [[nodiscard]] HausdorffDistances opengeode_mesh_api hausdorff_distances(
+        const TriangulatedSurface3D& mesh_A,
+        const TriangulatedSurface3D& mesh_B,
+        double sampling_distance );
 } // namespace geode
@@ -24,6 +24,9 @@
 #pragma once
 
 #include <optional>
+#include <vector>
+
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.hpp>
 
@@ -39,9 +42,13 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( EdgedCurve );
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
     FORWARD_DECLARATION_DIMENSION_CLASS( BoundingBox );
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTreeWide );
     ALIAS_2D( EdgedCurve );
     ALIAS_3D( SurfaceMesh );
     ALIAS_2D_AND_3D( BoundingBox );
+    ALIAS_2D_AND_3D( AABBTree );
+    ALIAS_2D_AND_3D( AABBTreeWide );
 } // namespace geode
 
 namespace geode
@@ -98,6 +105,26 @@ namespace geode
 
         [[nodiscard]] std::vector< EdgeDistance > all_intersections() const;
 
+        /*!
+         * Compute all the intersections of each ray of a packet with the
+         * mesh, traversing its AABB tree once for the whole packet.
+         * @return The intersections of each ray, in the same order as \p rays
+         */
+        [[nodiscard]] static std::vector< std::vector< EdgeDistance > >
+            packet_intersections( const EdgedCurve2D& mesh,
+                const AABBTree2D& aabb,
+                absl::Span< const Ray2D > rays );
+
+        /*!
+         * Same as above using a wide AABB tree (see create_aabb_tree_wide).
+         * Each ray traverses the tree on its own, rays are processed in
+         * parallel.
+         */
+        [[nodiscard]] static std::vector< std::vector< EdgeDistance > >
+            packet_intersections( const EdgedCurve2D& mesh,
+                const AABBTreeWide2D& aabb,
+                absl::Span< const Ray2D > rays );
+
         [[nodiscard]] bool operator()( index_t edge_id );
 
     private:
@@ -156,6 +183,26 @@ namespace geode
 
         [[nodiscard]] std::vector< PolygonDistance > all_intersections() const;
 
+        /*!
+         * Compute all the intersections of each ray of a packet with the
+         * mesh, traversing its AABB tree once for the whole packet.
+         * @return The intersections of each ray, in the same order as \p rays
+         */
+        [[nodiscard]] static std::vector< std::vector< PolygonDistance > >
+            packet_intersections( const SurfaceMesh3D& mesh,
+                const AABBTree3D& aabb,
+                absl::Span< const Ray3D > rays );
+
+        /*!
+         * Same as above using a wide AABB tree (see create_aabb_tree_wide).
+         * Each ray traverses the tree on its own, rays are processed in
+         * parallel.
+         */
+        [[nodiscard]] static std::vector< std::vector< PolygonDistance > >
+            packet_intersections( const SurfaceMesh3D& mesh,
+                const AABBTreeWide3D& aabb,
+                absl::Span< const Ray3D > rays );
+
         [[nodiscard]] bool operator()( index_t polygon_id );
 
     private:
@@ -23,7 +23,12 @@
 
 #pragma once
 
-#include <fstream>
+#include <istream>
+#include <sstream>
+
+#include <geode/basic/compression.hpp>
+#include <geode/basic/mapped_file.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/bitsery_archive.hpp>
 
@@ -35,16 +40,52 @@
     [[nodiscard]] std::unique_ptr< Mesh > read( const MeshImpl& /*impl*/ )     \
         final                                                                  \
     {                                                                          \
-        std::ifstream file{ to_string( this->filename() ),                     \
-            std::ifstream::binary };                                           \
-        geode::OpenGeodeMeshException::check_exception( !file.fail(), nullptr, \
-            geode::OpenGeodeException::TYPE::data,                             \
+        if( geode::is_native_mapping_enabled() )                               \
+        {                                                                      \
+            auto mapped_file = geode::map_input_file( this->filename() );      \
+            if( mapped_file                                                    \
+                && !geode::is_compressed_buffer( mapped_file->content() ) )    \
+            {                                                                  \
+                geode::MappedFileBuffer buffer{ std::move( mapped_file ) };    \
+                std::istream stream{ &buffer };                                \
+                return read_archive( stream, this->filename(), &buffer );      \
+            }                                                                  \
+        }                                                                      \
+        const auto file = geode::open_input_file( this->filename() );          \
+        geode::OpenGeodeMeshException::check_exception( !file->fail(),         \
+            nullptr, geode::OpenGeodeException::TYPE::data,                    \
             "[Bitsery::read] Failed to open file: ",                           \
             to_string( this->filename() ) );                                   \
+        return read_stream( *file, this->filename() );                         \
+    }                                                                          \
+                                                                               \
+    /*!                                                                        \
+     * Reads a mesh in native format from any binary stream                    \
+     * @param[in] name Name of the stream used in error messages               \
+     */                                                                        \
+    [[nodiscard]] static std::unique_ptr< Mesh > read_stream(                  \
+        std::istream& stream, std::string_view name )                          \
+    {                                                                          \
+        auto decompressed = geode::read_compressed_stream( stream );           \
+        if( !decompressed )                                                    \
+        {                                                                      \
+            return read_archive( stream, name, nullptr );                      \
+        }                                                                      \
+        std::istringstream buffer{ std::move( *decompressed ) };               \
+        return read_archive( buffer, name, nullptr );                          \
+    }                                                                          \
+                                                                               \
+    [[nodiscard]] static std::unique_ptr< Mesh > read_archive(                 \
+        std::istream& stream,                                                  \
+        std::string_view name,                                                 \
+        geode::MappedFileBuffer* mapped_file )                                 \
+    {                                                                          \
         TContext context{};                                                    \
         BitseryExtensions::register_deserialize_pcontext(                      \
             std::get< 0 >( context ) );                                        \
-        Deserializer archive{ context, file };                                 \
+        std::get< geode::detail::RawValuesContext >( context ).input =         \
+            mapped_file;                                                       \
+        Deserializer archive{ context, stream };                               \
         std::unique_ptr< Mesh > mesh{ new OpenGeode##Mesh{                     \
             BITSERY::constructor } };                                          \
         archive.object( dynamic_cast< OpenGeode##Mesh& >( *mesh ) );           \
@@ -54,7 +95,7 @@
                 && adapter.isCompletedSuccessfully()                           \
                 && std::get< 1 >( context ).isValid(),                         \
             nullptr, geode::OpenGeodeException::TYPE::internal,                \
-            "[Bitsery::read] Error while reading file: ", this->filename() );  \
+            "[Bitsery::read] Error while reading file: ", name );              \
         return mesh;                                                           \
     }                                                                          \
                                                                                \
@@ -103,3 +144,17 @@
                                                                                \
         BITSERY_READ( Mesh )                                                   \
     }
+
+namespace geode
+{
+    /*!
+     * Loads a mesh in native format from a memory buffer, e.g.
+     * load_mesh_from_buffer< OpenGeodeTriangulatedSurfaceInput3D >( buffer )
+     */
+    template < typename NativeMeshInput >
+    [[nodiscard]] auto load_mesh_from_buffer( std::string_view buffer )
+    {
+        std::istringstream stream{ to_string( buffer ) };
+        return NativeMeshInput::read_stream( stream, "buffer" );
+    }
+} // namespace geode
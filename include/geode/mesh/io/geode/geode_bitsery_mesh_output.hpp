@@ -23,7 +23,12 @@
 
 #pragma once
 
-#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include <geode/basic/compression.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/bitsery_archive.hpp>
 
@@ -38,25 +43,45 @@
     }                                                                          \
                                                                                \
     std::vector< std::string > write( const Mesh& mesh ) const final           \
+    {                                                                          \
+        const auto file = geode::open_output_file( this->filename() );         \
+        write_stream( mesh, *file, this->filename() );                         \
+        file->close();                                                         \
+        return { to_string( this->filename() ) };                              \
+    }                                                                          \
+                                                                               \
+    /*!                                                                        \
+     * Writes a mesh in native format into any binary stream                   \
+     * @param[in] name Name of the stream used in error messages               \
+     */                                                                        \
+    static void write_stream(                                                  \
+        const Mesh& mesh, std::ostream& stream, std::string_view name )        \
     {                                                                          \
         geode::OpenGeodeMeshException::check_exception(                        \
             mesh.impl_name() == OpenGeode##Mesh::impl_name_static(), nullptr,  \
             geode::OpenGeodeException::TYPE::data, "[Bitsery] Cannot save ",   \
             mesh.type_name().get(), " in native format because it is not ",    \
             OpenGeode##Mesh::impl_name_static().get() );                       \
-        std::ofstream file{ to_string( this->filename() ),                     \
-            std::ofstream::binary };                                           \
+        const auto compress = geode::is_native_compression_enabled();          \
+        std::ostringstream buffer;                                             \
+        auto& output =                                                         \
+            compress ? static_cast< std::ostream& >( buffer ) : stream;        \
         TContext context{};                                                    \
         BitseryExtensions::register_serialize_pcontext(                        \
             std::get< 0 >( context ) );                                        \
-        Serializer archive{ context, file };                                   \
+        std::get< geode::detail::RawValuesContext >( context ).output =        \
+            &output;                                                           \
+        Serializer archive{ context, output };                                 \
         archive.object( dynamic_cast< const OpenGeode##Mesh& >( mesh ) );      \
         archive.adapter().flush();                                             \
         geode::OpenGeodeMeshException::check_exception(                        \
             std::get< 1 >( context ).isValid(), nullptr,                       \
             geode::OpenGeodeException::TYPE::internal,                         \
-            "[Bitsery::write] Error while writing file: ", this->filename() ); \
-        return { to_string( this->filename() ) };                              \
+            "[Bitsery::write] Error while writing file: ", name );             \
+        if( compress )                                                         \
+        {                                                                      \
+            stream << geode::compress_buffer( buffer.str() );                  \
+        }                                                                      \
     }
 
 #define BITSERY_OUTPUT_MESH_DIMENSION( Mesh )                                  \
@@ -84,3 +109,18 @@
                                                                                \
         BITSERY_WRITE( Mesh )                                                  \
     }
+
+namespace geode
+{
+    /*!
+     * Saves a mesh in native format into a memory buffer, e.g.
+     * save_mesh_to_buffer< OpenGeodeTriangulatedSurfaceOutput3D >( surface )
+     */
+    template < typename NativeMeshOutput, typename Mesh >
+    [[nodiscard]] std::string save_mesh_to_buffer( const Mesh& mesh )
+    {
+        std::ostringstream stream;
+        NativeMeshOutput::write_stream( mesh, stream, "buffer" );
+        return stream.str();
+    }
+} // namespace geode
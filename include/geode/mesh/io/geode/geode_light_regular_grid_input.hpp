@@ -23,10 +23,15 @@
 
 #pragma once
 
+#include <istream>
+#include <memory>
+#include <optional>
 #include <string_view>
 
 #include <geode/basic/factory.hpp>
 #include <geode/basic/input.hpp>
+#include <geode/basic/mapped_file.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/point.hpp>
 #include <geode/geometry/vector.hpp>
@@ -54,16 +59,29 @@ namespace geode
     protected:
         [[nodiscard]] LightRegularGrid< dimension > read() override
         {
-            std::ifstream file{ to_string( this->filename() ),
-                std::ifstream::binary };
-            OpenGeodeMeshException::check_exception( !file.fail(), nullptr,
-                OpenGeodeException::TYPE::data,
-                "[LightRegularGridInput] Failed to open file: ",
-                to_string( this->filename() ) );
             TContext context{};
             BitseryExtensions::register_deserialize_pcontext(
                 std::get< 0 >( context ) );
-            Deserializer archive{ context, file };
+            std::optional< MappedFileBuffer > buffer;
+            std::unique_ptr< std::istream > file;
+            if( auto mapped_file = is_native_mapping_enabled()
+                                       ? map_input_file( this->filename() )
+                                       : nullptr )
+            {
+                buffer.emplace( std::move( mapped_file ) );
+                file = std::make_unique< std::istream >( &buffer.value() );
+                std::get< detail::RawValuesContext >( context ).input =
+                    &buffer.value();
+            }
+            else
+            {
+                file = open_input_file( this->filename() );
+            }
+            OpenGeodeMeshException::check_exception( !file->fail(), nullptr,
+                OpenGeodeException::TYPE::data,
+                "[LightRegularGridInput] Failed to open file: ",
+                to_string( this->filename() ) );
+            Deserializer archive{ context, *file };
             Point< dimension > origin;
             std::array< index_t, dimension > cells_number;
             cells_number.fill( 1 );
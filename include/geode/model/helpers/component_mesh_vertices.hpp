@@ -47,55 +47,52 @@ namespace geode
     template < index_t dimension >
     [[nodiscard]] ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >
-                unique_vertices );
+            absl::Span< const ComponentMeshVertices > unique_vertices );
 
     template < index_t dimension >
     [[nodiscard]] ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >
-                unique_vertices,
+            absl::Span< const ComponentMeshVertices > unique_vertices,
             const ComponentType& type );
     template < index_t dimension >
     [[nodiscard]] ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >
-                unique_vertices,
+            absl::Span< const ComponentMeshVertices > unique_vertices,
             const ComponentID& component );
 
     using ComponentMeshVertexPairs = ComponentMeshVertexGeneric< 2 >;
     [[nodiscard]] ComponentMeshVertexPairs opengeode_model_api
         component_mesh_vertex_pairs(
-            absl::Span< const ComponentMeshVertex > unique_vertices0,
-            absl::Span< const ComponentMeshVertex > unique_vertices1 );
+            const ComponentMeshVertices& unique_vertices0,
+            const ComponentMeshVertices& unique_vertices1 );
     [[nodiscard]] ComponentMeshVertexPairs opengeode_model_api
         component_mesh_vertex_pairs(
-            absl::Span< const ComponentMeshVertex > unique_vertices0,
-            absl::Span< const ComponentMeshVertex > unique_vertices1,
+            const ComponentMeshVertices& unique_vertices0,
+            const ComponentMeshVertices& unique_vertices1,
             const ComponentType& type );
     [[nodiscard]] ComponentMeshVertexPairs opengeode_model_api
         component_mesh_vertex_pairs(
-            absl::Span< const ComponentMeshVertex > unique_vertices0,
-            absl::Span< const ComponentMeshVertex > unique_vertices1,
+            const ComponentMeshVertices& unique_vertices0,
+            const ComponentMeshVertices& unique_vertices1,
             const ComponentID& component );
 
     using ComponentMeshVertexTriplets = ComponentMeshVertexGeneric< 3 >;
     [[nodiscard]] ComponentMeshVertexTriplets opengeode_model_api
         component_mesh_vertex_triplets(
-            absl::Span< const ComponentMeshVertex > unique_vertices0,
-            absl::Span< const ComponentMeshVertex > unique_vertices1,
-            absl::Span< const ComponentMeshVertex > unique_vertices2 );
+            const ComponentMeshVertices& unique_vertices0,
+            const ComponentMeshVertices& unique_vertices1,
+            const ComponentMeshVertices& unique_vertices2 );
     [[nodiscard]] ComponentMeshVertexTriplets opengeode_model_api
         component_mesh_vertex_triplets(
-            absl::Span< const ComponentMeshVertex > unique_vertices0,
-            absl::Span< const ComponentMeshVertex > unique_vertices1,
-            absl::Span< const ComponentMeshVertex > unique_vertices2,
+            const ComponentMeshVertices& unique_vertices0,
+            const ComponentMeshVertices& unique_vertices1,
+            const ComponentMeshVertices& unique_vertices2,
             const ComponentType& type );
     [[nodiscard]] ComponentMeshVertexTriplets opengeode_model_api
         component_mesh_vertex_triplets(
-            absl::Span< const ComponentMeshVertex > unique_vertices0,
-            absl::Span< const ComponentMeshVertex > unique_vertices1,
-            absl::Span< const ComponentMeshVertex > unique_vertices2,
+            const ComponentMeshVertices& unique_vertices0,
+            const ComponentMeshVertices& unique_vertices1,
+            const ComponentMeshVertices& unique_vertices2,
             const ComponentID& component );
 
     template < index_t dimension, typename... UniqueVertices >
@@ -103,7 +100,7 @@ namespace geode
         component_mesh_vertex_tuple( UniqueVertices... unique_vertices )
     {
         return component_mesh_vertex_generic(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices... ) );
     }
     template < index_t dimension, typename... UniqueVertices >
@@ -112,7 +109,7 @@ namespace geode
             UniqueVertices... unique_vertices, const ComponentType& type )
     {
         return component_mesh_vertex_generic(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices... ),
             type );
     }
@@ -122,7 +119,7 @@ namespace geode
             UniqueVertices... unique_vertices, const ComponentID& component )
     {
         return component_mesh_vertex_generic(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices... ),
             component );
     }
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.hpp>
 
@@ -77,6 +78,16 @@ namespace geode
         [[nodiscard]] std::optional< uuid > surface_containing_point(
             const Point2D& point );
 
+        /*!
+         * Find the surface containing each point, in parallel.
+         * The first call builds a point location tree over the Section:
+         * points falling in a tree cell not crossed by any Line are
+         * located without ray casting, including in later calls to
+         * surface_containing_point.
+         */
+        [[nodiscard]] std::vector< std::optional< uuid > >
+            surfaces_containing_points( absl::Span< const Point2D > points );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -102,6 +113,16 @@ namespace geode
         [[nodiscard]] std::optional< uuid > block_containing_point(
             const Point3D& point );
 
+        /*!
+         * Find the block containing each point, in parallel.
+         * The first call builds a point location tree over the BRep:
+         * points falling in a tree cell not crossed by any Surface are
+         * located without ray casting, including in later calls to
+         * block_containing_point.
+         */
+        [[nodiscard]] std::vector< std::optional< uuid > >
+            blocks_containing_points( absl::Span< const Point3D > points );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -37,6 +37,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
     FORWARD_DECLARATION_DIMENSION_CLASS( SolidMeshBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -48,6 +49,8 @@ namespace geode
     public:
         void load_blocks( std::string_view directory );
 
+        void load_blocks( std::shared_ptr< const UnzipFile > archive );
+
         /*!
          * Get a pointer to the builder of a Block mesh
          * @param[in] Block Block component to get the builder of
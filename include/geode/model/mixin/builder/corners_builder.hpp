@@ -36,6 +36,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( PointSet );
     FORWARD_DECLARATION_DIMENSION_CLASS( PointSetBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -47,6 +48,8 @@ namespace geode
     public:
         void load_corners( std::string_view directory );
 
+        void load_corners( std::shared_ptr< const UnzipFile > archive );
+
         /*!
          * Get a pointer to the builder of a Corner mesh
          * @param[in] corner Corner in the model
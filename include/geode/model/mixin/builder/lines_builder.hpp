@@ -36,6 +36,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( EdgedCurve );
     FORWARD_DECLARATION_DIMENSION_CLASS( EdgedCurveBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -47,6 +48,8 @@ namespace geode
     public:
         void load_lines( std::string_view directory );
 
+        void load_lines( std::shared_ptr< const UnzipFile > archive );
+
         /*!
          * Get a pointer to the builder of a Line mesh
          * @param[in] line Line component to get the builder of
@@ -37,6 +37,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMeshBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -48,6 +49,8 @@ namespace geode
     public:
         void load_surfaces( std::string_view directory );
 
+        void load_surfaces( std::shared_ptr< const UnzipFile > archive );
+
         /*!
          * Get a pointer to the builder of a Surface mesh
          * @param[in] surface Surface component to get the builder of
@@ -86,6 +86,19 @@ namespace geode
         void set_unique_vertex(
             ComponentMeshVertex component_vertex_id, index_t unique_vertex_id );
 
+        /*!
+         * Identify several component vertices to existing unique vertices.
+         * Prefer it to concurrent calls to set_unique_vertex, which are not
+         * thread safe.
+         * @param[in] component_vertices Indices of the vertices in their
+         * component.
+         * @param[in] unique_vertex_ids Unique vertex index of each component
+         * vertex.
+         */
+        void set_unique_vertices(
+            absl::Span< const ComponentMeshVertex > component_vertices,
+            absl::Span< const index_t > unique_vertex_ids );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_vertex_id Index of the vertex in the component.
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string_view>
 
@@ -80,6 +81,18 @@ namespace geode
 
         [[nodiscard]] const MeshImpl& mesh_type() const;
 
+        /*!
+         * Returns false if the mesh is loaded on demand and has not been
+         * accessed yet
+         */
+        [[nodiscard]] bool is_mesh_loaded() const;
+
+        /*!
+         * Returns true if the mesh is unchanged since it was saved in or
+         * loaded from the archive identified by the given id
+         */
+        [[nodiscard]] bool is_mesh_saved( std::string_view archive_id ) const;
+
     public:
         explicit Block( BlocksKey key );
 
@@ -87,6 +100,11 @@ namespace geode
 
         void set_mesh( std::unique_ptr< Mesh > mesh, BlocksKey key );
 
+        void set_mesh_loader(
+            std::function< std::unique_ptr< Mesh >() > loader, BlocksKey key );
+
+        void set_mesh_saved( std::string_view archive_id, BlocksKey key ) const;
+
         void set_mesh( std::unique_ptr< Mesh > mesh, BlocksBuilderKey key );
 
         template < typename TypedMesh = Mesh >
@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -35,6 +38,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Block );
     FORWARD_DECLARATION_DIMENSION_CLASS( BlocksBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -134,6 +138,17 @@ namespace geode
          */
         void save_blocks( std::string_view directory ) const;
 
+        /*!
+         * Saves the blocks but only the meshes of the blocks accepted by the
+         * filter, the other mesh files are not written.
+         * All the block meshes are then recorded as saved in the archive
+         * identified by archive_id (see Block::is_mesh_saved)
+         */
+        void save_blocks( std::string_view directory,
+            const std::function< bool( const Block< dimension >& ) >&
+                mesh_filter,
+            std::string_view archive_id ) const;
+
     protected:
         Blocks();
         Blocks( Blocks&& other ) noexcept;
@@ -171,6 +186,13 @@ namespace geode
 
         void load_blocks( std::string_view directory, BlocksBuilderKey key );
 
+        /*!
+         * Loads the blocks of an archive, their meshes being extracted and
+         * loaded on their first access
+         */
+        void load_blocks(
+            std::shared_ptr< const UnzipFile > archive, BlocksBuilderKey key );
+
         [[nodiscard]] ModifiableBlockRange modifiable_blocks(
             BlocksBuilderKey key );
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <string_view>
@@ -76,6 +77,18 @@ namespace geode
 
         [[nodiscard]] const MeshImpl& mesh_type() const;
 
+        /*!
+         * Returns false if the mesh is loaded on demand and has not been
+         * accessed yet
+         */
+        [[nodiscard]] bool is_mesh_loaded() const;
+
+        /*!
+         * Returns true if the mesh is unchanged since it was saved in or
+         * loaded from the archive identified by the given id
+         */
+        [[nodiscard]] bool is_mesh_saved( std::string_view archive_id ) const;
+
     public:
         explicit Corner( CornersKey key );
 
@@ -83,6 +96,12 @@ namespace geode
 
         void set_mesh( std::unique_ptr< Mesh > mesh, CornersKey key );
 
+        void set_mesh_loader(
+            std::function< std::unique_ptr< Mesh >() > loader, CornersKey key );
+
+        void set_mesh_saved(
+            std::string_view archive_id, CornersKey key ) const;
+
         void set_mesh( std::unique_ptr< Mesh > mesh, CornersBuilderKey key );
 
         void set_corner_name( std::string_view name, CornersBuilderKey key );
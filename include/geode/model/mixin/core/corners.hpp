@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -35,6 +38,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Corner );
     FORWARD_DECLARATION_DIMENSION_CLASS( CornersBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -133,6 +137,17 @@ namespace geode
          */
         void save_corners( std::string_view directory ) const;
 
+        /*!
+         * Saves the corners but only the meshes of the corners accepted by the
+         * filter, the other mesh files are not written.
+         * All the corner meshes are then recorded as saved in the archive
+         * identified by archive_id (see Corner::is_mesh_saved)
+         */
+        void save_corners( std::string_view directory,
+            const std::function< bool( const Corner< dimension >& ) >&
+                mesh_filter,
+            std::string_view archive_id ) const;
+
     protected:
         Corners();
         Corners( Corners&& other ) noexcept;
@@ -170,6 +185,13 @@ namespace geode
 
         void load_corners( std::string_view directory, CornersBuilderKey key );
 
+        /*!
+         * Loads the corners of an archive, their meshes being extracted and
+         * loaded on their first access
+         */
+        void load_corners(
+            std::shared_ptr< const UnzipFile > archive, CornersBuilderKey key );
+
         [[nodiscard]] ModifiableCornerRange modifiable_corners(
             CornersBuilderKey key );
 
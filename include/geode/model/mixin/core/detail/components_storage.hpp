@@ -24,10 +24,13 @@
 #pragma once
 
 #include <filesystem>
-#include <fstream>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/linked_hash_map.h>
 #include <absl/strings/match.h>
 
@@ -35,6 +38,7 @@
 #include <bitsery/ext/std_smart_ptr.h>
 
 #include <geode/basic/growable.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/bitsery_archive.hpp>
 
@@ -46,6 +50,54 @@
 
 namespace geode::detail
 {
+    /*!
+     * Maps the component uuids to their mesh file in an archive
+     */
+    [[nodiscard]] inline absl::flat_hash_map< std::string, std::string >
+        archive_mesh_files( const UnzipFile& archive )
+    {
+        absl::flat_hash_map< std::string, std::string > mapping;
+        for( auto& file : archive.file_names() )
+        {
+            const auto filename =
+                std::filesystem::path{ file }.replace_extension( "" ).string();
+            if( filename.size() > 36 )
+            {
+                auto uuid = filename.substr( filename.size() - 36 );
+                mapping.emplace( std::move( uuid ), std::move( file ) );
+            }
+        }
+        return mapping;
+    }
+
+    /*!
+     * Finds the components whose mesh is the one saved in the existing
+     * archive, their mesh file can be copied as is
+     * @param[in] mesh_files Mesh files of the archive, see archive_mesh_files
+     */
+    template < typename ComponentRange >
+    void find_saved_meshes( ComponentRange components,
+        std::string_view archive_id,
+        const absl::flat_hash_map< std::string, std::string >& mesh_files,
+        absl::flat_hash_set< uuid >& saved_meshes,
+        std::vector< std::string >& files_to_copy )
+    {
+        for( const auto& component : components )
+        {
+            if( !component.is_mesh_saved( archive_id ) )
+            {
+                continue;
+            }
+            const auto file = mesh_files.find( component.id().string() );
+            if( file == mesh_files.end() )
+            {
+                continue;
+            }
+            saved_meshes.insert( component.id() );
+            files_to_copy.push_back( file->second );
+        }
+    }
+
     template < typename Component >
     class ComponentsStorage
     {
@@ -98,11 +150,11 @@ namespace geode::detail
 
         void save_components( std::string_view filename ) const
         {
-            std::ofstream file{ to_string( filename ), std::ofstream::binary };
+            const auto file = open_output_file( filename );
             TContext context{};
             BitseryExtensions::register_serialize_pcontext(
                 std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, *file };
             archive.object( *this );
             archive.adapter().flush();
             OpenGeodeModelException::check_exception(
@@ -111,6 +163,7 @@ namespace geode::detail
                 "[ComponentsStorage::save_components] Error while writing "
                 "file: ",
                 filename );
+            file->close();
         }
 
         void delete_component( const uuid& component_id )
@@ -120,15 +173,15 @@ namespace geode::detail
 
         void load_components( std::string_view filename )
         {
-            if( !std::filesystem::exists( to_string( filename ) ) )
+            const auto file = open_input_file( filename );
+            if( !*file )
             {
                 return;
             }
-            std::ifstream file{ to_string( filename ), std::ifstream::binary };
             TContext context{};
             BitseryExtensions::register_deserialize_pcontext(
                 std::get< 0 >( context ) );
-            Deserializer archive{ context, file };
+            Deserializer archive{ context, *file };
             archive.object( *this );
             const auto& adapter = archive.adapter();
             OpenGeodeModelException::check_exception(
@@ -159,6 +212,12 @@ namespace geode::detail
             return mapping;
         }
 
+        [[nodiscard]] absl::flat_hash_map< std::string, std::string >
+            file_mapping( const UnzipFile& archive ) const
+        {
+            return archive_mesh_files( archive );
+        }
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -182,4 +241,40 @@ namespace geode::detail
     private:
         ComponentsStore components_;
     };
+
+    /*!
+     * Extracts a mesh file from an archive, loads it and removes the
+     * extracted file
+     * @param[in] load_mesh Function loading a mesh from a file path
+     */
+    template < typename MeshLoader >
+    [[nodiscard]] auto load_mesh_from_archive( const UnzipFile& archive,
+        std::string_view file_name,
+        const MeshLoader& load_mesh )
+    {
+        const auto file = archive.extract_file( file_name );
+        auto mesh = load_mesh( file );
+        std::filesystem::remove( file );
+        return mesh;
+    }
+
+    /*!
+     * Name of the file storing the id of a native model archive.
+     * A new id is written each time a model is saved in an archive file.
+     */
+    inline constexpr std::string_view MODEL_ARCHIVE_ID_FILE{ "archive_id" };
+
+    /*!
+     * Returns the id of a native model archive or an empty string if the
+     * archive has none, e.g. if it was saved in a memory buffer
+     */
+    [[nodiscard]] inline std::string model_archive_id(
+        const UnzipFile& archive )
+    {
+        if( !archive.has_file( MODEL_ARCHIVE_ID_FILE ) )
+        {
+            return {};
+        }
+        return archive.read_file( MODEL_ARCHIVE_ID_FILE );
+    }
 } // namespace geode::detail
@@ -23,47 +23,208 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 
+#include <absl/synchronization/mutex.h>
+
+#include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/growable.hpp>
 #include <geode/basic/identifier_builder.hpp>
 #include <geode/basic/uuid.hpp>
 
+#include <geode/mesh/core/graph.hpp>
 #include <geode/mesh/core/mesh_id.hpp>
+#include <geode/mesh/core/solid_edges.hpp>
+#include <geode/mesh/core/solid_facets.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_edges.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/core/vertex_set.hpp>
 
 namespace geode
 {
     namespace detail
     {
+        /*!
+         * Sum of the builder generation of a mesh and of the modification
+         * counts of all its attribute managers, used to detect edits done
+         * through a builder or an attribute kept by the user
+         */
+        [[nodiscard]] inline index_t mesh_modification_count(
+            const VertexSet& mesh )
+        {
+            return mesh.builder_generation()
+                   + mesh.vertex_attribute_manager().modification_count();
+        }
+
+        [[nodiscard]] inline index_t mesh_modification_count(
+            const Graph& mesh )
+        {
+            return mesh.builder_generation()
+                   + mesh.vertex_attribute_manager().modification_count()
+                   + mesh.edge_attribute_manager().modification_count();
+        }
+
+        template < index_t dimension >
+        [[nodiscard]] index_t mesh_modification_count(
+            const SurfaceMesh< dimension >& mesh )
+        {
+            auto count =
+                mesh.builder_generation()
+                + mesh.vertex_attribute_manager().modification_count()
+                + mesh.polygon_attribute_manager().modification_count();
+            if( mesh.are_edges_enabled() )
+            {
+                count +=
+                    mesh.edges().edge_attribute_manager().modification_count();
+            }
+            return count;
+        }
+
+        template < index_t dimension >
+        [[nodiscard]] index_t mesh_modification_count(
+            const SolidMesh< dimension >& mesh )
+        {
+            auto count =
+                mesh.builder_generation()
+                + mesh.vertex_attribute_manager().modification_count()
+                + mesh.polyhedron_attribute_manager().modification_count();
+            if( mesh.are_facets_enabled() )
+            {
+                count += mesh.facets()
+                             .facet_attribute_manager()
+                             .modification_count();
+            }
+            if( mesh.are_edges_enabled() )
+            {
+                count +=
+                    mesh.edges().edge_attribute_manager().modification_count();
+            }
+            return count;
+        }
+
         template < typename Mesh >
         class MeshStorage
         {
         public:
+            using MeshLoader = std::function< std::unique_ptr< Mesh >() >;
+
             MeshStorage() : mesh_type_{ "" } {}
 
             void set_mesh( uuid new_mesh_uuid, std::unique_ptr< Mesh > mesh )
             {
                 mesh_type_ = mesh->impl_name();
                 mesh_ = std::move( mesh );
+                mesh_loader_ = nullptr;
+                lazy_.store( false, std::memory_order_release );
+                modified_.store( true, std::memory_order_relaxed );
                 IdentifierBuilder mesh_builder{ *mesh_ };
                 mesh_builder.set_id( std::move( new_mesh_uuid ) );
             }
 
+            /*!
+             * Sets a function creating the mesh on its first access.
+             * The current mesh is released and no memory is used by the mesh
+             * until it is accessed.
+             * @note The mesh type is not modified and should correspond to
+             * the mesh returned by the loader.
+             */
+            void set_mesh_loader( uuid new_mesh_uuid, MeshLoader loader )
+            {
+                mesh_.reset();
+                mesh_loader_ = [mesh_uuid = std::move( new_mesh_uuid ),
+                                   loader = std::move( loader )] {
+                    auto mesh = loader();
+                    IdentifierBuilder mesh_builder{ *mesh };
+                    mesh_builder.set_id( mesh_uuid );
+                    return mesh;
+                };
+                lazy_.store( true, std::memory_order_release );
+                modified_.store( true, std::memory_order_relaxed );
+            }
+
+            [[nodiscard]] bool is_mesh_loaded() const
+            {
+                return !lazy_.load( std::memory_order_acquire );
+            }
+
             [[nodiscard]] const Mesh& mesh() const
             {
+                load_mesh();
                 return *mesh_;
             }
 
             [[nodiscard]] Mesh& modifiable_mesh()
             {
+                load_mesh();
+                modified_.store( true, std::memory_order_relaxed );
                 return *mesh_;
             }
 
             [[nodiscard]] std::unique_ptr< Mesh > steal_mesh()
             {
+                load_mesh();
+                modified_.store( true, std::memory_order_relaxed );
                 return std::move( mesh_ );
             }
 
+            /*!
+             * Returns true if the mesh is the one saved in the given archive,
+             * i.e. it was saved in or loaded from this archive and since
+             * then, no modifiable access was given, no mesh builder was
+             * used and its attributes were not modified
+             */
+            [[nodiscard]] bool is_mesh_saved(
+                std::string_view archive_id ) const
+            {
+                if( archive_id.empty()
+                    || modified_.load( std::memory_order_relaxed ) )
+                {
+                    return false;
+                }
+                absl::MutexLock lock{ mutex_ };
+                if( saved_archive_ != archive_id )
+                {
+                    return false;
+                }
+                if( !is_mesh_loaded() )
+                {
+                    return true;
+                }
+                return !mesh_->has_alive_builders()
+                       && saved_modification_count_
+                              == mesh_modification_count( *mesh_ );
+            }
+
+            /*!
+             * Records that the current mesh is the one saved in the given
+             * archive. If the mesh is loaded on demand, its modifications
+             * are checked from the time it is loaded.
+             * Nothing is recorded for an empty archive id, e.g. when the mesh
+             * is saved in a memory buffer.
+             */
+            void set_mesh_saved( std::string_view archive_id ) const
+            {
+                if( archive_id.empty() )
+                {
+                    return;
+                }
+                absl::MutexLock lock{ mutex_ };
+                saved_archive_ = archive_id;
+                saved_modification_count_.reset();
+                if( is_mesh_loaded() && mesh_ )
+                {
+                    saved_modification_count_ =
+                        mesh_modification_count( *mesh_ );
+                }
+                modified_.store( false, std::memory_order_relaxed );
+            }
+
             [[nodiscard]] const MeshImpl& mesh_type() const
             {
                 return mesh_type_;
@@ -80,8 +241,33 @@ namespace geode
             }
 
         private:
-            std::unique_ptr< Mesh > mesh_;
+            void load_mesh() const
+            {
+                if( is_mesh_loaded() )
+                {
+                    return;
+                }
+                absl::MutexLock lock{ mutex_ };
+                if( is_mesh_loaded() )
+                {
+                    return;
+                }
+                mesh_ = mesh_loader_();
+                mesh_loader_ = nullptr;
+                saved_modification_count_ =
+                    mesh_modification_count( *mesh_ );
+                lazy_.store( false, std::memory_order_release );
+            }
+
+        private:
+            mutable std::unique_ptr< Mesh > mesh_;
             MeshImpl mesh_type_;
+            mutable MeshLoader mesh_loader_;
+            mutable std::atomic< bool > lazy_{ false };
+            mutable std::atomic< bool > modified_{ true };
+            mutable std::string saved_archive_;
+            mutable std::optional< index_t > saved_modification_count_;
+            mutable absl::Mutex mutex_;
         };
     } // namespace detail
 } // namespace geode
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string_view>
 
@@ -75,6 +76,18 @@ namespace geode
 
         [[nodiscard]] const MeshImpl& mesh_type() const;
 
+        /*!
+         * Returns false if the mesh is loaded on demand and has not been
+         * accessed yet
+         */
+        [[nodiscard]] bool is_mesh_loaded() const;
+
+        /*!
+         * Returns true if the mesh is unchanged since it was saved in or
+         * loaded from the archive identified by the given id
+         */
+        [[nodiscard]] bool is_mesh_saved( std::string_view archive_id ) const;
+
     public:
         explicit Line( LinesKey key );
 
@@ -82,6 +95,11 @@ namespace geode
 
         void set_mesh( std::unique_ptr< Mesh > mesh, LinesKey key );
 
+        void set_mesh_loader(
+            std::function< std::unique_ptr< Mesh >() > loader, LinesKey key );
+
+        void set_mesh_saved( std::string_view archive_id, LinesKey key ) const;
+
         void set_mesh( std::unique_ptr< Mesh > mesh, LinesBuilderKey key );
 
         void set_line_name( std::string_view name, LinesBuilderKey key );
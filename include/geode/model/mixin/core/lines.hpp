@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -35,6 +38,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Line );
     FORWARD_DECLARATION_DIMENSION_CLASS( LinesBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -117,6 +121,17 @@ namespace geode
 
         void save_lines( std::string_view directory ) const;
 
+        /*!
+         * Saves the lines but only the meshes of the lines accepted by the
+         * filter, the other mesh files are not written.
+         * All the line meshes are then recorded as saved in the archive
+         * identified by archive_id (see Line::is_mesh_saved)
+         */
+        void save_lines( std::string_view directory,
+            const std::function< bool( const Line< dimension >& ) >&
+                mesh_filter,
+            std::string_view archive_id ) const;
+
     protected:
         Lines();
         Lines( Lines&& other ) noexcept;
@@ -153,6 +168,13 @@ namespace geode
 
         void load_lines( std::string_view directory, LinesBuilderKey key );
 
+        /*!
+         * Loads the lines of an archive, their meshes being extracted and
+         * loaded on their first access
+         */
+        void load_lines(
+            std::shared_ptr< const UnzipFile > archive, LinesBuilderKey key );
+
         [[nodiscard]] ModifiableLineRange modifiable_lines(
             LinesBuilderKey key );
 
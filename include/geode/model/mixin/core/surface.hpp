@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string_view>
 
@@ -90,8 +91,26 @@ namespace geode
 
         [[nodiscard]] const MeshImpl& mesh_type() const;
 
+        /*!
+         * Returns false if the mesh is loaded on demand and has not been
+         * accessed yet
+         */
+        [[nodiscard]] bool is_mesh_loaded() const;
+
+        /*!
+         * Returns true if the mesh is unchanged since it was saved in or
+         * loaded from the archive identified by the given id
+         */
+        [[nodiscard]] bool is_mesh_saved( std::string_view archive_id ) const;
+
         void set_mesh( std::unique_ptr< Mesh > mesh, SurfacesKey key );
 
+        void set_mesh_loader( std::function< std::unique_ptr< Mesh >() > loader,
+            SurfacesKey key );
+
+        void set_mesh_saved(
+            std::string_view archive_id, SurfacesKey key ) const;
+
         void set_mesh( std::unique_ptr< Mesh > mesh, SurfacesBuilderKey key );
 
         void set_surface_name( std::string_view name, SurfacesBuilderKey key );
@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -35,6 +38,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfacesBuilder );
 
+    class UnzipFile;
     struct uuid;
 } // namespace geode
 
@@ -119,6 +123,17 @@ namespace geode
 
         void save_surfaces( std::string_view directory ) const;
 
+        /*!
+         * Saves the surfaces but only the meshes of the surfaces accepted by
+         * the filter, the other mesh files are not written.
+         * All the surface meshes are then recorded as saved in the archive
+         * identified by archive_id (see Surface::is_mesh_saved)
+         */
+        void save_surfaces( std::string_view directory,
+            const std::function< bool( const Surface< dimension >& ) >&
+                mesh_filter,
+            std::string_view archive_id ) const;
+
     protected:
         Surfaces();
         Surfaces( Surfaces&& other ) noexcept;
@@ -157,6 +172,13 @@ namespace geode
         void load_surfaces(
             std::string_view directory, SurfacesBuilderKey key );
 
+        /*!
+         * Loads the surfaces of an archive, their meshes being extracted and
+         * loaded on their first access
+         */
+        void load_surfaces( std::shared_ptr< const UnzipFile > archive,
+            SurfacesBuilderKey key );
+
         [[nodiscard]] ModifiableSurfaceRange modifiable_surfaces(
             SurfacesBuilderKey key );
 
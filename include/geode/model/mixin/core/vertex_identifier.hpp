@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <iterator>
 #include <vector>
 
 #include <absl/hash/hash.h>
@@ -83,6 +84,226 @@ namespace geode
         ComponentMeshVertex();
     };
 
+    namespace detail
+    {
+        /*!
+         * Component mesh vertex whose component is given by its index in the
+         * components known by a VertexIdentifier
+         */
+        struct InternedComponentMeshVertex
+        {
+            [[nodiscard]] bool operator==(
+                const InternedComponentMeshVertex& other ) const
+            {
+                return component == other.component && vertex == other.vertex;
+            }
+
+            index_t component{ NO_ID };
+            index_t vertex{ NO_ID };
+        };
+    } // namespace detail
+
+    /*!
+     * Lightweight view on a list of component mesh vertices.
+     * A VertexIdentifier stores each component id once and gives views in
+     * which the ComponentMeshVertex are built on access. A view can also be
+     * built on existing ComponentMeshVertex.
+     */
+    class ComponentMeshVertices
+    {
+    public:
+        class Iterator;
+
+        ComponentMeshVertices() = default;
+
+        ComponentMeshVertices(
+            absl::Span< const detail::InternedComponentMeshVertex > vertices,
+            absl::Span< const ComponentID > components )
+            : interned_( vertices.data() ),
+              components_( components.data() ),
+              size_( static_cast< index_t >( vertices.size() ) )
+        {
+        }
+
+        ComponentMeshVertices(
+            absl::Span< const ComponentMeshVertex > vertices )
+            : vertices_( vertices.data() ),
+              size_( static_cast< index_t >( vertices.size() ) )
+        {
+        }
+
+        ComponentMeshVertices(
+            const std::vector< ComponentMeshVertex >& vertices )
+            : ComponentMeshVertices{ absl::MakeConstSpan( vertices ) }
+        {
+        }
+
+        [[nodiscard]] index_t size() const
+        {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] ComponentMeshVertex operator[]( index_t index ) const
+        {
+            if( vertices_ )
+            {
+                return vertices_[index];
+            }
+            const auto& vertex = interned_[index];
+            return { components_[vertex.component], vertex.vertex };
+        }
+
+        [[nodiscard]] ComponentMeshVertex front() const
+        {
+            return ( *this )[0];
+        }
+
+        [[nodiscard]] ComponentMeshVertex back() const
+        {
+            return ( *this )[size_ - 1];
+        }
+
+        [[nodiscard]] Iterator begin() const;
+
+        [[nodiscard]] Iterator end() const;
+
+    private:
+        const detail::InternedComponentMeshVertex* interned_{ nullptr };
+        const ComponentID* components_{ nullptr };
+        const ComponentMeshVertex* vertices_{ nullptr };
+        index_t size_{ 0 };
+    };
+
+    class ComponentMeshVertices::Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = ComponentMeshVertex;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ComponentMeshVertex;
+
+        Iterator( ComponentMeshVertices vertices, index_t index )
+            : vertices_( vertices ), index_( index )
+        {
+        }
+
+        [[nodiscard]] ComponentMeshVertex operator*() const
+        {
+            return vertices_[index_];
+        }
+
+        [[nodiscard]] ComponentMeshVertex operator[](
+            difference_type offset ) const
+        {
+            return vertices_[index_ + offset];
+        }
+
+        Iterator& operator++()
+        {
+            index_++;
+            return *this;
+        }
+
+        Iterator operator++( int )
+        {
+            auto current = *this;
+            index_++;
+            return current;
+        }
+
+        Iterator& operator--()
+        {
+            index_--;
+            return *this;
+        }
+
+        Iterator operator--( int )
+        {
+            auto current = *this;
+            index_--;
+            return current;
+        }
+
+        Iterator& operator+=( difference_type offset )
+        {
+            index_ += offset;
+            return *this;
+        }
+
+        Iterator& operator-=( difference_type offset )
+        {
+            index_ -= offset;
+            return *this;
+        }
+
+        [[nodiscard]] Iterator operator+( difference_type offset ) const
+        {
+            return { vertices_, static_cast< index_t >( index_ + offset ) };
+        }
+
+        [[nodiscard]] Iterator operator-( difference_type offset ) const
+        {
+            return { vertices_, static_cast< index_t >( index_ - offset ) };
+        }
+
+        [[nodiscard]] difference_type operator-(
+            const Iterator& other ) const
+        {
+            return static_cast< difference_type >( index_ )
+                   - static_cast< difference_type >( other.index_ );
+        }
+
+        [[nodiscard]] bool operator==( const Iterator& other ) const
+        {
+            return index_ == other.index_;
+        }
+
+        [[nodiscard]] bool operator!=( const Iterator& other ) const
+        {
+            return index_ != other.index_;
+        }
+
+        [[nodiscard]] bool operator<( const Iterator& other ) const
+        {
+            return index_ < other.index_;
+        }
+
+        [[nodiscard]] bool operator>( const Iterator& other ) const
+        {
+            return index_ > other.index_;
+        }
+
+        [[nodiscard]] bool operator<=( const Iterator& other ) const
+        {
+            return index_ <= other.index_;
+        }
+
+        [[nodiscard]] bool operator>=( const Iterator& other ) const
+        {
+            return index_ >= other.index_;
+        }
+
+    private:
+        ComponentMeshVertices vertices_;
+        index_t index_;
+    };
+
+    inline ComponentMeshVertices::Iterator ComponentMeshVertices::begin() const
+    {
+        return { *this, 0 };
+    }
+
+    inline ComponentMeshVertices::Iterator ComponentMeshVertices::end() const
+    {
+        return { *this, size_ };
+    }
+
     /*!
      * This class identifies groups of geometric component vertices
      * as unique vertices.
@@ -103,10 +324,12 @@ namespace geode
 
         /*!
          * Return the component vertices identified with an unique vertex.
+         * The returned view is invalidated by any modification of the
+         * VertexIdentifier.
          * @param[in] unique_vertex_id Indice of the unique vertex.
          */
-        [[nodiscard]] const std::vector< ComponentMeshVertex >&
-            component_mesh_vertices( index_t unique_vertex_id ) const;
+        [[nodiscard]] ComponentMeshVertices component_mesh_vertices(
+            index_t unique_vertex_id ) const;
         /*!
          * Return the unique vertex index of a given component vertex.
          * @param[in] component_vertex Vertex index in a geometric component.
@@ -178,6 +401,20 @@ namespace geode
             index_t unique_vertex_id,
             BuilderKey /*key*/ );
 
+        /*!
+         * Identify several component vertices to existing unique vertices.
+         * The component vertices of each unique vertex are filled in
+         * parallel and keep the order of the given vertices.
+         * @param[in] component_vertices Indices of the vertices in their
+         * component.
+         * @param[in] unique_vertex_ids Unique vertex index of each component
+         * vertex.
+         */
+        void set_unique_vertices(
+            absl::Span< const ComponentMeshVertex > component_vertices,
+            absl::Span< const index_t > unique_vertex_ids,
+            BuilderKey /*key*/ );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_vertex_id Index of the vertex in the component.
@@ -426,21 +426,23 @@ namespace geode
             index_t first_new_unique_vertex_id,
             const ModelCopyMapping& mapping )
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, from.nb_unique_vertices() ),
-                [&from, &builder_to, &first_new_unique_vertex_id, &mapping](
-                    index_t v ) {
-                    for( const auto& mesh_vertex :
-                        from.component_mesh_vertices( v ) )
-                    {
-                        const auto& type = mesh_vertex.component_id.type;
-                        builder_to.set_unique_vertex(
-                            { { type, mapping.at( type ).in2out(
-                                          mesh_vertex.component_id.id ) },
-                                mesh_vertex.vertex },
-                            first_new_unique_vertex_id + v );
-                    }
-                } );
+            std::vector< ComponentMeshVertex > component_vertices;
+            std::vector< index_t > unique_vertices;
+            for( const auto v : Range{ from.nb_unique_vertices() } )
+            {
+                for( const auto& mesh_vertex :
+                    from.component_mesh_vertices( v ) )
+                {
+                    const auto& type = mesh_vertex.component_id.type;
+                    component_vertices.emplace_back(
+                        ComponentID{ type, mapping.at( type ).in2out(
+                                               mesh_vertex.component_id.id ) },
+                        mesh_vertex.vertex );
+                    unique_vertices.push_back( first_new_unique_vertex_id + v );
+                }
+            }
+            builder_to.set_unique_vertices(
+                component_vertices, unique_vertices );
         }
     } // namespace detail
 } // namespace geode
@@ -48,6 +48,20 @@ namespace geode
     std::vector< std::string > opengeode_model_api save_brep(
         const BRep& brep, std::string_view filename );
 
+    /*!
+     * API function for updating a native BRep file, usually the one the
+     * BRep was loaded from or last saved to. Only the component meshes
+     * modified since then are written, the other meshes are copied as is from
+     * the existing file, which is much faster for large models.
+     * If the file does not exist, the BRep is fully saved. Non native
+     * formats are always fully saved.
+     * @param[in] brep BRep to save.
+     * @param[in] filename Path to the file to update.
+     * @warning The existing file should have been written from this BRep.
+     */
+    std::vector< std::string > opengeode_model_api save_brep_incrementally(
+        const BRep& brep, std::string_view filename );
+
     class BRepOutput : public Output< BRep >
     {
     protected:
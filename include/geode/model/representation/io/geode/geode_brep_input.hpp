@@ -23,8 +23,14 @@
 
 #pragma once
 
+#include <filesystem>
+#include <memory>
+
 #include <async++.h>
 
+#include <geode/basic/logger.hpp>
+#include <geode/basic/zip_file.hpp>
+
 #include <geode/model/representation/builder/brep_builder.hpp>
 #include <geode/model/representation/builder/detail/filter.hpp>
 #include <geode/model/representation/builder/detail/register.hpp>
@@ -64,29 +70,56 @@ namespace geode
         }
     };
 
+    /*!
+     * Load a BRep from a native file without decoding the component meshes.
+     * Component metadata, relationships and unique vertices are loaded
+     * immediately, each component mesh is decoded on its first access.
+     * @param[in] filename Path to the native file to load.
+     * @warning The file should not be modified while the BRep is used.
+     */
+    [[nodiscard]] BRep opengeode_model_api lazy_load_brep(
+        std::string_view filename );
+
+    /*!
+     * Load a BRep from a memory buffer containing a native file.
+     * The buffer is never written on disk.
+     * @param[in] buffer Content of a native file, as given by
+     * save_brep_to_buffer.
+     */
+    [[nodiscard]] BRep opengeode_model_api load_brep_from_buffer(
+        std::string_view buffer );
+
     namespace detail
     {
         template < typename Model >
-        void load_brep_files( Model& brep, std::string_view directory )
+        void load_brep_files(
+            Model& brep, std::shared_ptr< const UnzipFile > zip_reader )
         {
+            for( const auto& file : zip_reader->file_names() )
+            {
+                if( !std::filesystem::path{ file }.has_extension() )
+                {
+                    zip_reader->extract_file( file );
+                }
+            }
+            const auto& directory = zip_reader->directory();
             BRepBuilder builder{ brep };
-            const auto level = Logger::level();
-            Logger::set_level( Logger::LEVEL::warning );
+            const LoggerLevelGuard level_guard{ Logger::LEVEL::warning };
             async::parallel_invoke(
                 [&builder, &directory] {
                     builder.load_identifier( directory );
                 },
-                [&builder, &directory] {
-                    builder.load_corners( directory );
+                [&builder, &zip_reader] {
+                    builder.load_corners( zip_reader );
                 },
-                [&builder, &directory] {
-                    builder.load_lines( directory );
+                [&builder, &zip_reader] {
+                    builder.load_lines( zip_reader );
                 },
-                [&builder, &directory] {
-                    builder.load_surfaces( directory );
+                [&builder, &zip_reader] {
+                    builder.load_surfaces( zip_reader );
                 },
-                [&builder, &directory] {
-                    builder.load_blocks( directory );
+                [&builder, &zip_reader] {
+                    builder.load_blocks( zip_reader );
                 },
                 [&builder, &directory] {
                     builder.load_model_boundaries( directory );
@@ -109,7 +142,6 @@ namespace geode
                 [&builder, &directory] {
                     builder.load_unique_vertices( directory );
                 } );
-            Logger::set_level( level );
             detail::register_all_components( brep );
             detail::filter_unsupported_components( brep );
         }
@@ -23,8 +23,14 @@
 
 #pragma once
 
+#include <filesystem>
+#include <memory>
+
 #include <async++.h>
 
+#include <geode/basic/logger.hpp>
+#include <geode/basic/zip_file.hpp>
+
 #include <geode/model/representation/builder/detail/filter.hpp>
 #include <geode/model/representation/builder/detail/register.hpp>
 #include <geode/model/representation/builder/section_builder.hpp>
@@ -64,26 +70,43 @@ namespace geode
         }
     };
 
+    /*!
+     * Load a Section from a memory buffer containing a native file.
+     * The buffer is never written on disk.
+     * @param[in] buffer Content of a native file, as given by
+     * save_section_to_buffer.
+     */
+    [[nodiscard]] Section opengeode_model_api load_section_from_buffer(
+        std::string_view buffer );
+
     namespace detail
     {
         template < typename Model >
-        void load_section_files( Model& section, std::string_view directory )
+        void load_section_files(
+            Model& section, std::shared_ptr< const UnzipFile > zip_reader )
         {
+            for( const auto& file : zip_reader->file_names() )
+            {
+                if( !std::filesystem::path{ file }.has_extension() )
+                {
+                    zip_reader->extract_file( file );
+                }
+            }
+            const auto& directory = zip_reader->directory();
             SectionBuilder builder{ section };
-            const auto level = Logger::level();
-            Logger::set_level( Logger::LEVEL::warning );
+            const LoggerLevelGuard level_guard{ Logger::LEVEL::warning };
             async::parallel_invoke(
                 [&builder, &directory] {
                     builder.load_identifier( directory );
                 },
-                [&builder, &directory] {
-                    builder.load_corners( directory );
+                [&builder, &zip_reader] {
+                    builder.load_corners( zip_reader );
                 },
-                [&builder, &directory] {
-                    builder.load_lines( directory );
+                [&builder, &zip_reader] {
+                    builder.load_lines( zip_reader );
                 },
-                [&builder, &directory] {
-                    builder.load_surfaces( directory );
+                [&builder, &zip_reader] {
+                    builder.load_surfaces( zip_reader );
                 },
                 [&builder, &directory] {
                     builder.load_model_boundaries( directory );
@@ -103,7 +126,6 @@ namespace geode
                 [&builder, &directory] {
                     builder.load_unique_vertices( directory );
                 } );
-            Logger::set_level( level );
             detail::register_all_components( section );
             detail::filter_unsupported_components( section );
         }
@@ -26,6 +26,10 @@
 #include <string>
 #include <vector>
 
+#include <absl/container/flat_hash_set.h>
+
+#include <geode/basic/uuid.hpp>
+
 #include <geode/model/representation/core/section.hpp>
 #include <geode/model/representation/io/section_output.hpp>
 
@@ -53,8 +57,35 @@ namespace geode
         void save_section_files(
             const Section& section, std::string_view directory ) const;
 
+        /*!
+         * Saves the Section files except the meshes of the given components.
+         * If archive_id is not empty, it is saved as the id of the archive
+         * and all the component meshes are recorded as saved in it.
+         */
+        void save_section_files( const Section& section,
+            std::string_view directory,
+            const absl::flat_hash_set< uuid >& saved_meshes,
+            std::string_view archive_id ) const;
+
+        /*!
+         * Updates the existing file: only the component meshes modified since
+         * they were saved in or loaded from this file are written, the other
+         * meshes are copied as is from the existing file.
+         * If the file does not exist, the Section is fully saved.
+         */
+        std::vector< std::string > update( const Section& section ) const;
+
         void archive_section_files( const ZipFile& zip_writer ) const;
 
         std::vector< std::string > write( const Section& section ) const final;
     };
+
+    /*!
+     * Save a Section in native format into a memory buffer.
+     * Native component meshes are never written on disk.
+     * @return Content of the native file, to be loaded with
+     * load_section_from_buffer.
+     */
+    [[nodiscard]] std::string opengeode_model_api save_section_to_buffer(
+        const Section& section );
 } // namespace geode
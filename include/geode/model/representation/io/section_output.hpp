@@ -48,6 +48,20 @@ namespace geode
     std::vector< std::string > opengeode_model_api save_section(
         const Section& section, std::string_view filename );
 
+    /*!
+     * API function for updating a native Section file, usually the one the
+     * Section was loaded from or last saved to. Only the component meshes
+     * modified since then are written, the other meshes are copied as is from
+     * the existing file, which is much faster for large models.
+     * If the file does not exist, the Section is fully saved. Non native
+     * formats are always fully saved.
+     * @param[in] section Section to save.
+     * @param[in] filename Path to the file to update.
+     * @warning The existing file should have been written from this Section.
+     */
+    std::vector< std::string > opengeode_model_api save_section_incrementally(
+        const Section& section, std::string_view filename );
+
     class SectionOutput : public Output< Section >
     {
     protected:
@@ -24,7 +24,11 @@
 #include <geode/basic/attribute_manager.hpp>
 
 #include <algorithm>
+#include <atomic>
 
+#include <async++.h>
+
+#include <absl/container/fixed_array.h>
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/linked_hash_map.h>
 
@@ -35,6 +39,23 @@
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
+namespace
+{
+    void check_elements_range( geode::index_t nb_elements,
+        absl::Span< const geode::index_t > elements,
+        std::string_view message )
+    {
+        for( const auto element : elements )
+        {
+            geode::OpenGeodeBasicException::check_exception(
+                element < nb_elements, nullptr,
+                geode::OpenGeodeException::TYPE::data, message,
+                " Element ", element, " is out of range (", nb_elements,
+                " elements)" );
+        }
+    }
+} // namespace
+
 namespace geode
 {
     class AttributeManager::Impl
@@ -43,6 +64,11 @@ namespace geode
             absl::linked_hash_map< uuid, std::shared_ptr< AttributeBase > >;
         using AttributesMapElement = std::pair< const AttributesMap::key_type,
             AttributesMap::mapped_type >;
+        /*!
+         * Bulk operations are dispatched on the attributes in parallel when
+         * the number of processed values exceeds this threshold
+         */
+        static constexpr index_t PARALLEL_THRESHOLD{ 4096 };
 
     public:
         std::shared_ptr< AttributeBase > find_attribute_base(
@@ -62,6 +88,7 @@ namespace geode
         {
             attribute->resize( nb_elements_, key );
             attributes_.emplace( attribute_id, attribute );
+            increment_generation();
         }
 
         void resize( index_t size, const AttributeBase::AttributeKey &key )
@@ -71,10 +98,9 @@ namespace geode
                 return;
             }
             nb_elements_ = size;
-            for( auto &attribute_it : attributes_ )
-            {
-                attribute_it.second->resize( size, key );
-            }
+            for_each_attribute( size, [size, &key]( AttributeBase &attribute ) {
+                attribute.resize( size, key );
+            } );
         }
 
         void reserve( index_t capacity, const AttributeBase::AttributeKey &key )
@@ -83,10 +109,10 @@ namespace geode
             {
                 return;
             }
-            for( auto &attribute_it : attributes_ )
-            {
-                attribute_it.second->reserve( capacity, key );
-            }
+            for_each_attribute(
+                capacity, [capacity, &key]( AttributeBase &attribute ) {
+                    attribute.reserve( capacity, key );
+                } );
         }
 
         void assign_attribute_value( index_t from_element,
@@ -129,6 +155,37 @@ namespace geode
             }
         }
 
+        void assign_attribute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            const AttributeBase::AttributeKey &key )
+        {
+            for_each_attribute( static_cast< index_t >( to_elements.size() ),
+                [&from_elements, &to_elements, &key](
+                    AttributeBase &attribute ) {
+                    if( attribute.properties().assignable )
+                    {
+                        attribute.compute_values(
+                            from_elements, to_elements, key );
+                    }
+                } );
+        }
+
+        void interpolate_attribute_values(
+            absl::Span< const AttributeLinearInterpolation > interpolations,
+            absl::Span< const index_t > to_elements,
+            const AttributeBase::AttributeKey &key )
+        {
+            for_each_attribute( static_cast< index_t >( to_elements.size() ),
+                [&interpolations, &to_elements, &key](
+                    AttributeBase &attribute ) {
+                    if( attribute.properties().interpolable )
+                    {
+                        attribute.compute_values(
+                            interpolations, to_elements, key );
+                    }
+                } );
+        }
+
         bool has_assignable_attributes() const
         {
             return absl::c_any_of(
@@ -168,6 +225,7 @@ namespace geode
             if( attribute_it != attributes_.end() )
             {
                 attributes_.erase( attribute_it );
+                increment_generation();
             }
         }
 
@@ -186,24 +244,25 @@ namespace geode
         {
             attributes_.clear();
             nb_elements_ = 0;
+            increment_generation();
         }
 
         void clear_attributes( const AttributeBase::AttributeKey &key )
         {
-            for( auto &attribute_it : attributes_ )
-            {
-                attribute_it.second->resize( 0, key );
-            }
+            for_each_attribute(
+                nb_elements_, [&key]( AttributeBase &attribute ) {
+                    attribute.resize( 0, key );
+                } );
             nb_elements_ = 0;
         }
 
         void delete_elements( const std::vector< bool > &to_delete,
             const AttributeBase::AttributeKey &key )
         {
-            for( auto &attribute_it : attributes_ )
-            {
-                attribute_it.second->delete_elements( to_delete, key );
-            }
+            for_each_attribute(
+                nb_elements_, [&to_delete, &key]( AttributeBase &attribute ) {
+                    attribute.delete_elements( to_delete, key );
+                } );
             nb_elements_ -=
                 static_cast< index_t >( absl::c_count( to_delete, true ) );
         }
@@ -211,10 +270,10 @@ namespace geode
         void permute_elements( absl::Span< const index_t > permutation,
             const AttributeBase::AttributeKey &key )
         {
-            for( auto &attribute_it : attributes_ )
-            {
-                attribute_it.second->permute_elements( permutation, key );
-            }
+            for_each_attribute( nb_elements_,
+                [&permutation, &key]( AttributeBase &attribute ) {
+                    attribute.permute_elements( permutation, key );
+                } );
         }
 
         index_t nb_elements() const
@@ -274,6 +333,7 @@ namespace geode
                 {
                     attributes_.emplace(
                         attribute_id_from, attribute_from->clone( key ) );
+                    increment_generation();
                 }
             }
         }
@@ -283,6 +343,10 @@ namespace geode
             const T &old2new_mapping,
             const AttributeBase::AttributeKey &key )
         {
+            using AttributeFrom = const std::shared_ptr< AttributeBase > *;
+            std::vector< std::pair< AttributeBase *, AttributeFrom > >
+                to_import;
+            std::vector< std::pair< uuid, AttributeFrom > > to_extract;
             for( const auto &[attribute_id, attribute_from] :
                 attribute_manager.attributes_ )
             {
@@ -290,23 +354,55 @@ namespace geode
                 {
                     continue;
                 }
-                if( attribute_exists( attribute_id ) )
+                const auto attribute_it = attributes_.find( attribute_id );
+                if( attribute_it == attributes_.end() )
                 {
-                    if( attribute_from->type()
-                        != this->attributes_.at( attribute_id )->type() )
-                    {
-                        continue;
-                    }
-                    this->attributes_.at( attribute_id )
-                        ->import( old2new_mapping, attribute_from, key );
+                    to_extract.emplace_back( attribute_id, &attribute_from );
                 }
-                else
+                else if( attribute_from->type()
+                         == attribute_it->second->type() )
                 {
-                    attributes_.emplace(
-                        attribute_id, attribute_from->extract( old2new_mapping,
-                                          nb_elements_, key ) );
+                    to_import.emplace_back(
+                        attribute_it->second.get(), &attribute_from );
+                }
+            }
+            absl::FixedArray< std::shared_ptr< AttributeBase > > extracted(
+                to_extract.size() );
+            const auto import_attribute = [&]( size_t a ) {
+                if( a < to_import.size() )
+                {
+                    const auto &[attribute, attribute_from] = to_import[a];
+                    attribute->import( old2new_mapping, *attribute_from, key );
+                    return;
+                }
+                const auto e = a - to_import.size();
+                extracted[e] = ( *to_extract[e].second )
+                                   ->extract( old2new_mapping, nb_elements_,
+                                       key );
+            };
+            const auto nb_attributes = to_import.size() + to_extract.size();
+            if( nb_attributes > 1 && nb_elements_ > PARALLEL_THRESHOLD )
+            {
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, nb_attributes ),
+                    import_attribute );
+            }
+            else
+            {
+                for( const auto a : Range{ nb_attributes } )
+                {
+                    import_attribute( a );
                 }
             }
+            for( const auto e : Indices{ to_extract } )
+            {
+                attributes_.emplace(
+                    to_extract[e].first, std::move( extracted[e] ) );
+            }
+            if( !to_extract.empty() )
+            {
+                increment_generation();
+            }
         }
 
         template < typename T >
@@ -346,6 +442,7 @@ namespace geode
             {
                 attributes_.emplace( attribute_id,
                     it->second->extract( old2new_mapping, nb_elements_, key ) );
+                increment_generation();
             }
         }
 
@@ -434,10 +531,71 @@ namespace geode
             return mutex_;
         }
 
+        index_t generation() const
+        {
+            return generation_.load( std::memory_order_acquire );
+        }
+
+        index_t modification_count(
+            const AttributeBase::AttributeKey &key ) const
+        {
+            absl::ReaderMutexLock lock{ mutex_ };
+            bool modified{ false };
+            for( const auto &attribute_it : attributes_ )
+            {
+                // Every attribute is checked to reset its state
+                modified |= attribute_it.second->check_modification( key );
+            }
+            if( modified )
+            {
+                modifications_.fetch_add( 1, std::memory_order_release );
+            }
+            return modifications_.load( std::memory_order_acquire );
+        }
+
+        void notify_modification()
+        {
+            modifications_.fetch_add( 1, std::memory_order_release );
+        }
+
+    private:
+        template < typename Action >
+        void for_each_attribute( index_t nb_values, const Action &action )
+        {
+            if( attributes_.size() < 2 || nb_values < PARALLEL_THRESHOLD )
+            {
+                for( auto &attribute_it : attributes_ )
+                {
+                    action( *attribute_it.second );
+                }
+                return;
+            }
+            absl::FixedArray< AttributeBase * > attributes(
+                attributes_.size() );
+            index_t count{ 0 };
+            for( auto &attribute_it : attributes_ )
+            {
+                attributes[count++] = attribute_it.second.get();
+            }
+            async::parallel_for(
+                async::irange( size_t{ 0 }, attributes.size() ),
+                [&attributes, &action]( size_t a ) {
+                    action( *attributes[a] );
+                } );
+        }
+
+        void increment_generation()
+        {
+            generation_.fetch_add( 1, std::memory_order_release );
+            notify_modification();
+        }
+
     private:
         index_t nb_elements_{ 0 };
         AttributesMap attributes_;
         mutable absl::Mutex mutex_;
+        std::atomic< index_t > generation_{ 0 };
+        mutable std::atomic< index_t > modifications_{ 0 };
     };
 
     AttributeManager::AttributeManager() = default;
@@ -464,6 +622,7 @@ namespace geode
     void AttributeManager::resize( index_t size )
     {
         impl_->resize( size, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     void AttributeManager::reserve( index_t capacity )
@@ -486,6 +645,7 @@ namespace geode
     {
         impl_->assign_attribute_value(
             from_element, to_element, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     void AttributeManager::copy_attribute_value(
@@ -493,6 +653,7 @@ namespace geode
     {
         impl_->copy_attribute_value(
             from_element, to_element, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     void AttributeManager::interpolate_attribute_value(
@@ -500,6 +661,46 @@ namespace geode
     {
         impl_->interpolate_attribute_value(
             interpolation, to_element, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
+    }
+
+    void AttributeManager::assign_attribute_values(
+        absl::Span< const index_t > from_elements,
+        absl::Span< const index_t > to_elements )
+    {
+        OpenGeodeBasicException::check_exception(
+            from_elements.size() == to_elements.size(), nullptr,
+            OpenGeodeException::TYPE::data,
+            "[AttributeManager::assign_attribute_values] Number of from and "
+            "to elements should match" );
+        check_elements_range( nb_elements(), from_elements,
+            "[AttributeManager::assign_attribute_values]" );
+        check_elements_range( nb_elements(), to_elements,
+            "[AttributeManager::assign_attribute_values]" );
+        impl_->assign_attribute_values(
+            from_elements, to_elements, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
+    }
+
+    void AttributeManager::interpolate_attribute_values(
+        absl::Span< const AttributeLinearInterpolation > interpolations,
+        absl::Span< const index_t > to_elements )
+    {
+        OpenGeodeBasicException::check_exception(
+            interpolations.size() == to_elements.size(), nullptr,
+            OpenGeodeException::TYPE::data,
+            "[AttributeManager::interpolate_attribute_values] Number of "
+            "interpolations and to elements should match" );
+        check_elements_range( nb_elements(), to_elements,
+            "[AttributeManager::interpolate_attribute_values]" );
+        for( const auto& interpolation : interpolations )
+        {
+            check_elements_range( nb_elements(), interpolation.indices_,
+                "[AttributeManager::interpolate_attribute_values]" );
+        }
+        impl_->interpolate_attribute_values(
+            interpolations, to_elements, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     absl::FixedArray< geode::uuid > AttributeManager::attribute_ids() const
@@ -532,6 +733,7 @@ namespace geode
     void AttributeManager::clear_attributes()
     {
         impl_->clear_attributes( AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     void AttributeManager::delete_elements(
@@ -544,6 +746,7 @@ namespace geode
                 "[AttributeManager::delete_elements] Vector to_delete should "
                 "have the same size as the number of elements" );
             impl_->delete_elements( to_delete, AttributeBase::AttributeKey{} );
+            impl_->notify_modification();
         }
     }
 
@@ -551,6 +754,7 @@ namespace geode
         absl::Span< const index_t > permutation )
     {
         impl_->permute_elements( permutation, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     index_t AttributeManager::nb_elements() const
@@ -558,9 +762,25 @@ namespace geode
         return impl_->nb_elements();
     }
 
+    index_t AttributeManager::generation() const
+    {
+        return impl_->generation();
+    }
+
+    index_t AttributeManager::modification_count() const
+    {
+        return impl_->modification_count( AttributeBase::AttributeKey{} );
+    }
+
+    void AttributeManager::notify_modification()
+    {
+        impl_->notify_modification();
+    }
+
     void AttributeManager::copy( const AttributeManager &attribute_manager )
     {
         impl_->copy( *attribute_manager.impl_, AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     std::optional< std::vector< geode::uuid > >
@@ -575,6 +795,7 @@ namespace geode
     {
         impl_->import( *attribute_manager.impl_, old2new_mapping,
             AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     void AttributeManager::import( const AttributeManager &attribute_manager,
@@ -583,12 +804,14 @@ namespace geode
     {
         impl_->import( *attribute_manager.impl_, old2new_mapping, attribute_id,
             AttributeBase::AttributeKey{} );
+        impl_->notify_modification();
     }
 
     void AttributeManager::set_attribute_properties(
         geode::uuid attribute_id, const AttributeProperties &new_properties )
     {
         impl_->set_attribute_properties( attribute_id, new_properties );
+        impl_->notify_modification();
     }
 
     absl::Mutex &AttributeManager::mutex() const
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/compression.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <vector>
+
+#include <async++.h>
+
+#include <zlib.h>
+
+#include <geode/basic/range.hpp>
+
+namespace
+{
+    constexpr std::string_view MAGIC{ "OGZB" };
+    constexpr std::uint8_t VERSION{ 1 };
+    /* index_t and float are the most common values of native files */
+    constexpr std::uint8_t SHUFFLE_STRIDE{ sizeof( geode::index_t ) };
+    constexpr std::uint32_t BLOCK_SIZE{ 1 << 20 };
+    constexpr std::size_t HEADER_SIZE{ MAGIC.size() + 4 + 8 + 4 + 4 };
+
+    std::atomic< bool > native_compression{ false };
+
+    template < typename Integer >
+    void write_integer( std::string& buffer, Integer value )
+    {
+        for( const auto byte : geode::Range{ sizeof( Integer ) } )
+        {
+            buffer.push_back(
+                static_cast< char >( ( value >> ( 8 * byte ) ) & 0xFF ) );
+        }
+    }
+
+    template < typename Integer >
+    Integer read_integer( std::string_view buffer, std::size_t& offset )
+    {
+        geode::OpenGeodeBasicException::check_exception(
+            offset + sizeof( Integer ) <= buffer.size(), nullptr,
+            geode::OpenGeodeException::TYPE::data,
+            "[decompress_buffer] Truncated compressed buffer" );
+        Integer value{ 0 };
+        for( const auto byte : geode::Range{ sizeof( Integer ) } )
+        {
+            value |= static_cast< Integer >(
+                         static_cast< unsigned char >( buffer[offset + byte] ) )
+                     << ( 8 * byte );
+        }
+        offset += sizeof( Integer );
+        return value;
+    }
+
+    /* Groups the i-th bytes of each value together: smooth arrays (indices,
+     * coordinates) turn into long runs that zlib compresses well */
+    std::string shuffle( std::string_view block, std::uint8_t stride )
+    {
+        std::string result( block.size(), '\0' );
+        const auto nb_values = block.size() / stride;
+        for( const auto lane : geode::Range{ stride } )
+        {
+            for( const auto value : geode::Range{ nb_values } )
+            {
+                result[lane * nb_values + value] =
+                    block[value * stride + lane];
+            }
+        }
+        const auto tail = nb_values * stride;
+        std::memcpy(
+            result.data() + tail, block.data() + tail, block.size() - tail );
+        return result;
+    }
+
+    void unshuffle(
+        std::string_view block, std::uint8_t stride, char* destination )
+    {
+        const auto nb_values = block.size() / stride;
+        for( const auto lane : geode::Range{ stride } )
+        {
+            for( const auto value : geode::Range{ nb_values } )
+            {
+                destination[value * stride + lane] =
+                    block[lane * nb_values + value];
+            }
+        }
+        const auto tail = nb_values * stride;
+        std::memcpy(
+            destination + tail, block.data() + tail, block.size() - tail );
+    }
+
+    std::string compress_block( std::string_view block )
+    {
+        const auto shuffled = shuffle( block, SHUFFLE_STRIDE );
+        auto compressed_size = compressBound( shuffled.size() );
+        std::string compressed( compressed_size, '\0' );
+        const auto status = compress2(
+            reinterpret_cast< Bytef* >( compressed.data() ), &compressed_size,
+            reinterpret_cast< const Bytef* >( shuffled.data() ),
+            shuffled.size(), Z_DEFAULT_COMPRESSION );
+        geode::OpenGeodeBasicException::check_exception( status == Z_OK,
+            nullptr, geode::OpenGeodeException::TYPE::internal,
+            "[compress_buffer] Failed to compress block (zlib error ", status,
+            ")" );
+        compressed.resize( compressed_size );
+        return compressed;
+    }
+
+    void decompress_block( std::string_view block,
+        std::uint8_t stride,
+        std::size_t block_size,
+        char* destination )
+    {
+        std::string shuffled( block_size, '\0' );
+        auto decompressed_size = static_cast< uLongf >( block_size );
+        const auto status =
+            uncompress( reinterpret_cast< Bytef* >( shuffled.data() ),
+                &decompressed_size,
+                reinterpret_cast< const Bytef* >( block.data() ),
+                block.size() );
+        geode::OpenGeodeBasicException::check_exception(
+            status == Z_OK && decompressed_size == block_size, nullptr,
+            geode::OpenGeodeException::TYPE::data,
+            "[decompress_buffer] Failed to decompress block (zlib error ",
+            status, ")" );
+        unshuffle( shuffled, stride, destination );
+    }
+} // namespace
+
+namespace geode
+{
+    std::string compress_buffer( std::string_view buffer )
+    {
+        const auto nb_blocks = static_cast< std::uint32_t >(
+            ( buffer.size() + BLOCK_SIZE - 1 ) / BLOCK_SIZE );
+        std::vector< std::string > blocks( nb_blocks );
+        async::parallel_for( async::irange( std::uint32_t{ 0 }, nb_blocks ),
+            [&buffer, &blocks]( std::uint32_t block ) {
+                blocks[block] = compress_block(
+                    buffer.substr( std::size_t{ block } * BLOCK_SIZE,
+                        BLOCK_SIZE ) );
+            } );
+        std::string result{ MAGIC };
+        write_integer( result, VERSION );
+        write_integer( result, SHUFFLE_STRIDE );
+        write_integer( result, std::uint16_t{ 0 } );
+        write_integer( result, static_cast< std::uint64_t >( buffer.size() ) );
+        write_integer( result, BLOCK_SIZE );
+        write_integer( result, nb_blocks );
+        for( const auto& block : blocks )
+        {
+            write_integer(
+                result, static_cast< std::uint64_t >( block.size() ) );
+        }
+        for( const auto& block : blocks )
+        {
+            result.append( block );
+        }
+        return result;
+    }
+
+    bool is_compressed_buffer( std::string_view buffer )
+    {
+        return buffer.size() >= HEADER_SIZE
+               && buffer.substr( 0, MAGIC.size() ) == MAGIC;
+    }
+
+    std::string decompress_buffer( std::string_view buffer )
+    {
+        OpenGeodeBasicException::check_exception(
+            is_compressed_buffer( buffer ), nullptr,
+            OpenGeodeException::TYPE::data,
+            "[decompress_buffer] Buffer is not compressed" );
+        std::size_t offset{ MAGIC.size() };
+        const auto version = read_integer< std::uint8_t >( buffer, offset );
+        OpenGeodeBasicException::check_exception( version <= VERSION, nullptr,
+            OpenGeodeException::TYPE::data,
+            "[decompress_buffer] Unsupported compressed buffer version ",
+            static_cast< int >( version ) );
+        const auto stride = read_integer< std::uint8_t >( buffer, offset );
+        offset += sizeof( std::uint16_t );
+        const auto raw_size = read_integer< std::uint64_t >( buffer, offset );
+        const auto block_size =
+            read_integer< std::uint32_t >( buffer, offset );
+        const auto nb_blocks = read_integer< std::uint32_t >( buffer, offset );
+        OpenGeodeBasicException::check_exception( stride > 0 && block_size > 0
+                && nb_blocks == ( raw_size + block_size - 1 ) / block_size,
+            nullptr, OpenGeodeException::TYPE::data,
+            "[decompress_buffer] Corrupted compressed buffer header" );
+        std::vector< std::size_t > block_offsets( nb_blocks + 1 );
+        block_offsets[0] = offset + std::size_t{ nb_blocks } * 8;
+        for( const auto block : Range{ nb_blocks } )
+        {
+            block_offsets[block + 1] =
+                block_offsets[block]
+                + read_integer< std::uint64_t >( buffer, offset );
+        }
+        OpenGeodeBasicException::check_exception(
+            block_offsets.back() <= buffer.size(), nullptr,
+            OpenGeodeException::TYPE::data,
+            "[decompress_buffer] Truncated compressed buffer" );
+        std::string result( raw_size, '\0' );
+        async::parallel_for( async::irange( std::uint32_t{ 0 }, nb_blocks ),
+            [&buffer, &block_offsets, &result, stride, block_size, raw_size](
+                std::uint32_t block ) {
+                const auto begin = std::size_t{ block } * block_size;
+                const auto size = std::min< std::size_t >( block_size,
+                    static_cast< std::size_t >( raw_size - begin ) );
+                decompress_block(
+                    buffer.substr( block_offsets[block],
+                        block_offsets[block + 1] - block_offsets[block] ),
+                    stride, size, result.data() + begin );
+            } );
+        return result;
+    }
+
+    std::optional< std::string > read_compressed_stream( std::istream& stream )
+    {
+        const auto position = stream.tellg();
+        std::string magic( MAGIC.size(), '\0' );
+        stream.read( magic.data(), magic.size() );
+        if( stream.gcount() != static_cast< std::streamsize >( MAGIC.size() )
+            || magic != MAGIC )
+        {
+            stream.clear();
+            stream.seekg( position );
+            return std::nullopt;
+        }
+        magic.append( std::istreambuf_iterator< char >{ stream },
+            std::istreambuf_iterator< char >{} );
+        return decompress_buffer( magic );
+    }
+
+    bool is_native_compression_enabled()
+    {
+        return native_compression.load();
+    }
+
+    void set_native_compression( bool enabled )
+    {
+        native_compression.store( enabled );
+    }
+} // namespace geode
@@ -23,13 +23,12 @@
 
 #include <geode/basic/identifier.hpp>
 
-#include <fstream>
-
 #include <bitsery/ext/std_optional.h>
 
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
+#include <geode/basic/zip_file.hpp>
 
 namespace geode
 {
@@ -59,31 +58,32 @@ namespace geode
         void save( std::string_view directory ) const
         {
             const auto filename = absl::StrCat( directory, "/identifier" );
-            std::ofstream file{ filename, std::ofstream::binary };
+            const auto file = open_output_file( filename );
             TContext context{};
             BitseryExtensions::register_serialize_pcontext(
                 std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, *file };
             archive.object( *this );
             archive.adapter().flush();
             OpenGeodeBasicException::check_exception(
                 std::get< 1 >( context ).isValid(), nullptr,
                 OpenGeodeException::TYPE::internal,
                 "[Identifier::save] Error while writing file: ", filename );
+            file->close();
         }
 
         void load( std::string_view directory )
         {
             const auto filename = absl::StrCat( directory, "/identifier" );
-            std::ifstream file{ filename, std::ifstream::binary };
-            if( !file )
+            const auto file = open_input_file( filename );
+            if( !*file )
             {
                 return;
             }
             TContext context{};
             BitseryExtensions::register_deserialize_pcontext(
                 std::get< 0 >( context ) );
-            Deserializer archive{ context, file };
+            Deserializer archive{ context, *file };
             archive.object( *this );
             const auto& adapter = archive.adapter();
             OpenGeodeBasicException::check_exception(
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/mapped_file.hpp>
+
+#include <atomic>
+
+#ifdef OPENGEODE_WINDOWS
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/string.hpp>
+
+namespace
+{
+    std::atomic< bool > native_mapping{ false };
+} // namespace
+
+namespace geode
+{
+#ifdef OPENGEODE_WINDOWS
+    class MappedFile::Impl
+    {
+    public:
+        explicit Impl( std::string_view filename )
+        {
+            const auto file_name = to_string( filename );
+            // Mapped files can still be removed, e.g. temporary directories
+            file_ = CreateFileA( file_name.c_str(), GENERIC_READ,
+                FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL, nullptr );
+            check( file_ != INVALID_HANDLE_VALUE, filename );
+            LARGE_INTEGER size;
+            check( GetFileSizeEx( file_, &size ) != 0, filename );
+            size_ = static_cast< std::size_t >( size.QuadPart );
+            if( size_ == 0 )
+            {
+                return;
+            }
+            mapping_ = CreateFileMappingA(
+                file_, nullptr, PAGE_READONLY, 0, 0, nullptr );
+            check( mapping_ != nullptr, filename );
+            data_ = static_cast< const char* >(
+                MapViewOfFile( mapping_, FILE_MAP_READ, 0, 0, 0 ) );
+            check( data_ != nullptr, filename );
+        }
+
+        ~Impl()
+        {
+            release();
+        }
+
+        std::string_view content() const
+        {
+            return { data_, data_ == nullptr ? 0 : size_ };
+        }
+
+    private:
+        void check( bool condition, std::string_view filename )
+        {
+            if( !condition )
+            {
+                release();
+                throw OpenGeodeBasicException{ nullptr,
+                    OpenGeodeException::TYPE::data,
+                    "[MappedFile] Cannot map file: ", filename };
+            }
+        }
+
+        void release()
+        {
+            if( data_ != nullptr )
+            {
+                UnmapViewOfFile( data_ );
+                data_ = nullptr;
+            }
+            if( mapping_ != nullptr )
+            {
+                CloseHandle( mapping_ );
+                mapping_ = nullptr;
+            }
+            if( file_ != INVALID_HANDLE_VALUE )
+            {
+                CloseHandle( file_ );
+                file_ = INVALID_HANDLE_VALUE;
+            }
+        }
+
+    private:
+        HANDLE file_{ INVALID_HANDLE_VALUE };
+        HANDLE mapping_{ nullptr };
+        const char* data_{ nullptr };
+        std::size_t size_{ 0 };
+    };
+#else
+    class MappedFile::Impl
+    {
+    public:
+        explicit Impl( std::string_view filename )
+        {
+            const auto file_name = to_string( filename );
+            const auto file = open( file_name.c_str(), O_RDONLY );
+            OpenGeodeBasicException::check_exception( file != -1, nullptr,
+                OpenGeodeException::TYPE::data,
+                "[MappedFile] Cannot open file: ", filename );
+            struct stat status;
+            if( fstat( file, &status ) != 0 )
+            {
+                close( file );
+                throw OpenGeodeBasicException{ nullptr,
+                    OpenGeodeException::TYPE::data,
+                    "[MappedFile] Cannot read size of file: ", filename };
+            }
+            size_ = static_cast< std::size_t >( status.st_size );
+            if( size_ != 0 )
+            {
+                auto* data =
+                    mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0 );
+                if( data != MAP_FAILED )
+                {
+                    data_ = static_cast< const char* >( data );
+                }
+            }
+            // The mapping remains valid once the file is closed
+            close( file );
+            OpenGeodeBasicException::check_exception(
+                size_ == 0 || data_ != nullptr, nullptr,
+                OpenGeodeException::TYPE::data,
+                "[MappedFile] Cannot map file: ", filename );
+        }
+
+        ~Impl()
+        {
+            if( data_ != nullptr )
+            {
+                munmap( const_cast< char* >( data_ ), size_ );
+            }
+        }
+
+        std::string_view content() const
+        {
+            return { data_, data_ == nullptr ? 0 : size_ };
+        }
+
+    private:
+        const char* data_{ nullptr };
+        std::size_t size_{ 0 };
+    };
+#endif
+
+    MappedFile::MappedFile( std::string_view filename ) : impl_{ filename } {}
+
+    MappedFile::~MappedFile() = default;
+
+    std::string_view MappedFile::content() const
+    {
+        return impl_->content();
+    }
+
+    bool is_native_mapping_enabled()
+    {
+        return native_mapping.load();
+    }
+
+    void set_native_mapping( bool enabled )
+    {
+        native_mapping.store( enabled );
+    }
+} // namespace geode
@@ -23,10 +23,19 @@
 
 #include <geode/basic/zip_file.hpp>
 
+#include <algorithm>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <streambuf>
 #include <string_view>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
+
+#include <async++.h>
+
 #include <mz.h>
 #include <mz_strm.h>
 #include <mz_strm_mem.h>
@@ -34,10 +43,22 @@
 #include <mz_zip_rw.h>
 
 #include <geode/basic/logger.hpp>
+#include <geode/basic/mapped_file.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
 namespace
 {
+    /*!
+     * Memory streams address their content with 32-bit integers
+     */
+    constexpr auto MAX_MEMORY_ARCHIVE_SIZE =
+        static_cast< size_t >( std::numeric_limits< int32_t >::max() );
+
+    /*!
+     * Upper bound of the headers written with each archive entry
+     */
+    constexpr size_t ENTRY_HEADERS_SIZE{ 1024 };
+
     std::filesystem::path create_directory(
         std::string_view file, std::string_view temp_filename )
     {
@@ -47,6 +68,397 @@ namespace
         std::filesystem::create_directory( directory );
         return directory;
     }
+
+    std::filesystem::path memory_directory( std::string_view temp_filename )
+    {
+        return std::filesystem::temp_directory_path()
+               / geode::to_string( temp_filename );
+    }
+
+    /*!
+     * Archives whose files are streamed in memory, indexed by directory
+     */
+    template < typename Archive >
+    class ArchiveRegistry
+    {
+    public:
+        static void add(
+            const std::filesystem::path& directory, const Archive& archive )
+        {
+            absl::MutexLock lock{ mutex() };
+            files()[directory_key( directory )] = &archive;
+        }
+
+        static void remove( const std::filesystem::path& directory )
+        {
+            absl::MutexLock lock{ mutex() };
+            files().erase( directory_key( directory ) );
+        }
+
+        static const Archive* find( const std::filesystem::path& directory )
+        {
+            absl::MutexLock lock{ mutex() };
+            const auto it = files().find( directory_key( directory ) );
+            if( it == files().end() )
+            {
+                return nullptr;
+            }
+            return it->second;
+        }
+
+    private:
+        static std::string directory_key(
+            const std::filesystem::path& directory )
+        {
+            return directory.lexically_normal().generic_string();
+        }
+
+        static absl::flat_hash_map< std::string, const Archive* >& files()
+        {
+            static absl::flat_hash_map< std::string, const Archive* >
+                archives;
+            return archives;
+        }
+
+        static absl::Mutex& mutex()
+        {
+            static absl::Mutex registry_mutex;
+            return registry_mutex;
+        }
+    };
+    using ZipFileRegistry = ArchiveRegistry< geode::ZipFile >;
+    using UnzipFileRegistry = ArchiveRegistry< geode::UnzipFile >;
+
+    class StringBuffer : public std::streambuf
+    {
+    public:
+        const std::string& content() const
+        {
+            return content_;
+        }
+
+    private:
+        int_type overflow( int_type character ) override
+        {
+            if( !traits_type::eq_int_type( character, traits_type::eof() ) )
+            {
+                content_.push_back( traits_type::to_char_type( character ) );
+            }
+            return traits_type::not_eof( character );
+        }
+
+        std::streamsize xsputn(
+            const char* data, std::streamsize size ) override
+        {
+            content_.append( data, static_cast< size_t >( size ) );
+            return size;
+        }
+
+    private:
+        std::string content_;
+    };
+
+    /*!
+     * Output stream keeping the file content in memory and adding it to a
+     * ZipFile when closed
+     */
+    class ZipEntryStream : public geode::OutputFile
+    {
+    public:
+        ZipEntryStream( const geode::ZipFile& writer, std::string file_name )
+            : writer_( writer ), file_name_( std::move( file_name ) )
+        {
+            rdbuf( &buffer_ );
+        }
+
+        ~ZipEntryStream() override
+        {
+            if( closed_ )
+            {
+                return;
+            }
+            try
+            {
+                close();
+            }
+            catch( const geode::OpenGeodeException& exception )
+            {
+                geode::Logger::error( exception.what() );
+            }
+        }
+
+        void close() override
+        {
+            if( closed_ )
+            {
+                return;
+            }
+            closed_ = true;
+            if( fail() )
+            {
+                throw geode::OpenGeodeBasicException( nullptr,
+                    geode::OpenGeodeException::TYPE::internal,
+                    "[ZipEntryStream::close] Error while writing file ",
+                    file_name_ );
+            }
+            writer_.archive_buffer( file_name_, buffer_.content() );
+        }
+
+    private:
+        const geode::ZipFile& writer_;
+        std::string file_name_;
+        StringBuffer buffer_;
+        bool closed_{ false };
+    };
+
+    /*!
+     * Output stream writing a file on disk
+     */
+    class DiskFileStream : public geode::OutputFile
+    {
+    public:
+        explicit DiskFileStream( std::filesystem::path file )
+            : file_( std::move( file ) )
+        {
+            rdbuf( &buffer_ );
+            constexpr auto MODE =
+                std::ios::out | std::ios::binary | std::ios::trunc;
+            if( !buffer_.open( file_, MODE ) )
+            {
+                setstate( std::ios::failbit );
+            }
+        }
+
+        ~DiskFileStream() override
+        {
+            if( closed_ )
+            {
+                return;
+            }
+            try
+            {
+                close();
+            }
+            catch( const geode::OpenGeodeException& exception )
+            {
+                geode::Logger::error( exception.what() );
+            }
+        }
+
+        void close() override
+        {
+            if( closed_ )
+            {
+                return;
+            }
+            closed_ = true;
+            const auto written = !fail() && buffer_.close() != nullptr;
+            if( !written )
+            {
+                throw geode::OpenGeodeBasicException( nullptr,
+                    geode::OpenGeodeException::TYPE::internal,
+                    "[DiskFileStream::close] Error while writing file ",
+                    file_.string() );
+            }
+        }
+
+    private:
+        std::filesystem::path file_;
+        std::filebuf buffer_;
+        bool closed_{ false };
+    };
+
+    /*!
+     * Input stream reading a file content kept in memory
+     */
+    class StringInputStream : public std::istream
+    {
+    public:
+        explicit StringInputStream( std::string content )
+            : std::istream( nullptr ), buffer_( std::move( content ) )
+        {
+            rdbuf( &buffer_ );
+        }
+
+    private:
+        class Buffer : public std::streambuf
+        {
+        public:
+            explicit Buffer( std::string content )
+                : content_( std::move( content ) )
+            {
+                setg( content_.data(), content_.data(),
+                    content_.data() + content_.size() );
+            }
+
+        private:
+            pos_type seekoff( off_type offset,
+                std::ios_base::seekdir direction,
+                std::ios_base::openmode /*mode*/ ) override
+            {
+                auto* origin = eback();
+                if( direction == std::ios_base::cur )
+                {
+                    origin = gptr();
+                }
+                else if( direction == std::ios_base::end )
+                {
+                    origin = egptr();
+                }
+                const auto position = origin - eback() + offset;
+                if( position < 0 || position > egptr() - eback() )
+                {
+                    return pos_type( off_type( -1 ) );
+                }
+                setg( eback(), eback() + position, egptr() );
+                return pos_type( position );
+            }
+
+            pos_type seekpos(
+                pos_type position, std::ios_base::openmode mode ) override
+            {
+                return seekoff(
+                    off_type( position ), std::ios_base::beg, mode );
+            }
+
+        private:
+            std::string content_;
+        };
+
+    private:
+        Buffer buffer_;
+    };
+
+    /*!
+     * Read handle on a zip archive. Entries are reached directly from their
+     * central directory position, each thread uses its own handle to extract
+     * entries concurrently.
+     */
+    class ZipReader
+    {
+    public:
+        explicit ZipReader( const std::string& file )
+            : reader_{ mz_zip_reader_create() }
+        {
+            open_ = mz_zip_reader_open_file( reader_, file.c_str() ) == MZ_OK
+                    && mz_zip_reader_get_zip_handle( reader_, &zip_ ) == MZ_OK;
+        }
+
+        explicit ZipReader( absl::Span< const uint8_t > data )
+            : reader_{ mz_zip_reader_create() },
+              memory_stream_{ mz_stream_mem_create() }
+        {
+            geode::OpenGeodeBasicException::check_assertion(
+                data.size() <= MAX_MEMORY_ARCHIVE_SIZE,
+                "[ZipReader] Zip buffer is too large to be read in memory" );
+            /* the memory stream is only read, data are never modified */
+            mz_stream_mem_set_buffer( memory_stream_,
+                const_cast< uint8_t* >( data.data() ),
+                static_cast< int32_t >( data.size() ) );
+            open_ = mz_zip_reader_open( reader_, memory_stream_ ) == MZ_OK
+                    && mz_zip_reader_get_zip_handle( reader_, &zip_ ) == MZ_OK;
+        }
+
+        ZipReader( const ZipReader& ) = delete;
+        ZipReader& operator=( const ZipReader& ) = delete;
+
+        ~ZipReader()
+        {
+            mz_zip_reader_close( reader_ );
+            mz_zip_reader_delete( &reader_ );
+            if( memory_stream_ )
+            {
+                mz_stream_close( memory_stream_ );
+                mz_stream_delete( &memory_stream_ );
+            }
+        }
+
+        bool is_open() const
+        {
+            return open_;
+        }
+
+        void* zip() const
+        {
+            return zip_;
+        }
+
+        int32_t save_entry(
+            int64_t position, const std::filesystem::path& out_path )
+        {
+            std::ofstream file{ out_path, std::ofstream::binary };
+            if( !file )
+            {
+                return MZ_OPEN_ERROR;
+            }
+            auto status = mz_zip_goto_entry( zip_, position );
+            if( status == MZ_OK )
+            {
+                status = mz_zip_entry_read_open( zip_, 0, nullptr );
+            }
+            if( status != MZ_OK )
+            {
+                return status;
+            }
+            int32_t bytes_read{ 0 };
+            while( ( bytes_read = mz_zip_entry_read( zip_, buffer_.data(),
+                         static_cast< int32_t >( buffer_.size() ) ) )
+                   > 0 )
+            {
+                file.write( buffer_.data(), bytes_read );
+            }
+            const auto close_status = mz_zip_entry_close( zip_ );
+            if( bytes_read < 0 )
+            {
+                return bytes_read;
+            }
+            return file ? close_status : MZ_WRITE_ERROR;
+        }
+
+        int32_t read_entry( int64_t position, std::string& content )
+        {
+            auto status = mz_zip_goto_entry( zip_, position );
+            mz_zip_file* info = nullptr;
+            if( status == MZ_OK )
+            {
+                status = mz_zip_entry_get_info( zip_, &info );
+            }
+            if( status == MZ_OK )
+            {
+                status = mz_zip_entry_read_open( zip_, 0, nullptr );
+            }
+            if( status != MZ_OK )
+            {
+                return status;
+            }
+            content.resize( static_cast< size_t >( info->uncompressed_size ) );
+            size_t offset{ 0 };
+            int32_t bytes_read{ 0 };
+            while( offset < content.size()
+                   && ( bytes_read = mz_zip_entry_read( zip_,
+                            content.data() + offset,
+                            static_cast< int32_t >( std::min(
+                                content.size() - offset, BUFFER_SIZE ) ) ) )
+                          > 0 )
+            {
+                offset += static_cast< size_t >( bytes_read );
+            }
+            const auto close_status = mz_zip_entry_close( zip_ );
+            if( bytes_read < 0 )
+            {
+                return bytes_read;
+            }
+            return offset == content.size() ? close_status : MZ_READ_ERROR;
+        }
+
+    private:
+        static constexpr size_t BUFFER_SIZE{ 1024 * 1024 };
+        void* reader_{ nullptr };
+        void* memory_stream_{ nullptr };
+        void* zip_{ nullptr };
+        bool open_{ false };
+        std::vector< char > buffer_ = std::vector< char >( BUFFER_SIZE );
+    };
 } // namespace
 
 namespace geode
@@ -70,12 +482,34 @@ namespace geode
             }
         }
 
+        explicit Impl( std::string_view archive_temp_filename )
+        {
+            directory_ = memory_directory( archive_temp_filename );
+            std::filesystem::create_directory( directory_ );
+            memory_stream_ = mz_stream_mem_create();
+            mz_stream_mem_set_grow_size( memory_stream_, MEMORY_GROW_SIZE );
+            mz_stream_open( memory_stream_, nullptr, MZ_OPEN_MODE_CREATE );
+            writer_ = mz_zip_writer_create();
+            mz_zip_writer_set_compress_method(
+                writer_, MZ_COMPRESS_METHOD_STORE );
+            const auto status =
+                mz_zip_writer_open( writer_, memory_stream_, 0 );
+            if( status != MZ_OK )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[ZipFile] Error opening zip for writing in memory (",
+                    status, ")" );
+            }
+        }
+
         ~Impl()
         {
-            if( writer_ )
+            close_writer();
+            if( memory_stream_ )
             {
-                mz_zip_writer_close( writer_ );
-                mz_zip_writer_delete( &writer_ );
+                mz_stream_close( memory_stream_ );
+                mz_stream_delete( &memory_stream_ );
             }
             std::filesystem::remove_all( directory_ );
         }
@@ -91,6 +525,13 @@ namespace geode
         void archive_file( std::string_view file ) const
         {
             const std::filesystem::path file_path{ to_string( file ) };
+            absl::MutexLock lock{ mutex_ };
+            if( memory_stream_ )
+            {
+                check_memory_size( std::filesystem::file_size( file_path )
+                                       + file_path.string().size(),
+                    "archive_file" );
+            }
             const auto status = mz_zip_writer_add_path(
                 writer_, file_path.string().c_str(), nullptr, 0, 1 );
             if( status != MZ_OK )
@@ -103,23 +544,189 @@ namespace geode
             std::filesystem::remove( file_path );
         }
 
+        void archive_buffer(
+            std::string_view file_name, std::string_view content ) const
+        {
+            const auto name = to_string( file_name );
+            mz_zip_file file_info{};
+            file_info.version_madeby = MZ_VERSION_MADEBY;
+            file_info.compression_method = MZ_COMPRESS_METHOD_STORE;
+            file_info.filename = name.c_str();
+            file_info.modified_date = std::time( nullptr );
+            file_info.uncompressed_size =
+                static_cast< int64_t >( content.size() );
+            absl::MutexLock lock{ mutex_ };
+            check_memory_size( content.size() + name.size(), "archive_buffer" );
+            auto status = mz_zip_writer_entry_open( writer_, &file_info );
+            size_t offset{ 0 };
+            while( status == MZ_OK && offset < content.size() )
+            {
+                const auto length = static_cast< int32_t >(
+                    std::min( content.size() - offset, MAX_CHUNK_SIZE ) );
+                const auto written = mz_zip_writer_entry_write(
+                    writer_, content.data() + offset, length );
+                if( written != length )
+                {
+                    status = written < 0 ? written : MZ_STREAM_ERROR;
+                }
+                offset += length;
+            }
+            const auto close_status = mz_zip_writer_entry_close( writer_ );
+            if( status == MZ_OK )
+            {
+                status = close_status;
+            }
+            if( status != MZ_OK )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[ZipFile::archive_buffer] Error adding ", file_name,
+                    " to zip (", status, ")" );
+            }
+        }
+
+        void archive_files_from( std::string_view archive,
+            absl::Span< const std::string > file_names ) const
+        {
+            auto* reader = mz_zip_reader_create();
+            auto status =
+                mz_zip_reader_open_file( reader, to_string( archive ).c_str() );
+            std::string_view failed_file;
+            if( status == MZ_OK )
+            {
+                absl::MutexLock lock{ mutex_ };
+                for( const auto& file_name : file_names )
+                {
+                    status = mz_zip_reader_locate_entry(
+                        reader, file_name.c_str(), 0 );
+                    if( status == MZ_OK )
+                    {
+                        status =
+                            mz_zip_writer_copy_from_reader( writer_, reader );
+                    }
+                    if( status != MZ_OK )
+                    {
+                        failed_file = file_name;
+                        break;
+                    }
+                }
+            }
+            mz_zip_reader_close( reader );
+            mz_zip_reader_delete( &reader );
+            if( status != MZ_OK )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[ZipFile::archive_files_from] Error copying ", failed_file,
+                    " from ", archive, " (", status, ")" );
+            }
+        }
+
+        std::string release_buffer()
+        {
+            absl::MutexLock lock{ mutex_ };
+            if( !memory_stream_ )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[ZipFile::release_buffer] Archive is not written in "
+                    "memory" );
+            }
+            const auto status = close_writer();
+            if( status != MZ_OK )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[ZipFile::release_buffer] Error closing zip (", status,
+                    ")" );
+            }
+            const auto size = mz_stream_tell( memory_stream_ );
+            OpenGeodeBasicException::check_exception(
+                size >= 0
+                    && static_cast< size_t >( size )
+                           <= MAX_MEMORY_ARCHIVE_SIZE,
+                nullptr, OpenGeodeException::TYPE::data,
+                "[ZipFile::release_buffer] Archive written in memory exceeds "
+                "the maximum size of ",
+                MAX_MEMORY_ARCHIVE_SIZE, " bytes" );
+            const void* data{ nullptr };
+            int32_t length{ 0 };
+            mz_stream_mem_get_buffer( memory_stream_, &data );
+            mz_stream_mem_get_buffer_length( memory_stream_, &length );
+            return { static_cast< const char* >( data ),
+                static_cast< size_t >( length ) };
+        }
+
         std::string directory() const
         {
             return directory_.string();
         }
 
     private:
+        /*!
+         * Checks that an entry of the given size can be added to an archive
+         * written in memory
+         */
+        void check_memory_size(
+            size_t entry_size, std::string_view function ) const
+        {
+            if( !memory_stream_ )
+            {
+                return;
+            }
+            const auto written =
+                static_cast< size_t >( mz_stream_tell( memory_stream_ ) );
+            OpenGeodeBasicException::check_exception(
+                written + entry_size + ENTRY_HEADERS_SIZE
+                    <= MAX_MEMORY_ARCHIVE_SIZE,
+                nullptr, OpenGeodeException::TYPE::data, "[ZipFile::",
+                function, "] Archive written in memory cannot exceed ",
+                MAX_MEMORY_ARCHIVE_SIZE, " bytes" );
+        }
+
+        int32_t close_writer()
+        {
+            if( !writer_ )
+            {
+                return MZ_OK;
+            }
+            const auto status = mz_zip_writer_close( writer_ );
+            mz_zip_writer_delete( &writer_ );
+            writer_ = nullptr;
+            return status;
+        }
+
+    private:
+        static constexpr size_t MAX_CHUNK_SIZE{ 64 * 1024 * 1024 };
+        static constexpr int32_t MEMORY_GROW_SIZE{ 64 * 1024 * 1024 };
         std::filesystem::path directory_;
         void* writer_{ nullptr };
+        void* memory_stream_{ nullptr };
+        mutable absl::Mutex mutex_;
     };
 
     ZipFile::ZipFile(
         std::string_view file, std::string_view archive_temp_filename )
         : impl_{ file, archive_temp_filename }
     {
+        ZipFileRegistry::add( impl_->directory(), *this );
+    }
+
+    ZipFile::ZipFile( std::string_view archive_temp_filename )
+        : impl_{ archive_temp_filename }
+    {
+        ZipFileRegistry::add( impl_->directory(), *this );
+    }
+
+    ZipFile::~ZipFile()
+    {
+        ZipFileRegistry::remove( impl_->directory() );
     }
 
-    ZipFile::~ZipFile() = default;
+    std::string ZipFile::release_buffer()
+    {
+        return impl_->release_buffer();
+    }
 
     void ZipFile::archive_file( std::string_view file ) const
     {
@@ -132,6 +739,18 @@ namespace geode
         impl_->archive_files( files );
     }
 
+    void ZipFile::archive_buffer(
+        std::string_view file_name, std::string_view content ) const
+    {
+        impl_->archive_buffer( file_name, content );
+    }
+
+    void ZipFile::archive_files_from( std::string_view archive,
+        absl::Span< const std::string > file_names ) const
+    {
+        impl_->archive_files_from( archive, file_names );
+    }
+
     std::string ZipFile::directory() const
     {
         return impl_->directory();
@@ -140,79 +759,105 @@ namespace geode
     class UnzipFile::Impl
     {
     public:
-        Impl( std::string_view file, std::string_view unarchive_temp_filename )
+        Impl( std::string_view file,
+            std::string_view unarchive_temp_filename,
+            bool load_in_memory )
+            : file_( to_string( file ) )
         {
             directory_ = create_directory( file, unarchive_temp_filename );
-            if( !load_zip_into_memory( file ) || !open_reader() )
+            auto reader = open_reader( load_in_memory );
+            if( !reader->is_open() )
             {
-                Logger::info( "[UnzipFile] Couldn't open zip in memory, trying "
-                              "to open on disk, this could take more time" );
-                reader_ = nullptr;
-                memory_stream_ = nullptr;
-                if( !create_reader_from_disk( file ) )
-                {
-                    std::filesystem::remove_all( directory_ );
-                    throw OpenGeodeBasicException( nullptr,
-                        OpenGeodeException::TYPE::internal,
-                        "[UnzipFile] Error opening zip for reading" );
-                }
+                std::filesystem::remove_all( directory_ );
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[UnzipFile] Error opening zip for reading" );
             }
+            index_entries( *reader );
+            release_reader( std::move( reader ) );
+        }
+
+        Impl( absl::Span< const uint8_t > buffer,
+            std::string_view unarchive_temp_filename )
+            : streamed_{ true }
+        {
+            OpenGeodeBasicException::check_exception(
+                buffer.size() <= MAX_MEMORY_ARCHIVE_SIZE, nullptr,
+                OpenGeodeException::TYPE::data,
+                "[UnzipFile] Zip buffer of ", buffer.size(),
+                " bytes exceeds the maximum size of ", MAX_MEMORY_ARCHIVE_SIZE,
+                " bytes" );
+            zip_data_.assign( buffer.begin(), buffer.end() );
+            directory_ = memory_directory( unarchive_temp_filename );
+            auto reader = std::make_unique< ZipReader >( zip_data_ );
+            if( !reader->is_open() )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[UnzipFile] Error opening zip buffer for reading" );
+            }
+            index_entries( *reader );
+            release_reader( std::move( reader ) );
         }
 
         ~Impl()
         {
-            if( reader_ )
+            std::filesystem::remove_all( directory_ );
+        }
+
+        void extract_all() const
+        {
+            if( streamed_ )
             {
-                mz_zip_reader_close( reader_ );
-                mz_zip_reader_delete( &reader_ );
-                reader_ = nullptr;
+                return;
             }
-            if( memory_stream_ )
+            async::parallel_for( async::irange( size_t{ 0 }, entries_.size() ),
+                [this]( size_t entry ) {
+                    extract_entry( entries_[entry] );
+                } );
+        }
+
+        std::string extract_file( std::string_view file_name ) const
+        {
+            return extract_entry( find_entry( file_name ) );
+        }
+
+        std::string read_file( std::string_view file_name ) const
+        {
+            const auto& entry = find_entry( file_name );
+            std::string content;
+            auto reader = acquire_reader();
+            const auto status = reader->read_entry( entry.position, content );
+            release_reader( std::move( reader ) );
+            if( status != MZ_OK )
             {
-                mz_stream_close( memory_stream_ );
-                mz_stream_delete( &memory_stream_ );
-                memory_stream_ = nullptr;
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[UnzipFile::read_file] Error reading ", file_name, " (",
+                    status, ")" );
             }
-            std::filesystem::remove_all( directory_ );
+            return content;
         }
 
-        void extract_all() const
+        bool has_file( std::string_view file_name ) const
         {
-            constexpr size_t BUF_SIZE = 1024 * 1024; // 1 MB
-            std::vector< uint8_t > buffer( BUF_SIZE );
-            int status = mz_zip_reader_goto_first_entry( reader_ );
-            while( status == MZ_OK )
+            return entry_ids_.contains( file_name );
+        }
+
+        bool is_streamed() const
+        {
+            return streamed_;
+        }
+
+        std::vector< std::string > file_names() const
+        {
+            std::vector< std::string > names;
+            names.reserve( entries_.size() );
+            for( const auto& entry : entries_ )
             {
-                mz_zip_file* info = nullptr;
-                mz_zip_reader_entry_get_info( reader_, &info );
-                if( !info )
-                {
-                    status = mz_zip_reader_goto_next_entry( reader_ );
-                    continue;
-                }
-                auto out_path = directory_ / info->filename;
-                std::filesystem::create_directories( out_path.parent_path() );
-                FILE* file = fopen( out_path.string().c_str(), "wb" );
-                if( !file )
-                {
-                    status = mz_zip_reader_goto_next_entry( reader_ );
-                    continue;
-                }
-                status = mz_zip_reader_entry_open( reader_ );
-                if( status == MZ_OK )
-                {
-                    int32_t bytes_read = 0;
-                    while( ( bytes_read = mz_zip_reader_entry_read(
-                                 reader_, buffer.data(), BUF_SIZE ) )
-                           > 0 )
-                    {
-                        fwrite( buffer.data(), 1, bytes_read, file );
-                    }
-                    mz_zip_reader_entry_close( reader_ );
-                }
-                fclose( file );
-                status = mz_zip_reader_goto_next_entry( reader_ );
+                names.push_back( entry.name );
             }
+            return names;
         }
 
         std::string directory() const
@@ -221,59 +866,200 @@ namespace geode
         }
 
     private:
-        bool load_zip_into_memory( std::string_view file )
+        struct ZipEntry
+        {
+            std::string name;
+            int64_t position;
+            bool is_directory;
+        };
+
+        std::unique_ptr< ZipReader > open_reader( bool load_in_memory )
+        {
+            if( load_in_memory )
+            {
+                if( load_zip_into_memory() )
+                {
+                    auto reader = std::make_unique< ZipReader >( zip_data_ );
+                    if( reader->is_open() )
+                    {
+                        return reader;
+                    }
+                }
+                Logger::info( "[UnzipFile] Couldn't open zip in memory, trying "
+                              "to open on disk, this could take more time" );
+                zip_data_.clear();
+                zip_data_.shrink_to_fit();
+            }
+            return std::make_unique< ZipReader >( file_ );
+        }
+
+        bool load_zip_into_memory()
         {
-            std::ifstream ifs(
-                to_string( file ), std::ios::binary | std::ios::ate );
+            std::ifstream ifs( file_, std::ios::binary | std::ios::ate );
             if( !ifs.is_open() )
             {
                 return false;
             }
             auto size = ifs.tellg();
+            if( static_cast< size_t >( size ) > MAX_MEMORY_ARCHIVE_SIZE )
+            {
+                return false;
+            }
             zip_data_.resize( static_cast< size_t >( size ) );
             ifs.seekg( 0 );
             ifs.read( reinterpret_cast< char* >( zip_data_.data() ), size );
             return ifs.good();
         }
 
-        bool open_reader()
+        void index_entries( const ZipReader& reader )
         {
-            memory_stream_ = mz_stream_mem_create();
-            mz_stream_mem_set_buffer( memory_stream_,
-                static_cast< void* >( zip_data_.data() ),
-                static_cast< int32_t >( zip_data_.size() ) );
-            reader_ = mz_zip_reader_create();
-            return mz_zip_reader_open( reader_, memory_stream_ ) == MZ_OK;
+            auto status = mz_zip_goto_first_entry( reader.zip() );
+            while( status == MZ_OK )
+            {
+                mz_zip_file* info = nullptr;
+                if( mz_zip_entry_get_info( reader.zip(), &info ) == MZ_OK
+                    && info )
+                {
+                    entry_ids_.emplace( info->filename, entries_.size() );
+                    entries_.push_back( { info->filename,
+                        mz_zip_get_entry( reader.zip() ),
+                        mz_zip_entry_is_dir( reader.zip() ) == MZ_OK } );
+                }
+                status = mz_zip_goto_next_entry( reader.zip() );
+            }
+        }
+
+        std::unique_ptr< ZipReader > acquire_reader() const
+        {
+            {
+                absl::MutexLock lock{ readers_mutex_ };
+                if( !readers_.empty() )
+                {
+                    auto reader = std::move( readers_.back() );
+                    readers_.pop_back();
+                    return reader;
+                }
+            }
+            auto reader = zip_data_.empty()
+                              ? std::make_unique< ZipReader >( file_ )
+                              : std::make_unique< ZipReader >( zip_data_ );
+            if( !reader->is_open() )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[UnzipFile] Error opening zip for reading" );
+            }
+            return reader;
         }
 
-        bool create_reader_from_disk( std::string_view file )
+        void release_reader( std::unique_ptr< ZipReader > reader ) const
         {
-            reader_ = mz_zip_reader_create();
-            return mz_zip_reader_open_file( reader_, to_string( file ).c_str() )
-                   == MZ_OK;
+            absl::MutexLock lock{ readers_mutex_ };
+            readers_.push_back( std::move( reader ) );
+        }
+
+        const ZipEntry& find_entry( std::string_view file_name ) const
+        {
+            const auto entry = entry_ids_.find( file_name );
+            if( entry == entry_ids_.end() )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[UnzipFile] No file named ", file_name, " in archive" );
+            }
+            return entries_[entry->second];
+        }
+
+        std::string extract_entry( const ZipEntry& entry ) const
+        {
+            auto out_path = directory_ / entry.name;
+            if( streamed_ )
+            {
+                return out_path.string();
+            }
+            if( entry.is_directory )
+            {
+                std::filesystem::create_directories( out_path );
+                return out_path.string();
+            }
+            std::filesystem::create_directories( out_path.parent_path() );
+            auto reader = acquire_reader();
+            const auto status = reader->save_entry( entry.position, out_path );
+            release_reader( std::move( reader ) );
+            if( status != MZ_OK )
+            {
+                throw OpenGeodeBasicException( nullptr,
+                    OpenGeodeException::TYPE::internal,
+                    "[UnzipFile::extract_file] Error extracting ", entry.name,
+                    " (", status, ")" );
+            }
+            return out_path.string();
         }
 
     private:
         std::filesystem::path directory_;
+        std::string file_;
         std::vector< uint8_t > zip_data_;
-
-        void* reader_{ nullptr };
-        void* memory_stream_{ nullptr };
+        std::vector< ZipEntry > entries_;
+        absl::flat_hash_map< std::string, size_t > entry_ids_;
+        bool streamed_{ false };
+        mutable std::vector< std::unique_ptr< ZipReader > > readers_;
+        mutable absl::Mutex readers_mutex_;
     };
 
     UnzipFile::UnzipFile(
         std::string_view filename, std::string_view unarchive_temp_filename )
-        : impl_{ filename, unarchive_temp_filename }
+        : UnzipFile( filename, unarchive_temp_filename, true )
+    {
+    }
+
+    UnzipFile::UnzipFile( std::string_view filename,
+        std::string_view unarchive_temp_filename,
+        bool load_in_memory )
+        : impl_{ filename, unarchive_temp_filename, load_in_memory }
     {
     }
 
-    UnzipFile::~UnzipFile() = default;
+    UnzipFile::UnzipFile( absl::Span< const uint8_t > buffer,
+        std::string_view unarchive_temp_filename )
+        : impl_{ buffer, unarchive_temp_filename }
+    {
+        UnzipFileRegistry::add( impl_->directory(), *this );
+    }
+
+    UnzipFile::~UnzipFile()
+    {
+        if( impl_->is_streamed() )
+        {
+            UnzipFileRegistry::remove( impl_->directory() );
+        }
+    }
 
     void UnzipFile::extract_all() const
     {
         impl_->extract_all();
     }
 
+    std::string UnzipFile::extract_file( std::string_view file_name ) const
+    {
+        return impl_->extract_file( file_name );
+    }
+
+    bool UnzipFile::has_file( std::string_view file_name ) const
+    {
+        return impl_->has_file( file_name );
+    }
+
+    std::string UnzipFile::read_file( std::string_view file_name ) const
+    {
+        return impl_->read_file( file_name );
+    }
+
+    std::vector< std::string > UnzipFile::file_names() const
+    {
+        return impl_->file_names();
+    }
+
     std::string UnzipFile::directory() const
     {
         return impl_->directory();
@@ -288,4 +1074,51 @@ namespace geode
         mz_zip_reader_delete( &reader );
         return status == MZ_OK;
     }
+
+    OutputFile::OutputFile() : std::ostream( nullptr ) {}
+
+    OutputFile::~OutputFile() = default;
+
+    std::unique_ptr< OutputFile > open_output_file( std::string_view file )
+    {
+        std::filesystem::path file_path{ to_string( file ) };
+        if( const auto* zip_file =
+                ZipFileRegistry::find( file_path.parent_path() ) )
+        {
+            return std::make_unique< ZipEntryStream >(
+                *zip_file, file_path.filename().string() );
+        }
+        return std::make_unique< DiskFileStream >( std::move( file_path ) );
+    }
+
+    std::unique_ptr< std::istream > open_input_file( std::string_view file )
+    {
+        const std::filesystem::path file_path{ to_string( file ) };
+        if( const auto* unzip_file =
+                UnzipFileRegistry::find( file_path.parent_path() ) )
+        {
+            const auto file_name = file_path.filename().string();
+            if( !unzip_file->has_file( file_name ) )
+            {
+                auto stream = std::make_unique< StringInputStream >( "" );
+                stream->setstate( std::ios::failbit );
+                return stream;
+            }
+            return std::make_unique< StringInputStream >(
+                unzip_file->read_file( file_name ) );
+        }
+        return std::make_unique< std::ifstream >(
+            file_path, std::ifstream::binary );
+    }
+
+    std::shared_ptr< const MappedFile > map_input_file( std::string_view file )
+    {
+        const std::filesystem::path file_path{ to_string( file ) };
+        if( UnzipFileRegistry::find( file_path.parent_path() )
+            || !std::filesystem::is_regular_file( file_path ) )
+        {
+            return nullptr;
+        }
+        return std::make_shared< const MappedFile >( file );
+    }
 } // namespace geode
@@ -38,6 +38,11 @@
 #include <algorithm>
 #include <numeric>
 
+namespace
+{
+    constexpr size_t BATCH_CHUNK_SIZE{ 1024 };
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -89,6 +94,63 @@ namespace geode
         return result;
     }
 
+    template < index_t dimension >
+    typename AABBTree< dimension >::BoxesBatch
+        AABBTree< dimension >::containing_boxes(
+            absl::Span< const Point< dimension > > queries ) const
+    {
+        BoxesBatch result;
+        result.offsets.resize( queries.size() + 1, 0 );
+        if( nb_bboxes() == 0 || queries.empty() )
+        {
+            return result;
+        }
+        const auto order = morton_mapping< dimension >( queries );
+        const auto nb_chunks =
+            ( order.size() + BATCH_CHUNK_SIZE - 1 ) / BATCH_CHUNK_SIZE;
+        std::vector< std::vector< index_t > > chunk_boxes( nb_chunks );
+        std::vector< index_t > nb_query_boxes( queries.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, nb_chunks ),
+            [this, &queries, &order, &chunk_boxes, &nb_query_boxes](
+                size_t chunk ) {
+                auto& boxes = chunk_boxes[chunk];
+                const auto end = std::min(
+                    ( chunk + 1 ) * BATCH_CHUNK_SIZE, order.size() );
+                for( auto i = chunk * BATCH_CHUNK_SIZE; i < end; i++ )
+                {
+                    const auto query_id = order[i];
+                    const auto nb_previous_boxes = boxes.size();
+                    impl_->containing_boxes_recursive( Impl::ROOT_INDEX, 0,
+                        nb_bboxes(), queries[query_id], boxes );
+                    nb_query_boxes[query_id] =
+                        static_cast< index_t >( boxes.size() )
+                        - static_cast< index_t >( nb_previous_boxes );
+                }
+            } );
+        for( const auto q : Indices{ queries } )
+        {
+            result.offsets[q + 1] = result.offsets[q] + nb_query_boxes[q];
+        }
+        result.boxes.resize( result.offsets.back() );
+        async::parallel_for( async::irange( size_t{ 0 }, nb_chunks ),
+            [&order, &chunk_boxes, &nb_query_boxes, &result]( size_t chunk ) {
+                const auto& boxes = chunk_boxes[chunk];
+                const auto end = std::min(
+                    ( chunk + 1 ) * BATCH_CHUNK_SIZE, order.size() );
+                auto position = boxes.begin();
+                for( auto i = chunk * BATCH_CHUNK_SIZE; i < end; i++ )
+                {
+                    const auto query_id = order[i];
+                    const auto next_position =
+                        position + nb_query_boxes[query_id];
+                    std::copy( position, next_position,
+                        result.boxes.begin() + result.offsets[query_id] );
+                    position = next_position;
+                }
+            } );
+        return result;
+    }
+
     template class opengeode_geometry_api AABBTree< 1 >;
     template class opengeode_geometry_api AABBTree< 2 >;
     template class opengeode_geometry_api AABBTree< 3 >;
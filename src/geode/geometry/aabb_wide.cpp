@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/aabb_wide.hpp>
+
+#include <async++.h>
+
+#include <absl/container/fixed_array.h>
+
+#include <geode/geometry/points_sort.hpp>
+
+namespace
+{
+    template < geode::local_index_t width >
+    geode::index_t part_begin(
+        geode::index_t nb_elements, geode::local_index_t part )
+    {
+        return static_cast< geode::index_t >(
+            static_cast< std::uint64_t >( nb_elements ) * part / width );
+    }
+
+    template < geode::local_index_t width >
+    geode::index_t count_nodes( geode::index_t nb_elements,
+        absl::flat_hash_map< geode::index_t, geode::index_t >& nb_nodes )
+    {
+        if( const auto it = nb_nodes.find( nb_elements );
+            it != nb_nodes.end() )
+        {
+            return it->second;
+        }
+        geode::index_t count{ 1 };
+        if( nb_elements > width )
+        {
+            for( const auto c : geode::LRange{ width } )
+            {
+                const auto part_size = part_begin< width >( nb_elements, c + 1 )
+                                       - part_begin< width >( nb_elements, c );
+                if( part_size > 1 )
+                {
+                    count += count_nodes< width >( part_size, nb_nodes );
+                }
+            }
+        }
+        nb_nodes.emplace( nb_elements, count );
+        return count;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    AABBTreeWide< dimension >::Impl::Impl(
+        absl::Span< const BoundingBox< dimension > > bboxes )
+        : nb_bboxes_( bboxes.size() )
+    {
+        if( bboxes.empty() )
+        {
+            return;
+        }
+        absl::FixedArray< Point< dimension > > points( bboxes.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, bboxes.size() ),
+            [&bboxes, &points]( size_t i ) {
+                points[i] = bboxes[i].min() + bboxes[i].max();
+            } );
+        const auto mapping = morton_mapping< dimension >( points );
+        absl::flat_hash_map< index_t, index_t > nb_nodes;
+        nodes_.resize( count_nodes< WIDTH >( nb_bboxes_, nb_nodes ) );
+        bbox_ =
+            build_node( bboxes, mapping, nb_nodes, ROOT_INDEX, 0, nb_bboxes_ );
+    }
+
+    template < index_t dimension >
+    BoundingBox< dimension > AABBTreeWide< dimension >::Impl::build_node(
+        absl::Span< const BoundingBox< dimension > > bboxes,
+        absl::Span< const index_t > mapping,
+        const absl::flat_hash_map< index_t, index_t >& nb_nodes,
+        index_t node_id,
+        index_t element_begin,
+        index_t element_end )
+    {
+        auto& node = nodes_[node_id];
+        const auto nb_elements = element_end - element_begin;
+        std::array< BoundingBox< dimension >, WIDTH > boxes;
+        if( nb_elements <= WIDTH )
+        {
+            node.nb_children = static_cast< local_index_t >( nb_elements );
+            for( const auto c : LRange{ node.nb_children } )
+            {
+                node.children[c] = mapping[element_begin + c];
+                node.is_leaf[c] = true;
+                boxes[c] = bboxes[node.children[c]];
+            }
+        }
+        else
+        {
+            node.nb_children = WIDTH;
+            auto next_node = node_id + 1;
+            for( const auto c : LRange{ WIDTH } )
+            {
+                const auto begin =
+                    element_begin + part_begin< WIDTH >( nb_elements, c );
+                const auto end =
+                    element_begin + part_begin< WIDTH >( nb_elements, c + 1 );
+                node.is_leaf[c] = end - begin == 1;
+                if( node.is_leaf[c] )
+                {
+                    node.children[c] = mapping[begin];
+                    boxes[c] = bboxes[node.children[c]];
+                    continue;
+                }
+                node.children[c] = next_node;
+                next_node += nb_nodes.at( end - begin );
+            }
+            const auto build_child = [this, &bboxes, &mapping, &nb_nodes,
+                                         &node, &boxes, element_begin,
+                                         nb_elements]( local_index_t c ) {
+                if( node.is_leaf[c] )
+                {
+                    return;
+                }
+                boxes[c] = build_node( bboxes, mapping, nb_nodes,
+                    node.children[c],
+                    element_begin + part_begin< WIDTH >( nb_elements, c ),
+                    element_begin
+                        + part_begin< WIDTH >( nb_elements, c + 1 ) );
+            };
+            if( nb_elements > PARALLEL_BUILD_THRESHOLD )
+            {
+                async::parallel_for(
+                    async::irange( local_index_t{ 0 }, WIDTH ), build_child );
+            }
+            else
+            {
+                for( const auto c : LRange{ WIDTH } )
+                {
+                    build_child( c );
+                }
+            }
+        }
+        BoundingBox< dimension > node_box;
+        for( const auto d : LRange{ dimension } )
+        {
+            node.min[d].fill( std::numeric_limits< double >::max() );
+            node.max[d].fill( std::numeric_limits< double >::lowest() );
+        }
+        for( const auto c : LRange{ node.nb_children } )
+        {
+            for( const auto d : LRange{ dimension } )
+            {
+                node.min[d][c] = boxes[c].min().value( d );
+                node.max[d][c] = boxes[c].max().value( d );
+            }
+            node_box.add_box( boxes[c] );
+        }
+        return node_box;
+    }
+
+    template < index_t dimension >
+    AABBTreeWide< dimension >::AABBTreeWide() = default;
+
+    template < index_t dimension >
+    AABBTreeWide< dimension >::AABBTreeWide(
+        absl::Span< const BoundingBox< dimension > > bboxes )
+        : impl_{ bboxes }
+    {
+    }
+
+    template < index_t dimension >
+    AABBTreeWide< dimension >::AABBTreeWide( AABBTreeWide&& ) noexcept =
+        default;
+
+    template < index_t dimension >
+    AABBTreeWide< dimension >::~AABBTreeWide() = default;
+
+    template < index_t dimension >
+    AABBTreeWide< dimension >& AABBTreeWide< dimension >::operator=(
+        AABBTreeWide&& ) noexcept = default;
+
+    template < index_t dimension >
+    index_t AABBTreeWide< dimension >::nb_bboxes() const
+    {
+        return impl_->nb_bboxes();
+    }
+
+    template < index_t dimension >
+    const BoundingBox< dimension >&
+        AABBTreeWide< dimension >::bounding_box() const
+    {
+        OpenGeodeGeometryException::check_exception( impl_->nb_bboxes() != 0,
+            nullptr, OpenGeodeException::TYPE::data,
+            "[AABBTreeWide::bounding_box] Cannot return "
+            "the bounding_box of an empty AABBTreeWide." );
+        return impl_->bounding_box();
+    }
+
+    template < index_t dimension >
+    std::vector< index_t > AABBTreeWide< dimension >::containing_boxes(
+        const Point< dimension >& query ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return {};
+        }
+        std::vector< index_t > result;
+        impl_->containing_boxes( query, result );
+        return result;
+    }
+
+    template class opengeode_geometry_api AABBTreeWide< 2 >;
+    template class opengeode_geometry_api AABBTreeWide< 3 >;
+} // namespace geode
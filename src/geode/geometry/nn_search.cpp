@@ -27,7 +27,9 @@
 #include <geode/geometry/frame.hpp>
 #include <geode/geometry/intersection.hpp>
 
-#include <mutex>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <numeric>
 
 #include <absl/algorithm/container.h>
@@ -125,37 +127,102 @@ namespace geode
             return results;
         }
 
-        template < typename EpsilonType >
-        typename geode::NNSearch< dimension >::ColocatedInfo
-            colocated_index_mapping(
-                const geode::NNSearch< dimension >& nn_search,
-                const EpsilonType& epsilon ) const
+        void nearest_vertices( absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors,
+            typename NNSearch< dimension >::NeighborsBatch& results ) const
         {
-            typename NNSearch< dimension >::ColocatedInfo result;
-            const auto nb_points = nn_search.nb_points();
-            std::vector< index_t > mapping( nb_points, NO_ID );
-            std::mutex mutex;
-            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
-                [&epsilon, &mapping, &mutex, this]( index_t point_id ) {
-                    if( mapping[point_id] != NO_ID )
+            const auto nb_queries = points.size();
+            const auto stride = std::min( nb_neighbors, nb_points() );
+            results.offsets.resize( nb_queries + 1 );
+            results.neighbors.resize( nb_queries * stride );
+            results.distances.resize( nb_queries * stride );
+            async::parallel_for( async::irange( size_t{ 0 }, nb_queries ),
+                [&points, &results, stride, this]( size_t q ) {
+                    const auto offset = q * stride;
+                    results.offsets[q] = offset;
+                    if( stride == 0 )
                     {
                         return;
                     }
-                    const auto neighbor_vertices =
-                        neighbors( point( point_id ), epsilon );
-                    std::lock_guard< std::mutex > lock( mutex );
-                    if( mapping[point_id] != NO_ID )
+                    nn_tree_.knnSearch( &copy( points[q] )[0], stride,
+                        &results.neighbors[offset],
+                        &results.distances[offset] );
+                    for( const auto n : Range{ stride } )
                     {
-                        return;
+                        auto& distance = results.distances[offset + n];
+                        distance = std::sqrt( distance );
                     }
-                    for( const auto vertex_id : neighbor_vertices )
+                } );
+            results.offsets[nb_queries] = nb_queries * stride;
+        }
+
+        void neighbors( absl::Span< const Point< dimension > > points,
+            double threshold_distance,
+            typename NNSearch< dimension >::NeighborsBatch& results ) const
+        {
+            static constexpr index_t CHUNK_SIZE{ 1024 };
+            const auto nb_queries = points.size();
+            const auto nb_chunks = ( nb_queries + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+            const auto radius = threshold_distance * threshold_distance;
+            if( results.chunk_neighbors.size() < nb_chunks )
+            {
+                results.chunk_neighbors.resize( nb_chunks );
+                results.chunk_distances.resize( nb_chunks );
+            }
+            results.offsets.resize( nb_queries + 1 );
+            results.offsets[0] = 0;
+            async::parallel_for( async::irange( size_t{ 0 }, nb_chunks ),
+                [&points, &results, radius, nb_queries, this]( size_t c ) {
+                    using ResultItems = std::vector<
+                        nanoflann::ResultItem< index_t, double > >;
+                    static thread_local ResultItems query_results;
+                    nanoflann::SearchParameters params;
+                    params.sorted = true;
+                    auto& chunk_neighbors = results.chunk_neighbors[c];
+                    auto& chunk_distances = results.chunk_distances[c];
+                    chunk_neighbors.clear();
+                    chunk_distances.clear();
+                    const auto end =
+                        std::min( ( c + 1 ) * CHUNK_SIZE, nb_queries );
+                    for( const auto q : Range{ c * CHUNK_SIZE, end } )
                     {
-                        if( mapping[vertex_id] == NO_ID )
+                        results.offsets[q + 1] =
+                            nn_tree_.radiusSearch( &copy( points[q] )[0],
+                                radius, query_results, params );
+                        for( const auto& result : query_results )
                         {
-                            mapping[vertex_id] = point_id;
+                            chunk_neighbors.push_back( result.first );
+                            chunk_distances.push_back(
+                                std::sqrt( result.second ) );
                         }
                     }
                 } );
+            for( const auto q : Range{ nb_queries } )
+            {
+                results.offsets[q + 1] += results.offsets[q];
+            }
+            results.neighbors.resize( results.offsets.back() );
+            results.distances.resize( results.offsets.back() );
+            async::parallel_for( async::irange( size_t{ 0 }, nb_chunks ),
+                [&results]( size_t c ) {
+                    const auto offset = results.offsets[c * CHUNK_SIZE];
+                    absl::c_copy( results.chunk_neighbors[c],
+                        results.neighbors.begin() + offset );
+                    absl::c_copy( results.chunk_distances[c],
+                        results.distances.begin() + offset );
+                } );
+        }
+
+        template < typename EpsilonType >
+        typename geode::NNSearch< dimension >::ColocatedInfo
+            colocated_index_mapping(
+                const geode::NNSearch< dimension >& nn_search,
+                const EpsilonType& epsilon ) const
+        {
+            typename NNSearch< dimension >::ColocatedInfo result;
+            const auto nb_points = nn_search.nb_points();
+            auto mapping =
+                greedy_mapping( claiming_points( nb_points, epsilon ) );
             result.colocated_input_points = mapping;
             index_t nb_unique_points{ 0 };
             for( const auto point_id : Range{ nb_points } )
@@ -183,15 +250,130 @@ namespace geode
                     count++;
                 }
             }
-            for( const auto point_id : Range{ nb_points } )
-            {
-                mapping[point_id] = old2new[mapping[point_id]];
-            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [&mapping, &old2new]( index_t point_id ) {
+                    mapping[point_id] = old2new[mapping[point_id]];
+                } );
             result.colocated_mapping = mapping;
             return result;
         }
 
     private:
+        /*!
+         * Compressed storage, for each point p, of the points q <= p whose
+         * neighborhood contains p, sorted by increasing index.
+         */
+        struct ClaimingPoints
+        {
+            std::vector< index_t > offsets;
+            std::vector< index_t > points;
+        };
+
+        template < typename EpsilonType >
+        ClaimingPoints claiming_points(
+            index_t nb_points, const EpsilonType& epsilon ) const
+        {
+            std::vector< std::vector< index_t > > neighborhoods( nb_points );
+            std::vector< std::atomic< index_t > > counters( nb_points );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [&epsilon, &neighborhoods, &counters, this](
+                    index_t point_id ) {
+                    auto& neighborhood = neighborhoods[point_id];
+                    neighborhood = neighbors( point( point_id ), epsilon );
+                    for( const auto neighbor : neighborhood )
+                    {
+                        if( neighbor >= point_id )
+                        {
+                            counters[neighbor].fetch_add(
+                                1, std::memory_order_relaxed );
+                        }
+                    }
+                } );
+            ClaimingPoints claims;
+            claims.offsets.resize( nb_points + 1, 0 );
+            for( const auto point_id : Range{ nb_points } )
+            {
+                claims.offsets[point_id + 1] =
+                    claims.offsets[point_id] + counters[point_id];
+                counters[point_id] = claims.offsets[point_id];
+            }
+            claims.points.resize( claims.offsets.back() );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [&neighborhoods, &counters, &claims]( index_t point_id ) {
+                    for( const auto neighbor : neighborhoods[point_id] )
+                    {
+                        if( neighbor >= point_id )
+                        {
+                            claims.points[counters[neighbor].fetch_add(
+                                1, std::memory_order_relaxed )] = point_id;
+                        }
+                    }
+                } );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [&claims]( index_t point_id ) {
+                    std::sort( claims.points.begin()
+                                   + claims.offsets[point_id],
+                        claims.points.begin() + claims.offsets[point_id + 1] );
+                } );
+            return claims;
+        }
+
+        /*!
+         * Compute the mapping obtained by visiting points by increasing
+         * index and mapping each unmapped neighbor of an unmapped point to
+         * this point. A point is decided once all its smaller claiming
+         * points are, so the result does not depend on scheduling and is
+         * computed in parallel rounds without locks.
+         */
+        std::vector< index_t > greedy_mapping(
+            const ClaimingPoints& claims ) const
+        {
+            const auto nb_points = claims.offsets.size() - 1;
+            std::vector< index_t > mapping( nb_points, NO_ID );
+            std::vector< std::atomic< bool > > decided( nb_points );
+            std::vector< index_t > undecided( nb_points );
+            absl::c_iota( undecided, 0 );
+            while( !undecided.empty() )
+            {
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, undecided.size() ),
+                    [&claims, &mapping, &decided, &undecided]( size_t u ) {
+                        const auto point_id = undecided[u];
+                        for( const auto claim :
+                            Range{ claims.offsets[point_id],
+                                claims.offsets[point_id + 1] } )
+                        {
+                            const auto claimer = claims.points[claim];
+                            if( claimer == point_id )
+                            {
+                                mapping[point_id] = point_id;
+                                break;
+                            }
+                            if( !decided[claimer].load(
+                                    std::memory_order_acquire ) )
+                            {
+                                return;
+                            }
+                            if( mapping[claimer] == claimer )
+                            {
+                                mapping[point_id] = claimer;
+                                break;
+                            }
+                        }
+                        decided[point_id].store(
+                            true, std::memory_order_release );
+                    } );
+                undecided.erase(
+                    std::remove_if( undecided.begin(), undecided.end(),
+                        [&decided]( index_t point_id ) {
+                            return decided[point_id].load(
+                                std::memory_order_relaxed );
+                        } ),
+                    undecided.end() );
+            }
+            return mapping;
+        }
+
         std::array< double, dimension > copy(
             const Point< dimension >& point ) const
         {
@@ -293,6 +475,24 @@ namespace geode
         return impl_->nearest_vertices( point, nb_neighbors );
     }
 
+    template < index_t dimension >
+    void NNSearch< dimension >::neighbors(
+        absl::Span< const Point< dimension > > points,
+        index_t nb_neighbors,
+        NeighborsBatch& results ) const
+    {
+        impl_->nearest_vertices( points, nb_neighbors, results );
+    }
+
+    template < index_t dimension >
+    void NNSearch< dimension >::radius_neighbors(
+        absl::Span< const Point< dimension > > points,
+        double threshold_distance,
+        NeighborsBatch& results ) const
+    {
+        impl_->neighbors( points, threshold_distance, results );
+    }
+
     template < geode::index_t dimension >
     typename geode::NNSearch< dimension >::ColocatedInfo
         NNSearch< dimension >::colocated_index_mapping(
@@ -35,6 +35,8 @@ namespace
 {
     using itr = std::vector< geode::index_t >::iterator;
 
+    constexpr std::ptrdiff_t PARALLEL_SORT_THRESHOLD{ 8192 };
+
     template < geode::index_t dimension >
     class Morton_cmp
     {
@@ -136,6 +138,35 @@ namespace
         const auto m6 = split_container( m4, m8, compY );
         const auto m5 = split_container( m4, m6, compZ );
         const auto m7 = split_container( m6, m8, compZ );
+        if( end - begin > PARALLEL_SORT_THRESHOLD )
+        {
+            async::parallel_invoke(
+                [&points, &m0, &m1] {
+                    morton_mapping< COORDZ, Comparator >( points, m0, m1 );
+                },
+                [&points, &m1, &m2] {
+                    morton_mapping< COORDY, Comparator >( points, m1, m2 );
+                },
+                [&points, &m2, &m3] {
+                    morton_mapping< COORDY, Comparator >( points, m2, m3 );
+                },
+                [&points, &m3, &m4] {
+                    morton_mapping< COORDX, Comparator >( points, m3, m4 );
+                },
+                [&points, &m4, &m5] {
+                    morton_mapping< COORDX, Comparator >( points, m4, m5 );
+                },
+                [&points, &m5, &m6] {
+                    morton_mapping< COORDY, Comparator >( points, m5, m6 );
+                },
+                [&points, &m6, &m7] {
+                    morton_mapping< COORDY, Comparator >( points, m6, m7 );
+                },
+                [&points, &m7, &m8] {
+                    morton_mapping< COORDZ, Comparator >( points, m7, m8 );
+                } );
+            return;
+        }
         morton_mapping< COORDZ, Comparator >( points, m0, m1 );
         morton_mapping< COORDY, Comparator >( points, m1, m2 );
         morton_mapping< COORDY, Comparator >( points, m2, m3 );
@@ -166,6 +197,23 @@ namespace
         const auto m2 = split_container( m0, m4, compX );
         const auto m1 = split_container( m0, m2, compY );
         const auto m3 = split_container( m2, m4, compY );
+        if( end - begin > PARALLEL_SORT_THRESHOLD )
+        {
+            async::parallel_invoke(
+                [&points, &m0, &m1] {
+                    morton_mapping< COORDY, Comparator >( points, m0, m1 );
+                },
+                [&points, &m1, &m2] {
+                    morton_mapping< COORDX, Comparator >( points, m1, m2 );
+                },
+                [&points, &m2, &m3] {
+                    morton_mapping< COORDX, Comparator >( points, m2, m3 );
+                },
+                [&points, &m3, &m4] {
+                    morton_mapping< COORDY, Comparator >( points, m3, m4 );
+                } );
+            return;
+        }
         morton_mapping< COORDY, Comparator >( points, m0, m1 );
         morton_mapping< COORDX, Comparator >( points, m1, m2 );
         morton_mapping< COORDX, Comparator >( points, m2, m3 );
@@ -23,6 +23,9 @@
 
 #include <geode/mesh/builder/solid_mesh_builder.hpp>
 
+#include <array>
+#include <atomic>
+
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/detail/mapping_after_deletion.hpp>
 #include <geode/basic/mapping.hpp>
@@ -35,6 +38,7 @@
 #include <geode/mesh/builder/solid_facets_builder.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/geode/geode_regular_grid_solid.hpp>
+#include <geode/mesh/core/internal/sorted_adjacencies.hpp>
 #include <geode/mesh/core/regular_grid_solid.hpp>
 #include <geode/mesh/core/solid_edges.hpp>
 #include <geode/mesh/core/solid_facets.hpp>
@@ -407,6 +411,101 @@ namespace
         }
         return mappings;
     }
+
+    template < geode::index_t dimension, typename Filter, typename Action >
+    void pair_hashed_facets( const geode::SolidMesh< dimension >& solid,
+        absl::Span< const geode::index_t > polyhedra,
+        const Filter& filter,
+        const Action& action )
+    {
+        using Facet =
+            geode::detail::VertexCycle< geode::PolyhedronFacetVertices >;
+        absl::flat_hash_map< Facet, geode::PolyhedronFacet > facets;
+        for( const auto polyhedron : polyhedra )
+        {
+            for( const auto f :
+                geode::LRange{ solid.nb_polyhedron_facets( polyhedron ) } )
+            {
+                const geode::PolyhedronFacet facet{ polyhedron, f };
+                if( !solid.is_polyhedron_facet_on_border( facet )
+                    || !filter( facet ) )
+                {
+                    continue;
+                }
+                const auto output = facets.emplace(
+                    solid.polyhedron_facet_vertices( facet ), facet );
+                if( !output.second )
+                {
+                    const auto it = output.first;
+                    action( it->second, facet );
+                    facets.erase( it );
+                }
+            }
+        }
+    }
+
+    template < geode::index_t dimension, typename Action >
+    void pair_sorted_facets( const geode::SolidMesh< dimension >& solid,
+        absl::Span< const geode::index_t > polyhedra,
+        const Action& action )
+    {
+        using FacetKey = std::array< geode::index_t, 4 >;
+        using Record = geode::internal::SideRecord< FacetKey >;
+        std::atomic< bool > has_large_facets{ false };
+        geode::internal::pair_sorted_sides< FacetKey >(
+            polyhedra,
+            [&solid]( geode::index_t polyhedron ) {
+                return solid.nb_polyhedron_facets( polyhedron );
+            },
+            [&solid, &has_large_facets](
+                geode::index_t polyhedron, absl::Span< Record > records ) {
+                geode::index_t nb_records{ 0 };
+                for( const auto f :
+                    geode::LRange{ solid.nb_polyhedron_facets( polyhedron ) } )
+                {
+                    const geode::PolyhedronFacet facet{ polyhedron, f };
+                    if( !solid.is_polyhedron_facet_on_border( facet ) )
+                    {
+                        continue;
+                    }
+                    const geode::detail::VertexCycle<
+                        geode::PolyhedronFacetVertices >
+                        cycle{ solid.polyhedron_facet_vertices( facet ) };
+                    const auto& vertices = cycle.vertices();
+                    if( vertices.size() > FacetKey{}.size() )
+                    {
+                        has_large_facets = true;
+                        continue;
+                    }
+                    auto& record = records[nb_records++];
+                    record.key.fill( geode::NO_ID );
+                    absl::c_copy( vertices, record.key.begin() );
+                    record.element = polyhedron;
+                    record.side = f;
+                }
+                return nb_records;
+            },
+            [&action]( absl::Span< const Record > group ) {
+                for( geode::index_t r = 0; r + 1 < group.size(); r += 2 )
+                {
+                    action(
+                        geode::PolyhedronFacet{ group[r].element,
+                            group[r].side },
+                        geode::PolyhedronFacet{
+                            group[r + 1].element, group[r + 1].side } );
+                }
+            } );
+        if( has_large_facets )
+        {
+            pair_hashed_facets(
+                solid, polyhedra,
+                [&solid]( const geode::PolyhedronFacet& facet ) {
+                    return solid.nb_polyhedron_facet_vertices( facet )
+                           > FacetKey{}.size();
+                },
+                action );
+        }
+    }
 } // namespace
 
 namespace geode
@@ -440,8 +539,11 @@ namespace geode
         {
             return mappings;
         }
-        const auto& polyhedra_around =
+        const auto polyhedra_around_view =
             solid_mesh_.polyhedra_around_vertex( old_vertex_id );
+        const PolyhedraAroundVertex polyhedra_around{
+            polyhedra_around_view.begin(), polyhedra_around_view.end()
+        };
         disassociate_polyhedron_vertex_to_vertex( old_vertex_id );
         for( const auto& polyhedron_around : polyhedra_around )
         {
@@ -751,30 +853,22 @@ namespace geode
     void SolidMeshBuilder< dimension >::compute_polyhedron_adjacencies(
         absl::Span< const index_t > polyhedra_to_connect )
     {
-        using Facet = detail::VertexCycle< PolyhedronFacetVertices >;
-        absl::flat_hash_map< Facet, PolyhedronFacet > facets;
-        for( const auto polyhedron : polyhedra_to_connect )
+        const auto connect = [this]( const PolyhedronFacet& facet0,
+                                 const PolyhedronFacet& facet1 ) {
+            do_set_polyhedron_adjacent( facet0, facet1.polyhedron_id );
+            do_set_polyhedron_adjacent( facet1, facet0.polyhedron_id );
+        };
+        if( polyhedra_to_connect.size() < internal::SORTED_ADJACENCY_THRESHOLD )
         {
-            for( const auto f :
-                LRange{ solid_mesh_.nb_polyhedron_facets( polyhedron ) } )
-            {
-                const PolyhedronFacet facet{ polyhedron, f };
-                if( !solid_mesh_.is_polyhedron_facet_on_border( facet ) )
-                {
-                    continue;
-                }
-                const auto output = facets.emplace(
-                    solid_mesh_.polyhedron_facet_vertices( facet ), facet );
-                if( !output.second )
-                {
-                    const auto it = output.first;
-                    do_set_polyhedron_adjacent( it->second, polyhedron );
-                    do_set_polyhedron_adjacent(
-                        facet, it->second.polyhedron_id );
-                    facets.erase( it );
-                }
-            }
+            pair_hashed_facets(
+                solid_mesh_, polyhedra_to_connect,
+                []( const PolyhedronFacet& /*unused*/ ) {
+                    return true;
+                },
+                connect );
+            return;
         }
+        pair_sorted_facets( solid_mesh_, polyhedra_to_connect, connect );
     }
 
     template < index_t dimension >
@@ -31,6 +31,7 @@
 #include <geode/mesh/builder/mesh_builder_factory.hpp>
 #include <geode/mesh/builder/surface_edges_builder.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
+#include <geode/mesh/core/internal/sorted_adjacencies.hpp>
 #include <geode/mesh/core/surface_edges.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 
@@ -344,6 +345,49 @@ namespace
         }
         return mapping;
     }
+
+    template < geode::index_t dimension, typename Action >
+    void pair_sorted_edges( const geode::SurfaceMesh< dimension >& surface,
+        absl::Span< const geode::index_t > polygons,
+        const Action& action )
+    {
+        using EdgeKey = std::array< geode::index_t, 2 >;
+        using Record = geode::internal::SideRecord< EdgeKey >;
+        geode::internal::pair_sorted_sides< EdgeKey >(
+            polygons,
+            [&surface]( geode::index_t polygon ) {
+                return surface.nb_polygon_edges( polygon );
+            },
+            [&surface](
+                geode::index_t polygon, absl::Span< Record > records ) {
+                geode::index_t nb_records{ 0 };
+                for( const auto e :
+                    geode::LRange{ surface.nb_polygon_edges( polygon ) } )
+                {
+                    const geode::PolygonEdge edge{ polygon, e };
+                    if( !surface.is_edge_on_border( edge ) )
+                    {
+                        continue;
+                    }
+                    auto& record = records[nb_records++];
+                    record.key = geode::detail::VertexCycle< EdgeKey >{
+                        surface.polygon_edge_vertices( edge )
+                    }.vertices();
+                    record.element = polygon;
+                    record.side = e;
+                }
+                return nb_records;
+            },
+            [&action]( absl::Span< const Record > group ) {
+                // Non-manifold edges are left on border
+                if( group.size() != 2 )
+                {
+                    return;
+                }
+                action( geode::PolygonEdge{ group[0].element, group[0].side },
+                    geode::PolygonEdge{ group[1].element, group[1].side } );
+            } );
+    }
 } // namespace
 
 namespace geode
@@ -435,8 +479,11 @@ namespace geode
         {
             return edge_mapping;
         }
-        const auto& polygons_around =
+        const auto polygons_around_view =
             surface_mesh_.polygons_around_vertex( old_vertex_id );
+        const PolygonsAroundVertex polygons_around{
+            polygons_around_view.begin(), polygons_around_view.end()
+        };
         disassociate_polygon_vertex_to_vertex( old_vertex_id );
         for( const auto& polygon_around : polygons_around )
         {
@@ -673,6 +720,30 @@ namespace geode
                     polygon_edges[1], polygon_edges[0].polygon_id );
             }
         }
+        else if( polygons_to_connect.size()
+                 >= internal::SORTED_ADJACENCY_THRESHOLD )
+        {
+            std::vector< PolygonEdge > paired_edges;
+            pair_sorted_edges( surface_mesh_, polygons_to_connect,
+                [this, &paired_edges](
+                    const PolygonEdge& edge0, const PolygonEdge& edge1 ) {
+                    do_set_polygon_adjacent( edge0, edge1.polygon_id );
+                    do_set_polygon_adjacent( edge1, edge0.polygon_id );
+                    paired_edges.push_back( edge1 );
+                } );
+            for( const auto& polygon_edge : paired_edges )
+            {
+                if( const auto polygon_adj =
+                        non_manifold_polygon_adjacent_edge( surface_mesh_,
+                            polygon_edge,
+                            surface_mesh_.polygon_edge_vertices(
+                                polygon_edge ) ) )
+                {
+                    do_unset_polygon_adjacent( polygon_edge );
+                    do_unset_polygon_adjacent( polygon_adj.value() );
+                }
+            }
+        }
         else
         {
             using Edge = detail::VertexCycle< std::array< index_t, 2 > >;
@@ -35,6 +35,19 @@ namespace geode
     VertexSetBuilder::VertexSetBuilder( VertexSet& mesh )
         : IdentifierBuilder( mesh ), vertex_set_( mesh )
     {
+        vertex_set_.register_builder( VertexSet::VertexSetBuilderKey{} );
+    }
+
+    VertexSetBuilder::VertexSetBuilder( VertexSetBuilder&& other ) noexcept
+        : IdentifierBuilder( std::move( other ) ),
+          vertex_set_( other.vertex_set_ )
+    {
+        vertex_set_.register_builder( VertexSet::VertexSetBuilderKey{} );
+    }
+
+    VertexSetBuilder::~VertexSetBuilder()
+    {
+        vertex_set_.unregister_builder( VertexSet::VertexSetBuilderKey{} );
     }
 
     std::unique_ptr< VertexSetBuilder > VertexSetBuilder::create(
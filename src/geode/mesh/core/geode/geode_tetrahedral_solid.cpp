@@ -80,6 +80,12 @@ namespace geode
 
         Impl() = default;
 
+        absl::Span< const std::array< index_t, 4 > >
+            tetrahedra_vertices() const
+        {
+            return tetrahedron_vertices_->values();
+        }
+
         index_t get_polyhedron_vertex(
             const PolyhedronVertex& polyhedron_vertex ) const
         {
@@ -209,6 +215,13 @@ namespace geode
     OpenGeodeTetrahedralSolid< dimension >::~OpenGeodeTetrahedralSolid() =
         default;
 
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 4 > >
+        OpenGeodeTetrahedralSolid< dimension >::tetrahedra_vertices() const
+    {
+        return impl_->tetrahedra_vertices();
+    }
+
     template < index_t dimension >
     index_t OpenGeodeTetrahedralSolid< dimension >::get_polyhedron_vertex(
         const PolyhedronVertex& polyhedron_vertex ) const
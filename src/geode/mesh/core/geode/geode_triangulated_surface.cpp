@@ -78,6 +78,11 @@ namespace geode
 
         Impl() = default;
 
+        absl::Span< const std::array< index_t, 3 > > triangles_vertices() const
+        {
+            return triangle_vertices_->values();
+        }
+
         index_t get_polygon_vertex( const PolygonVertex& polygon_vertex ) const
         {
             return triangle_vertices_->value( polygon_vertex.polygon_id )
@@ -194,6 +199,13 @@ namespace geode
     OpenGeodeTriangulatedSurface< dimension >::~OpenGeodeTriangulatedSurface() =
         default;
 
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 3 > >
+        OpenGeodeTriangulatedSurface< dimension >::triangles_vertices() const
+    {
+        return impl_->triangles_vertices();
+    }
+
     template < index_t dimension >
     index_t OpenGeodeTriangulatedSurface< dimension >::get_polygon_vertex(
         const PolygonVertex& polygon_vertex ) const
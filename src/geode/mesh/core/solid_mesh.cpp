@@ -24,6 +24,7 @@
 
 #include <geode/mesh/core/solid_mesh.hpp>
 
+#include <atomic>
 #include <stack>
 
 #include <absl/container/flat_hash_set.h>
@@ -53,6 +54,7 @@
 #include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/bitsery_archive.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
+#include <geode/mesh/core/internal/elements_around_vertex_index.hpp>
 #include <geode/mesh/core/internal/solid_mesh_impl.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
 #include <geode/mesh/core/polyhedral_solid.hpp>
@@ -459,7 +461,6 @@ namespace geode
                 solid.vertex_attribute_manager()
                     .template find_attribute< VariableAttribute,
                         PolyhedronVertex >( attribute_id );
-            initialize_polyhedra_around_vertex( solid );
         }
 
         VerticesAroundVertex vertices_around_vertex(
@@ -546,17 +547,29 @@ namespace geode
 
         void reset_polyhedra_around_vertex( index_t vertex_id )
         {
+            polyhedra_around_vertices_.reset();
+            if( !polyhedra_around_vertex_ )
+            {
+                return;
+            }
             polyhedra_around_vertex_->modify_value(
                 vertex_id, []( CachedPolyhedra& value ) {
                     value.reset();
                 } );
         }
 
-        const PolyhedraAroundVertex& polyhedra_around_vertex(
+        absl::Span< const PolyhedronVertex > polyhedra_around_vertex(
             const SolidMesh< dimension >& mesh,
             index_t vertex_id,
             const std::optional< PolyhedronVertex >& first_polyhedron ) const
         {
+            if( polyhedra_around_vertices_
+                && polyhedra_around_vertices_->matches(
+                    vertex_id, first_polyhedron ) )
+            {
+                return polyhedra_around_vertices_->elements_around(
+                    vertex_id );
+            }
             return updated_polyhedra_around_vertex(
                 mesh, vertex_id, first_polyhedron )
                 .polyhedra;
@@ -566,14 +579,44 @@ namespace geode
             index_t vertex_id,
             const std::optional< PolyhedronVertex >& first_polyhedron ) const
         {
+            if( polyhedra_around_vertices_
+                && polyhedra_around_vertices_->matches(
+                    vertex_id, first_polyhedron ) )
+            {
+                return polyhedra_around_vertices_->is_on_border( vertex_id );
+            }
             return updated_polyhedra_around_vertex(
                 mesh, vertex_id, first_polyhedron )
                 .vertex_is_on_border;
         }
 
+        void build_polyhedra_around_vertices(
+            const SolidMesh< dimension >& mesh ) const
+        {
+            polyhedra_around_vertices_ = std::make_unique<
+                internal::ElementsAroundVertexIndex< PolyhedronVertex > >(
+                mesh.nb_vertices(),
+                [&mesh]( index_t vertex_id,
+                    std::vector< PolyhedronVertex >& polyhedra ) {
+                    const auto around = compute_polyhedra_around_vertex( mesh,
+                        vertex_id, mesh.polyhedron_around_vertex( vertex_id ) );
+                    polyhedra.insert( polyhedra.end(),
+                        around.polyhedra.begin(), around.polyhedra.end() );
+                    return around.vertex_is_on_border;
+                } );
+            if( polyhedra_around_vertex_ )
+            {
+                mesh.vertex_attribute_manager().delete_attribute(
+                    polyhedra_around_vertex_->id() );
+                polyhedra_around_vertex_.reset();
+                polyhedra_around_vertex_initialized_ = false;
+            }
+        }
+
         void associate_polyhedron_vertex_to_vertex(
             const PolyhedronVertex& polyhedron_vertex, const index_t vertex_id )
         {
+            polyhedra_around_vertices_.reset();
             polyhedron_around_vertex_->set_value(
                 vertex_id, polyhedron_vertex );
         }
@@ -689,8 +732,17 @@ namespace geode
         }
 
         void initialize_polyhedra_around_vertex(
-            const SolidMesh< dimension >& solid )
+            const SolidMesh< dimension >& solid ) const
         {
+            auto& manager = solid.vertex_attribute_manager();
+            if( const auto attribute_ids = manager.attribute_ids_matching_name(
+                    POLYHEDRA_AROUND_VERTEX_NAME ) )
+            {
+                polyhedra_around_vertex_ =
+                    manager.template find_attribute< VariableAttribute,
+                        CachedPolyhedra >( attribute_ids->front() );
+                return;
+            }
             AttributeProperties attribute_properties;
             attribute_properties.assignable = false;
             attribute_properties.interpolable = false;
@@ -699,14 +751,12 @@ namespace geode
             polyhedron_around_vertex_values.default_value = CachedPolyhedra{};
             polyhedron_around_vertex_values.no_value = CachedPolyhedra{};
             const auto attribute_id =
-                solid.vertex_attribute_manager()
-                    .template create_attribute< VariableAttribute,
-                        CachedPolyhedra >( POLYHEDRA_AROUND_VERTEX_NAME,
-                        polyhedron_around_vertex_values, attribute_properties );
+                manager.template create_attribute< VariableAttribute,
+                    CachedPolyhedra >( POLYHEDRA_AROUND_VERTEX_NAME,
+                    polyhedron_around_vertex_values, attribute_properties );
             polyhedra_around_vertex_ =
-                solid.vertex_attribute_manager()
-                    .template find_attribute< VariableAttribute,
-                        CachedPolyhedra >( attribute_id );
+                manager.template find_attribute< VariableAttribute,
+                    CachedPolyhedra >( attribute_id );
         }
 
         const internal::PolyhedraAroundVertexImpl&
@@ -715,7 +765,8 @@ namespace geode
                 const std::optional< PolyhedronVertex >& first_polyhedron )
                 const
         {
-            const auto& cached = polyhedra_around_vertex_->value( vertex_id );
+            const auto& cached =
+                cached_polyhedra_around_vertex( mesh ).value( vertex_id );
             if( cached.computed()
                 && ( first_polyhedron
                      && absl::c_contains( cached.value().polyhedra,
@@ -828,15 +879,49 @@ namespace geode
                         archive.ext(
                             impl.facets_, bitsery::ext::StdSmartPtr{} );
                         archive.object( impl.texture_storage_ );
+                    },
+                    []( Archive& archive, Impl& impl ) {
+                        archive.object( impl.polyhedron_attribute_manager_ );
+                        archive.ext( impl.polyhedron_around_vertex_,
+                            bitsery::ext::StdSmartPtr{} );
+                        archive.ext( impl.edges_, bitsery::ext::StdSmartPtr{} );
+                        archive.ext(
+                            impl.facets_, bitsery::ext::StdSmartPtr{} );
+                        archive.object( impl.texture_storage_ );
                     } } } );
         }
 
+        VariableAttribute< CachedPolyhedra >& cached_polyhedra_around_vertex(
+            const SolidMesh< dimension >& mesh ) const
+        {
+            if( !polyhedra_around_vertex_initialized_ )
+            {
+                absl::MutexLock lock{ polyhedra_around_vertex_mutex_ };
+                if( !polyhedra_around_vertex_initialized_ )
+                {
+                    if( !polyhedra_around_vertex_ )
+                    {
+                        initialize_polyhedra_around_vertex( mesh );
+                    }
+                    polyhedra_around_vertex_initialized_ = true;
+                }
+            }
+            return *polyhedra_around_vertex_;
+        }
+
     private:
         mutable AttributeManager polyhedron_attribute_manager_;
         std::shared_ptr< VariableAttribute< PolyhedronVertex > >
             polyhedron_around_vertex_;
         mutable std::shared_ptr< VariableAttribute< CachedPolyhedra > >
             polyhedra_around_vertex_;
+        mutable std::atomic< bool > polyhedra_around_vertex_initialized_{
+            false
+        };
+        mutable absl::Mutex polyhedra_around_vertex_mutex_;
+        mutable std::unique_ptr<
+            internal::ElementsAroundVertexIndex< PolyhedronVertex > >
+            polyhedra_around_vertices_;
         mutable std::unique_ptr< SolidEdges< dimension > > edges_;
         mutable std::unique_ptr< SolidFacets< dimension > > facets_;
         mutable TextureStorage3D texture_storage_;
@@ -1201,7 +1286,7 @@ namespace geode
     }
 
     template < index_t dimension >
-    const PolyhedraAroundVertex&
+    absl::Span< const PolyhedronVertex >
         SolidMesh< dimension >::polyhedra_around_vertex(
             const PolyhedronVertex& first_polyhedron ) const
     {
@@ -1210,7 +1295,7 @@ namespace geode
     }
 
     template < index_t dimension >
-    const PolyhedraAroundVertex&
+    absl::Span< const PolyhedronVertex >
         SolidMesh< dimension >::polyhedra_around_vertex(
             index_t vertex_id ) const
     {
@@ -1219,6 +1304,12 @@ namespace geode
             *this, vertex_id, polyhedron_around_vertex( vertex_id ) );
     }
 
+    template < index_t dimension >
+    void SolidMesh< dimension >::build_polyhedra_around_vertices() const
+    {
+        impl_->build_polyhedra_around_vertices( *this );
+    }
+
     template < geode::index_t dimension >
     bool SolidMesh< dimension >::is_edge_in_polyhedron_facet(
         const PolyhedronFacet& facet,
@@ -1858,4 +1949,4 @@ namespace std
                ^ absl::Hash< geode::index_t >()(
                    polyhedron_facet_edge.edge_id );
     }
-} // namespace std
\ No newline at end of file
+} // namespace std
\ No newline at end of file
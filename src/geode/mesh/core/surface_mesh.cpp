@@ -24,6 +24,7 @@
 #include <geode/mesh/core/surface_mesh.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <stack>
 
 #include <absl/synchronization/mutex.h>
@@ -51,6 +52,7 @@
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
 #include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/detail/facet_storage.hpp>
+#include <geode/mesh/core/internal/elements_around_vertex_index.hpp>
 #include <geode/mesh/core/internal/surface_mesh_impl.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
 #include <geode/mesh/core/polygonal_surface.hpp>
@@ -301,7 +303,6 @@ namespace geode
                 surface.vertex_attribute_manager()
                     .template find_attribute< VariableAttribute,
                         PolygonVertex >( attribute_id );
-            initialize_polygons_around_vertex( surface );
         }
 
         VerticesAroundVertex vertices_around_vertex(
@@ -351,17 +352,28 @@ namespace geode
 
         void reset_polygons_around_vertex( index_t vertex_id )
         {
+            polygons_around_vertices_.reset();
+            if( !polygons_around_vertex_ )
+            {
+                return;
+            }
             polygons_around_vertex_->modify_value(
                 vertex_id, []( CachedPolygons& value ) {
                     value.reset();
                 } );
         }
 
-        const PolygonsAroundVertex& polygons_around_vertex(
+        absl::Span< const PolygonVertex > polygons_around_vertex(
             const SurfaceMesh< dimension >& mesh,
             index_t vertex_id,
             const std::optional< PolygonVertex >& first_polygon ) const
         {
+            if( polygons_around_vertices_
+                && polygons_around_vertices_->matches(
+                    vertex_id, first_polygon ) )
+            {
+                return polygons_around_vertices_->elements_around( vertex_id );
+            }
             return updated_polygons_around_vertex(
                 mesh, vertex_id, first_polygon )
                 .polygons;
@@ -371,14 +383,44 @@ namespace geode
             index_t vertex_id,
             const std::optional< PolygonVertex >& first_polygon ) const
         {
+            if( polygons_around_vertices_
+                && polygons_around_vertices_->matches(
+                    vertex_id, first_polygon ) )
+            {
+                return polygons_around_vertices_->is_on_border( vertex_id );
+            }
             return updated_polygons_around_vertex(
                 mesh, vertex_id, first_polygon )
                 .vertex_is_on_border;
         }
 
+        void build_polygons_around_vertices(
+            const SurfaceMesh< dimension >& mesh ) const
+        {
+            polygons_around_vertices_ = std::make_unique<
+                internal::ElementsAroundVertexIndex< PolygonVertex > >(
+                mesh.nb_vertices(),
+                [&mesh]( index_t vertex_id,
+                    std::vector< PolygonVertex >& polygons ) {
+                    const auto around = compute_polygons_around_vertex( mesh,
+                        vertex_id, mesh.polygon_around_vertex( vertex_id ) );
+                    polygons.insert( polygons.end(),
+                        around.polygons.begin(), around.polygons.end() );
+                    return around.vertex_is_on_border;
+                } );
+            if( polygons_around_vertex_ )
+            {
+                mesh.vertex_attribute_manager().delete_attribute(
+                    polygons_around_vertex_->id() );
+                polygons_around_vertex_.reset();
+                polygons_around_vertex_initialized_ = false;
+            }
+        }
+
         void associate_polygon_vertex_to_vertex(
             const PolygonVertex& polygon_vertex, const index_t vertex_id )
         {
+            polygons_around_vertices_.reset();
             polygon_around_vertex_->set_value( vertex_id, polygon_vertex );
         }
 
@@ -441,8 +483,17 @@ namespace geode
         }
 
         void initialize_polygons_around_vertex(
-            const SurfaceMesh< dimension >& surface )
+            const SurfaceMesh< dimension >& surface ) const
         {
+            auto& manager = surface.vertex_attribute_manager();
+            if( const auto attribute_ids = manager.attribute_ids_matching_name(
+                    POLYGONS_AROUND_VERTEX_NAME ) )
+            {
+                polygons_around_vertex_ =
+                    manager.template find_attribute< VariableAttribute,
+                        CachedPolygons >( attribute_ids->front() );
+                return;
+            }
             AttributeProperties attribute_properties;
             attribute_properties.assignable = false;
             attribute_properties.interpolable = false;
@@ -451,14 +502,12 @@ namespace geode
             polygon_around_vertex_values.default_value = CachedPolygons{};
             polygon_around_vertex_values.no_value = CachedPolygons{};
             const auto attribute_id =
-                surface.vertex_attribute_manager()
-                    .template create_attribute< VariableAttribute,
-                        CachedPolygons >( POLYGONS_AROUND_VERTEX_NAME,
-                        polygon_around_vertex_values, attribute_properties );
+                manager.template create_attribute< VariableAttribute,
+                    CachedPolygons >( POLYGONS_AROUND_VERTEX_NAME,
+                    polygon_around_vertex_values, attribute_properties );
             polygons_around_vertex_ =
-                surface.vertex_attribute_manager()
-                    .template find_attribute< VariableAttribute,
-                        CachedPolygons >( attribute_id );
+                manager.template find_attribute< VariableAttribute,
+                    CachedPolygons >( attribute_id );
         }
 
         Impl() = default;
@@ -550,16 +599,43 @@ namespace geode
                             archive.ext(
                                 impl.edges_, bitsery::ext::StdSmartPtr{} );
                             archive.object( impl.texture_storage_ );
+                        },
+                        []( Archive& archive, Impl& impl ) {
+                            archive.object( impl.polygon_attribute_manager_ );
+                            archive.ext( impl.polygon_around_vertex_,
+                                bitsery::ext::StdSmartPtr{} );
+                            archive.ext(
+                                impl.edges_, bitsery::ext::StdSmartPtr{} );
+                            archive.object( impl.texture_storage_ );
                         } } } );
         }
 
+        VariableAttribute< CachedPolygons >& cached_polygons_around_vertex(
+            const SurfaceMesh< dimension >& mesh ) const
+        {
+            if( !polygons_around_vertex_initialized_ )
+            {
+                absl::MutexLock lock{ polygons_around_vertex_mutex_ };
+                if( !polygons_around_vertex_initialized_ )
+                {
+                    if( !polygons_around_vertex_ )
+                    {
+                        initialize_polygons_around_vertex( mesh );
+                    }
+                    polygons_around_vertex_initialized_ = true;
+                }
+            }
+            return *polygons_around_vertex_;
+        }
+
         const internal::PolygonsAroundVertexImpl&
             updated_polygons_around_vertex(
                 const SurfaceMesh< dimension >& mesh,
                 const index_t vertex_id,
                 const std::optional< PolygonVertex >& first_polygon ) const
         {
-            const auto& cached = polygons_around_vertex_->value( vertex_id );
+            const auto& cached =
+                cached_polygons_around_vertex( mesh ).value( vertex_id );
             if( cached.computed() && first_polygon
                 && absl::c_contains(
                     cached.value().polygons, first_polygon.value() ) )
@@ -578,6 +654,13 @@ namespace geode
             polygon_around_vertex_;
         mutable std::shared_ptr< VariableAttribute< CachedPolygons > >
             polygons_around_vertex_;
+        mutable std::atomic< bool > polygons_around_vertex_initialized_{
+            false
+        };
+        mutable absl::Mutex polygons_around_vertex_mutex_;
+        mutable std::unique_ptr<
+            internal::ElementsAroundVertexIndex< PolygonVertex > >
+            polygons_around_vertices_;
         mutable std::unique_ptr< SurfaceEdges< dimension > > edges_;
         mutable TextureStorage2D texture_storage_;
     };
@@ -984,7 +1067,7 @@ namespace geode
     }
 
     template < index_t dimension >
-    const PolygonsAroundVertex&
+    absl::Span< const PolygonVertex >
         SurfaceMesh< dimension >::polygons_around_vertex(
             index_t vertex_id ) const
     {
@@ -994,7 +1077,7 @@ namespace geode
     }
 
     template < index_t dimension >
-    const PolygonsAroundVertex&
+    absl::Span< const PolygonVertex >
         SurfaceMesh< dimension >::polygons_around_vertex(
             const PolygonVertex& polygon_vertex ) const
     {
@@ -1004,6 +1087,12 @@ namespace geode
             *this, this->polygon_vertex( polygon_vertex ), polygon_vertex );
     }
 
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::build_polygons_around_vertices() const
+    {
+        impl_->build_polygons_around_vertices( *this );
+    }
+
     template < index_t dimension >
     bool SurfaceMesh< dimension >::is_vertex_on_border(
         index_t vertex_id ) const
@@ -1315,4 +1404,4 @@ namespace std
         return absl::Hash< geode::index_t >()( polygon_edge.polygon_id )
                ^ absl::Hash< geode::index_t >()( polygon_edge.edge_id );
     }
-} // namespace std
\ No newline at end of file
+} // namespace std
\ No newline at end of file
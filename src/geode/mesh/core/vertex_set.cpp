@@ -23,6 +23,8 @@
 
 #include <geode/mesh/core/vertex_set.hpp>
 
+#include <atomic>
+
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl_impl.hpp>
@@ -40,6 +42,28 @@ namespace geode
             return vertex_attribute_manager_;
         }
 
+        bool has_alive_builders() const
+        {
+            return nb_alive_builders_.load( std::memory_order_acquire ) != 0;
+        }
+
+        index_t builder_generation() const
+        {
+            return builder_generation_.load( std::memory_order_acquire );
+        }
+
+        void register_builder()
+        {
+            builder_generation_.fetch_add( 1, std::memory_order_release );
+            nb_alive_builders_.fetch_add( 1, std::memory_order_release );
+        }
+
+        void unregister_builder()
+        {
+            builder_generation_.fetch_add( 1, std::memory_order_release );
+            nb_alive_builders_.fetch_sub( 1, std::memory_order_release );
+        }
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -54,6 +78,8 @@ namespace geode
 
     private:
         mutable AttributeManager vertex_attribute_manager_;
+        std::atomic< index_t > nb_alive_builders_{ 0 };
+        std::atomic< index_t > builder_generation_{ 0 };
     };
 
     VertexSet::VertexSet() = default;
@@ -90,6 +116,26 @@ namespace geode
         return impl_->vertex_attribute_manager();
     }
 
+    bool VertexSet::has_alive_builders() const
+    {
+        return impl_->has_alive_builders();
+    }
+
+    index_t VertexSet::builder_generation() const
+    {
+        return impl_->builder_generation();
+    }
+
+    void VertexSet::register_builder( VertexSetBuilderKey /*unused*/ )
+    {
+        impl_->register_builder();
+    }
+
+    void VertexSet::unregister_builder( VertexSetBuilderKey /*unused*/ )
+    {
+        impl_->unregister_builder();
+    }
+
     template < typename Archive >
     void VertexSet::serialize( Archive& serializer )
     {
@@ -29,7 +29,10 @@
 
 #include <geode/mesh/helpers/aabb_edged_curve_helpers.hpp>
 
+#include <async++.h>
+
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/basic_objects/segment.hpp>
 #include <geode/geometry/coordinate_system.hpp>
 #include <geode/geometry/distance.hpp>
@@ -38,22 +41,40 @@
 
 #include <geode/mesh/core/edged_curve.hpp>
 
+namespace
+{
+    template < geode::index_t dimension >
+    absl::FixedArray< geode::BoundingBox< dimension > > edge_boxes(
+        const geode::EdgedCurve< dimension >& mesh )
+    {
+        absl::FixedArray< geode::BoundingBox< dimension > > box_vector(
+            mesh.nb_edges() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_edges() ),
+            [&box_vector, &mesh]( geode::index_t e ) {
+                box_vector[e].add_point(
+                    mesh.point( mesh.edge_vertex( { e, 0 } ) ) );
+                box_vector[e].add_point(
+                    mesh.point( mesh.edge_vertex( { e, 1 } ) ) );
+            } );
+        return box_vector;
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
     AABBTree< dimension > create_aabb_tree(
         const EdgedCurve< dimension >& mesh )
     {
-        absl::FixedArray< BoundingBox< dimension > > box_vector(
-            mesh.nb_edges() );
-        for( const auto e : Range{ mesh.nb_edges() } )
-        {
-            box_vector[e].add_point(
-                mesh.point( mesh.edge_vertex( { e, 0 } ) ) );
-            box_vector[e].add_point(
-                mesh.point( mesh.edge_vertex( { e, 1 } ) ) );
-        }
-        return AABBTree< dimension >{ box_vector };
+        return AABBTree< dimension >{ edge_boxes( mesh ) };
+    }
+
+    template < index_t dimension >
+    AABBTreeWide< dimension > create_aabb_tree_wide(
+        const EdgedCurve< dimension >& mesh )
+    {
+        return AABBTreeWide< dimension >{ edge_boxes( mesh ) };
     }
 
     template < index_t dimension >
@@ -86,6 +107,11 @@ namespace geode
     template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
         const EdgedCurve3D& );
 
+    template opengeode_mesh_api AABBTreeWide2D create_aabb_tree_wide< 2 >(
+        const EdgedCurve2D& );
+    template opengeode_mesh_api AABBTreeWide3D create_aabb_tree_wide< 3 >(
+        const EdgedCurve3D& );
+
     template class opengeode_mesh_api DistanceToEdge< 1 >;
     template class opengeode_mesh_api DistanceToEdge< 2 >;
     template class opengeode_mesh_api DistanceToEdge< 3 >;
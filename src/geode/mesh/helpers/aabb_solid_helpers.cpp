@@ -23,29 +23,51 @@
 
 #include <geode/mesh/helpers/aabb_solid_helpers.hpp>
 
+#include <async++.h>
+
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/distance.hpp>
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/core/tetrahedral_solid.hpp>
 
+namespace
+{
+    template < geode::index_t dimension >
+    absl::FixedArray< geode::BoundingBox< dimension > > polyhedron_boxes(
+        const geode::SolidMesh< dimension >& mesh )
+    {
+        absl::FixedArray< geode::BoundingBox< dimension > > box_vector(
+            mesh.nb_polyhedra() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_polyhedra() ),
+            [&box_vector, &mesh]( geode::index_t p ) {
+                for( const auto v :
+                    geode::LRange{ mesh.nb_polyhedron_vertices( p ) } )
+                {
+                    box_vector[p].add_point(
+                        mesh.point( mesh.polyhedron_vertex( { p, v } ) ) );
+                }
+            } );
+        return box_vector;
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
     AABBTree< dimension > create_aabb_tree( const SolidMesh< dimension >& mesh )
     {
-        absl::FixedArray< BoundingBox< dimension > > box_vector(
-            mesh.nb_polyhedra() );
-        for( const auto p : Range{ mesh.nb_polyhedra() } )
-        {
-            for( const auto v : LRange{ mesh.nb_polyhedron_vertices( p ) } )
-            {
-                box_vector[p].add_point(
-                    mesh.point( mesh.polyhedron_vertex( { p, v } ) ) );
-            }
-        }
-        return AABBTree< dimension >{ box_vector };
+        return AABBTree< dimension >{ polyhedron_boxes( mesh ) };
+    }
+
+    template < index_t dimension >
+    AABBTreeWide< dimension > create_aabb_tree_wide(
+        const SolidMesh< dimension >& mesh )
+    {
+        return AABBTreeWide< dimension >{ polyhedron_boxes( mesh ) };
     }
 
     template < index_t dimension >
@@ -80,6 +102,8 @@ namespace geode
 
     template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
         const SolidMesh3D& );
+    template opengeode_mesh_api AABBTreeWide3D create_aabb_tree_wide< 3 >(
+        const SolidMesh3D& );
 
     template class opengeode_mesh_api DistanceToTetrahedron< 3 >;
     template class opengeode_mesh_api AnisotropicDistanceToTetrahedron< 3 >;
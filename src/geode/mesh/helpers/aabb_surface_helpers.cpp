@@ -29,7 +29,10 @@
 
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 
+#include <async++.h>
+
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/coordinate_system.hpp>
 #include <geode/geometry/distance.hpp>
@@ -37,23 +40,42 @@
 
 #include <geode/mesh/core/triangulated_surface.hpp>
 
+namespace
+{
+    template < geode::index_t dimension >
+    absl::FixedArray< geode::BoundingBox< dimension > > polygon_boxes(
+        const geode::SurfaceMesh< dimension >& mesh )
+    {
+        absl::FixedArray< geode::BoundingBox< dimension > > box_vector(
+            mesh.nb_polygons() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_polygons() ),
+            [&box_vector, &mesh]( geode::index_t p ) {
+                for( const auto v :
+                    geode::LRange{ mesh.nb_polygon_vertices( p ) } )
+                {
+                    box_vector[p].add_point(
+                        mesh.point( mesh.polygon_vertex( { p, v } ) ) );
+                }
+            } );
+        return box_vector;
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
     AABBTree< dimension > create_aabb_tree(
         const SurfaceMesh< dimension >& mesh )
     {
-        absl::FixedArray< BoundingBox< dimension > > box_vector(
-            mesh.nb_polygons() );
-        for( const auto p : Range{ mesh.nb_polygons() } )
-        {
-            for( const auto v : LRange{ mesh.nb_polygon_vertices( p ) } )
-            {
-                box_vector[p].add_point(
-                    mesh.point( mesh.polygon_vertex( { p, v } ) ) );
-            }
-        }
-        return AABBTree< dimension >{ box_vector };
+        return AABBTree< dimension >{ polygon_boxes( mesh ) };
+    }
+
+    template < index_t dimension >
+    AABBTreeWide< dimension > create_aabb_tree_wide(
+        const SurfaceMesh< dimension >& mesh )
+    {
+        return AABBTreeWide< dimension >{ polygon_boxes( mesh ) };
     }
 
     template < index_t dimension >
@@ -86,6 +108,11 @@ namespace geode
     template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
         const SurfaceMesh3D& );
 
+    template opengeode_mesh_api AABBTreeWide2D create_aabb_tree_wide< 2 >(
+        const SurfaceMesh2D& );
+    template opengeode_mesh_api AABBTreeWide3D create_aabb_tree_wide< 3 >(
+        const SurfaceMesh3D& );
+
     template class opengeode_mesh_api DistanceToTriangle< 2 >;
     template class opengeode_mesh_api DistanceToTriangle< 3 >;
     template class opengeode_mesh_api AnisotropicDistanceToTriangle< 2 >;
@@ -90,6 +90,8 @@ namespace
             cell_to_barycenter_vertex;
         absl::flat_hash_map< GridFacet, geode::index_t >
             facet_to_barycenter_vertex;
+        std::vector< geode::AttributeLinearInterpolation > interpolations;
+        std::vector< geode::index_t > interpolated_vertices;
     };
 
     std::vector< geode::index_t > create_tetrahedra_from_pyramid_pattern(
@@ -466,7 +468,7 @@ namespace
     }
 
     geode::index_t create_point_from_grid( geode::SolidMeshBuilder3D& builder,
-        geode::AttributeManager& solid_attribute_manager,
+        DensificationInfo& densification_info,
         const geode::Grid3D& grid,
         absl::Span< const geode::Grid3D::VertexIndices > vertices_indices )
     {
@@ -484,13 +486,13 @@ namespace
             position += grid.grid_point( vertex_indices ) * lambda_value;
         }
         auto new_vertex_id = builder.create_point( position );
-        solid_attribute_manager.interpolate_attribute_value(
-            { interpolation_vertices, lambdas }, new_vertex_id );
+        densification_info.interpolations.emplace_back(
+            interpolation_vertices, lambdas );
+        densification_info.interpolated_vertices.push_back( new_vertex_id );
         return new_vertex_id;
     }
 
     void create_vertices_on_cell_facets( geode::SolidMeshBuilder3D& builder,
-        geode::AttributeManager& solid_attribute_manager,
         DensificationInfo& densification_info,
         const geode::Grid3D& grid,
         const geode::Grid3D::VertexIndices& cell_indices )
@@ -511,7 +513,7 @@ namespace
                         grid.cell_vertex_indices( cell_indices, cell_vertex ) );
                 }
                 const auto new_vertex_id = create_point_from_grid( builder,
-                    solid_attribute_manager, grid, facet_vertices_indices );
+                    densification_info, grid, facet_vertices_indices );
                 densification_info.facet_to_barycenter_vertex.emplace(
                     facet_to_previous, new_vertex_id );
                 if( const auto adjacent_cell =
@@ -522,7 +524,7 @@ namespace
                             adj_cell ) )
                     {
                         const auto new_adj_vertex_id = create_point_from_grid(
-                            builder, solid_attribute_manager, grid,
+                            builder, densification_info, grid,
                             grid.cell_vertices( adj_cell ) );
                         densification_info.cell_to_barycenter_vertex.emplace(
                             adj_cell, new_adj_vertex_id );
@@ -546,7 +548,7 @@ namespace
                         grid.cell_vertex_indices( cell_indices, cell_vertex ) );
                 }
                 const auto new_vertex_id = create_point_from_grid( builder,
-                    solid_attribute_manager, grid, facet_vertices_indices );
+                    densification_info, grid, facet_vertices_indices );
                 densification_info.facet_to_barycenter_vertex.emplace(
                     facet_to_next, new_vertex_id );
                 if( const auto adjacent_cell =
@@ -557,7 +559,7 @@ namespace
                             adj_cell ) )
                     {
                         const auto new_adj_vertex_id = create_point_from_grid(
-                            builder, solid_attribute_manager, grid,
+                            builder, densification_info, grid,
                             grid.cell_vertices( adj_cell ) );
                         densification_info.cell_to_barycenter_vertex.emplace(
                             adj_cell, new_adj_vertex_id );
@@ -591,13 +593,16 @@ namespace
                     cell_indices ) )
             {
                 const auto new_vertex_id = create_point_from_grid(
-                    builder, solid_attribute_manager, grid, cell_vertices );
+                    builder, densification_info, grid, cell_vertices );
                 densification_info.cell_to_barycenter_vertex.emplace(
                     cell_indices, new_vertex_id );
             }
-            create_vertices_on_cell_facets( builder, solid_attribute_manager,
-                densification_info, grid, cell_indices );
+            create_vertices_on_cell_facets(
+                builder, densification_info, grid, cell_indices );
         }
+        solid_attribute_manager.interpolate_attribute_values(
+            densification_info.interpolations,
+            densification_info.interpolated_vertices );
         return densification_info;
     }
 
@@ -263,11 +263,14 @@ namespace
             builder.set_point( vertex_id,
                 grid.grid_point( grid.vertex_indices( vertex_id ) ) );
         }
+        std::vector< geode::AttributeLinearInterpolation > interpolations;
+        std::vector< geode::index_t > new_vertices;
+        interpolations.reserve( cells_to_densify.size() );
+        new_vertices.reserve( cells_to_densify.size() );
         geode::index_t counter{ grid.nb_grid_vertices() };
         for( const auto cell_id : cells_to_densify )
         {
             const auto cell_indices = grid.cell_indices( cell_id );
-            builder.set_point( counter, grid.cell_barycenter( cell_indices ) );
             std::vector< geode::index_t > cell_vertices;
             std::vector< double > lambdas;
             cell_vertices.reserve( 4 );
@@ -280,11 +283,13 @@ namespace
                 lambdas.push_back( 0.25 );
                 position += grid.grid_point( vertex_indices ) * 0.25;
             }
-            surface_attribute_manager.interpolate_attribute_value(
-                { cell_vertices, lambdas }, counter );
+            interpolations.emplace_back( cell_vertices, lambdas );
+            new_vertices.push_back( counter );
             builder.set_point( counter, position );
             counter++;
         }
+        surface_attribute_manager.interpolate_attribute_values(
+            interpolations, new_vertices );
     }
 
     template <>
@@ -66,9 +66,9 @@ namespace geode
                 PolyhedraAroundVertex total_polyhedra;
                 while( nb_polyhedra_around != polyhedron_vertices.size() )
                 {
-                    for( auto&& polyhedron : polyhedra_around )
+                    for( const auto& polyhedron : polyhedra_around )
                     {
-                        total_polyhedra.emplace_back( std::move( polyhedron ) );
+                        total_polyhedra.emplace_back( polyhedron );
                     }
                     const auto new_vertex_id =
                         builder.create_point( mesh.point( vertex_id ) );
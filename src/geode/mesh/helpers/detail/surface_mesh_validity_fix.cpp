@@ -68,9 +68,9 @@ namespace geode
                 PolygonsAroundVertex total_polygons;
                 while( nb_polygons_around != polygon_vertices.size() )
                 {
-                    for( auto&& polygon : polygons_around )
+                    for( const auto& polygon : polygons_around )
                     {
-                        total_polygons.emplace_back( std::move( polygon ) );
+                        total_polygons.emplace_back( polygon );
                     }
                     const auto new_vertex_id =
                         builder.create_point( mesh.point( vertex_id ) );
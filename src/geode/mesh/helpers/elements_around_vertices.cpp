@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/elements_around_vertices.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/basic/range.hpp>
+
+namespace
+{
+    /*!
+     * Fills the CSR arrays with three parallel passes: counting the
+     * incidences of each vertex, writing each element vertex in its vertex
+     * range, and sorting each range for a deterministic result.
+     */
+    template < typename ElementVertex, typename Mesh >
+    void build_elements_around_vertices( const Mesh& mesh,
+        geode::index_t nb_elements,
+        std::vector< geode::index_t >& offsets,
+        std::vector< ElementVertex >& element_vertices )
+    {
+        const auto nb_vertices = mesh.nb_vertices();
+        std::vector< std::atomic< geode::index_t > > counters( nb_vertices );
+        const auto for_each_element_vertex = [&mesh, nb_elements](
+                                                 const auto& action ) {
+            async::parallel_for( async::irange( geode::index_t{ 0 },
+                                     nb_elements ),
+                [&mesh, &action]( geode::index_t element ) {
+                    for( const auto v : geode::LRange{
+                             mesh.nb_element_vertices( element ) } )
+                    {
+                        const ElementVertex element_vertex{ element, v };
+                        action( element_vertex,
+                            mesh.element_vertex( element_vertex ) );
+                    }
+                } );
+        };
+        for_each_element_vertex(
+            [&counters]( const ElementVertex& /*unused*/,
+                geode::index_t vertex ) {
+                counters[vertex].fetch_add( 1, std::memory_order_relaxed );
+            } );
+        offsets.resize( nb_vertices + 1 );
+        offsets[0] = 0;
+        for( const auto v : geode::Range{ nb_vertices } )
+        {
+            offsets[v + 1] =
+                offsets[v] + counters[v].load( std::memory_order_relaxed );
+            counters[v].store( 0, std::memory_order_relaxed );
+        }
+        element_vertices.resize( offsets.back() );
+        for_each_element_vertex(
+            [&counters, &offsets, &element_vertices](
+                const ElementVertex& element_vertex, geode::index_t vertex ) {
+                const auto position =
+                    offsets[vertex]
+                    + counters[vertex].fetch_add(
+                        1, std::memory_order_relaxed );
+                element_vertices[position] = element_vertex;
+            } );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_vertices ),
+            [&offsets, &element_vertices]( geode::index_t vertex ) {
+                std::sort( element_vertices.begin() + offsets[vertex],
+                    element_vertices.begin() + offsets[vertex + 1] );
+            } );
+    }
+
+    template < geode::index_t dimension >
+    class SurfaceElements
+    {
+    public:
+        explicit SurfaceElements( const geode::SurfaceMesh< dimension >& mesh )
+            : mesh_( mesh )
+        {
+        }
+
+        geode::index_t nb_vertices() const
+        {
+            return mesh_.nb_vertices();
+        }
+
+        geode::local_index_t nb_element_vertices( geode::index_t polygon ) const
+        {
+            return mesh_.nb_polygon_vertices( polygon );
+        }
+
+        geode::index_t element_vertex(
+            const geode::PolygonVertex& polygon_vertex ) const
+        {
+            return mesh_.polygon_vertex( polygon_vertex );
+        }
+
+    private:
+        const geode::SurfaceMesh< dimension >& mesh_;
+    };
+
+    template < geode::index_t dimension >
+    class SolidElements
+    {
+    public:
+        explicit SolidElements( const geode::SolidMesh< dimension >& mesh )
+            : mesh_( mesh )
+        {
+        }
+
+        geode::index_t nb_vertices() const
+        {
+            return mesh_.nb_vertices();
+        }
+
+        geode::local_index_t nb_element_vertices(
+            geode::index_t polyhedron ) const
+        {
+            return mesh_.nb_polyhedron_vertices( polyhedron );
+        }
+
+        geode::index_t element_vertex(
+            const geode::PolyhedronVertex& polyhedron_vertex ) const
+        {
+            return mesh_.polyhedron_vertex( polyhedron_vertex );
+        }
+
+    private:
+        const geode::SolidMesh< dimension >& mesh_;
+    };
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    PolygonsAroundVertices< dimension >::PolygonsAroundVertices(
+        const SurfaceMesh< dimension >& mesh )
+    {
+        build_elements_around_vertices< PolygonVertex >(
+            SurfaceElements< dimension >{ mesh }, mesh.nb_polygons(),
+            offsets_, polygon_vertices_ );
+    }
+
+    template < index_t dimension >
+    index_t PolygonsAroundVertices< dimension >::nb_vertices() const
+    {
+        return static_cast< index_t >( offsets_.size() - 1 );
+    }
+
+    template < index_t dimension >
+    absl::Span< const PolygonVertex >
+        PolygonsAroundVertices< dimension >::polygons_around_vertex(
+            index_t vertex_id ) const
+    {
+        return absl::MakeConstSpan( polygon_vertices_ )
+            .subspan( offsets_[vertex_id],
+                offsets_[vertex_id + 1] - offsets_[vertex_id] );
+    }
+
+    template < index_t dimension >
+    PolyhedraAroundVertices< dimension >::PolyhedraAroundVertices(
+        const SolidMesh< dimension >& mesh )
+    {
+        build_elements_around_vertices< PolyhedronVertex >(
+            SolidElements< dimension >{ mesh }, mesh.nb_polyhedra(), offsets_,
+            polyhedron_vertices_ );
+    }
+
+    template < index_t dimension >
+    index_t PolyhedraAroundVertices< dimension >::nb_vertices() const
+    {
+        return static_cast< index_t >( offsets_.size() - 1 );
+    }
+
+    template < index_t dimension >
+    absl::Span< const PolyhedronVertex >
+        PolyhedraAroundVertices< dimension >::polyhedra_around_vertex(
+            index_t vertex_id ) const
+    {
+        return absl::MakeConstSpan( polyhedron_vertices_ )
+            .subspan( offsets_[vertex_id],
+                offsets_[vertex_id + 1] - offsets_[vertex_id] );
+    }
+
+    template class opengeode_mesh_api PolygonsAroundVertices< 2 >;
+    template class opengeode_mesh_api PolygonsAroundVertices< 3 >;
+    template class opengeode_mesh_api PolyhedraAroundVertices< 3 >;
+} // namespace geode
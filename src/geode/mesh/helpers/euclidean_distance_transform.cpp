@@ -30,374 +30,371 @@
 
 #include <geode/mesh/core/grid.hpp>
 
+namespace
+{
+    /*!
+     * Number of neighboring lines processed together. Lines along a direction
+     * other than the first one are adjacent in memory, so that gathering them
+     * together reads contiguous values.
+     */
+    constexpr geode::index_t TILE_SIZE{ 16 };
+
+    constexpr auto INF = std::numeric_limits< double >::infinity();
+
+    /*!
+     * Buffers used to process a tile of lines, kept per thread to avoid
+     * allocations for each tile.
+     */
+    struct TileScratch
+    {
+        void resize( geode::index_t length )
+        {
+            if( sites.size() >= length )
+            {
+                return;
+            }
+            tile.resize( static_cast< size_t >( length ) * TILE_SIZE );
+            sites.resize( length );
+            boundaries.resize( length + 1 );
+            line.resize( length );
+        }
+
+        std::vector< double > tile;
+        std::vector< geode::index_t > sites;
+        std::vector< double > boundaries;
+        std::vector< double > line;
+    };
+
+    TileScratch& thread_scratch( geode::index_t length )
+    {
+        static thread_local TileScratch scratch;
+        scratch.resize( length );
+        return scratch;
+    }
+
+    /*!
+     * Exact 1D squared distance transform of a line (lower envelope of
+     * parabolas, Felzenszwalb and Huttenlocher). Sites with a value above
+     * max_value cannot produce a value below it and are skipped, computed
+     * values above max_value are set to infinity.
+     */
+    void transform_line( absl::Span< double > values,
+        double squared_length,
+        double max_value,
+        TileScratch& scratch )
+    {
+        const auto length = static_cast< geode::index_t >( values.size() );
+        auto& sites = scratch.sites;
+        auto& boundaries = scratch.boundaries;
+        const auto parabola = [&values, squared_length]( geode::index_t site ) {
+            return values[site] + squared_length * site * site;
+        };
+        geode::index_t nb_sites{ 0 };
+        for( const auto q : geode::Range{ length } )
+        {
+            if( values[q] == INF || values[q] > max_value )
+            {
+                continue;
+            }
+            if( nb_sites == 0 )
+            {
+                sites[0] = q;
+                boundaries[0] = -INF;
+                boundaries[1] = INF;
+                nb_sites = 1;
+                continue;
+            }
+            auto k = nb_sites - 1;
+            auto intersection =
+                ( parabola( q ) - parabola( sites[k] ) )
+                / ( 2 * squared_length * ( q - sites[k] ) );
+            while( intersection <= boundaries[k] )
+            {
+                k--;
+                intersection = ( parabola( q ) - parabola( sites[k] ) )
+                               / ( 2 * squared_length * ( q - sites[k] ) );
+            }
+            k++;
+            sites[k] = q;
+            boundaries[k] = intersection;
+            boundaries[k + 1] = INF;
+            nb_sites = k + 1;
+        }
+        auto& line = scratch.line;
+        if( nb_sites == 0 )
+        {
+            absl::c_fill( values, INF );
+            return;
+        }
+        geode::index_t k{ 0 };
+        for( const auto q : geode::Range{ length } )
+        {
+            while( boundaries[k + 1] < q )
+            {
+                k++;
+            }
+            const auto offset = static_cast< double >( q )
+                                - static_cast< double >( sites[k] );
+            const auto value =
+                squared_length * offset * offset + values[sites[k]];
+            line[q] = value > max_value ? INF : value;
+        }
+        absl::c_copy( absl::MakeConstSpan( line.data(), length ),
+            values.begin() );
+    }
+} // namespace
+
 namespace geode
 {
-    template < index_t dimension >
+    template < index_t dimension, typename T >
     class EuclideanDistanceTransform
     {
         using Index = typename Grid< dimension >::CellIndices;
 
     public:
         EuclideanDistanceTransform( const Grid< dimension >& grid,
-            absl::Span< const Index > grid_cell_id,
-            std::string_view distance_map_name )
-            : grid_( grid ), squared_cell_length_{}
+            absl::Span< const Index > grid_cell_ids,
+            std::string_view distance_map_name,
+            double max_distance )
+            : grid_( grid ),
+              squared_max_distance_{ max_distance == INF
+                                         ? INF
+                                         : max_distance * max_distance }
         {
             AttributeProperties attribute_properties;
             attribute_properties.assignable = false;
             attribute_properties.interpolable = false;
             attribute_properties.transferable = true;
-            AttributeValues< double > distance_map_values;
-            distance_map_values.default_value =
-                std::numeric_limits< double >::max();
-            distance_map_values.no_value = std::numeric_limits< double >::max();
+            AttributeValues< T > distance_map_values;
+            distance_map_values.default_value = std::numeric_limits< T >::max();
+            distance_map_values.no_value = std::numeric_limits< T >::max();
             const auto distance_map_id =
                 grid.cell_attribute_manager()
-                    .template create_attribute< VariableAttribute, double >(
+                    .template create_attribute< VariableAttribute, T >(
                         distance_map_name, distance_map_values,
                         attribute_properties );
             distance_map_ =
                 grid.cell_attribute_manager()
-                    .template find_attribute< VariableAttribute, double >(
+                    .template find_attribute< VariableAttribute, T >(
                         distance_map_id );
+            const auto origin = grid_.cell_index( Index{} );
             for( const auto d : LRange( dimension ) )
             {
                 squared_cell_length_[d] = grid_.cell_length_in_direction( d )
                                           * grid_.cell_length_in_direction( d );
+                Index unit{};
+                unit[d] = 1;
+                strides_[d] = grid_.cell_index( unit ) - origin;
             }
-            for( const auto& cell_id : grid_cell_id )
+            initialize_box( grid_cell_ids, max_distance );
+            values_ = distance_map_->modifiable_values();
+            async::parallel_for( async::irange( size_t{ 0 }, values_.size() ),
+                [this]( size_t c ) {
+                    values_[c] = std::numeric_limits< T >::infinity();
+                } );
+            for( const auto& cell_id : grid_cell_ids )
             {
-                distance_map_->set_value( grid_.cell_index( cell_id ), 0. );
+                values_[grid_.cell_index( cell_id )] = 0;
             }
         }
 
-        std::shared_ptr< VariableAttribute< double > > distance_map() const
+        std::shared_ptr< VariableAttribute< T > > distance_map() const
         {
             return distance_map_;
         }
 
-        void compute_squared_distance_map();
-
-        void squared_root_filter()
+        void compute_squared_distance_map()
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, grid_.nb_cells() ),
-                [this]( index_t cell ) {
-                    distance_map_->modify_value( cell, []( double& value ) {
-                        if( value <= 0. )
-                        {
-                            value = 0;
-                            return;
-                        }
-                        value = std::sqrt( value );
-                    } );
-                } );
-            return;
+            if( box_is_empty() )
+            {
+                return;
+            }
+            ProgressLogger logger{ Logger::LEVEL::info,
+                absl::StrCat(
+                    "Compute ", dimension, "D euclidian distance" ),
+                dimension };
+            for( const auto d : LRange{ dimension } )
+            {
+                transform_direction( d );
+                logger.increment();
+            }
         }
 
-    private:
-        void propagate_directional_squared_distance( const index_t direction );
-
-        double propagate_directional_step_squared_distance(
-            const Index& from_index,
-            const Index& to_index,
-            const index_t direction,
-            const double last_step_squared_distance )
+        void squared_root_filter()
         {
-            const auto old_distance =
-                distance_map_->value( grid_.cell_index( from_index ) );
-            const auto step_squared_distance =
-                old_distance == 0 ? squared_cell_length_[direction]
-                                  : last_step_squared_distance
-                                        + 2 * squared_cell_length_[direction];
-            const auto new_distance = old_distance + step_squared_distance;
-            distance_map_->modify_value(
-                grid_.cell_index( to_index ), [new_distance]( double& value ) {
-                    value = std::min( value, new_distance );
+            async::parallel_for( async::irange( size_t{ 0 }, values_.size() ),
+                [this]( size_t cell ) {
+                    auto& value = values_[cell];
+                    if( value == std::numeric_limits< T >::infinity() )
+                    {
+                        value = std::numeric_limits< T >::max();
+                        return;
+                    }
+                    if( value <= 0. )
+                    {
+                        value = 0;
+                        return;
+                    }
+                    value = std::sqrt( value );
                 } );
-            return step_squared_distance;
-        }
-
-        void combine_squared_distance_components( const index_t direction );
-
-        double directional_squared_distance( const index_t from,
-            const index_t to,
-            const index_t direction ) const
-        {
-            const auto directional_distance =
-                static_cast< double >( from ) - static_cast< double >( to );
-            return directional_distance * directional_distance
-                   * squared_cell_length_[direction];
         }
 
     private:
-        const Grid< dimension >& grid_;
-        std::array< double, dimension > squared_cell_length_;
-        std::shared_ptr< VariableAttribute< double > > distance_map_;
-    };
-
-    template <>
-    void
-        EuclideanDistanceTransform< 2 >::propagate_directional_squared_distance(
-            const index_t d )
-    {
-        const auto d2 = d == 1 ? 0 : 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 ) );
-        index_t task_id{ 0 };
-        for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
+        /*!
+         * Only cells closer than max_distance to the seed bounding box can
+         * have a distance below max_distance: computations are restricted
+         * to this box.
+         */
+        void initialize_box(
+            absl::Span< const Index > grid_cell_ids, double max_distance )
         {
-            tasks[task_id++] = async::spawn( [this, d, d2, c2] {
-                double step_squared_distance{ 0. };
-                for( const auto c :
-                    Range{ 1, grid_.nb_cells_in_direction( d ) } )
+            for( const auto d : LRange{ dimension } )
+            {
+                box_min_[d] = 0;
+                box_max_[d] = grid_.nb_cells_in_direction( d );
+            }
+            if( max_distance == INF )
+            {
+                return;
+            }
+            Index seed_min;
+            Index seed_max;
+            for( const auto d : LRange{ dimension } )
+            {
+                seed_min[d] = NO_ID;
+                seed_max[d] = 0;
+            }
+            for( const auto& cell_id : grid_cell_ids )
+            {
+                for( const auto d : LRange{ dimension } )
                 {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    auto prev_index = index;
-                    prev_index[d] = c - 1;
-                    step_squared_distance =
-                        propagate_directional_step_squared_distance(
-                            prev_index, index, d, step_squared_distance );
+                    seed_min[d] = std::min( seed_min[d], cell_id[d] );
+                    seed_max[d] = std::max( seed_max[d], cell_id[d] );
                 }
-                step_squared_distance = 0.;
-                for( const auto c :
-                    ReverseRange{ grid_.nb_cells_in_direction( d ) - 1 } )
+            }
+            for( const auto d : LRange{ dimension } )
+            {
+                if( grid_cell_ids.empty() )
                 {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    auto prev_index = index;
-                    prev_index[d] = c + 1;
-                    step_squared_distance =
-                        propagate_directional_step_squared_distance(
-                            prev_index, index, d, step_squared_distance );
+                    box_max_[d] = 0;
+                    continue;
                 }
-            } );
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
-    template <>
-    void
-        EuclideanDistanceTransform< 3 >::propagate_directional_squared_distance(
-            const index_t d )
-    {
-        const auto d2 = d == 2 ? 0 : d + 1;
-        const auto d3 = d2 == 2 ? 0 : d2 + 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 )
-            * grid_.nb_cells_in_direction( d3 ) );
-        index_t task_id{ 0 };
-        for( const auto c3 : Range{ grid_.nb_cells_in_direction( d3 ) } )
-        {
-            for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-            {
-                tasks[task_id++] = async::spawn( [this, d, d2, d3, c2, c3] {
-                    double step_squared_distance{ 0 };
-                    for( const auto c :
-                        Range{ 1, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        auto prev_index = index;
-                        prev_index[d] = c - 1;
-                        step_squared_distance =
-                            propagate_directional_step_squared_distance(
-                                prev_index, index, d, step_squared_distance );
-                    }
-                    step_squared_distance = 0;
-                    for( const auto c :
-                        ReverseRange{ grid_.nb_cells_in_direction( d ) - 1 } )
-                    {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        auto prev_index = index;
-                        prev_index[d] = c + 1;
-                        step_squared_distance =
-                            propagate_directional_step_squared_distance(
-                                prev_index, index, d, step_squared_distance );
-                    }
-                } );
+                const auto margin = static_cast< index_t >( std::min(
+                    std::ceil(
+                        max_distance / grid_.cell_length_in_direction( d ) ),
+                    static_cast< double >( box_max_[d] ) ) );
+                box_min_[d] = seed_min[d] > margin ? seed_min[d] - margin : 0;
+                box_max_[d] = std::min( seed_max[d] + margin + 1, box_max_[d] );
             }
         }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
 
-    template <>
-    void EuclideanDistanceTransform< 2 >::combine_squared_distance_components(
-        const index_t d )
-    {
-        const auto d2 = d == 1 ? 0 : 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 ) );
-        index_t task_id{ 0 };
-        for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
+        bool box_is_empty() const
         {
-            tasks[task_id++] = async::spawn( [this, d, d2, c2] {
-                absl::FixedArray< double > temps_dist(
-                    grid_.nb_cells_in_direction( d ) );
-                for( const auto c :
-                    Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                {
-                    auto min_dist = std::numeric_limits< double >::max();
-                    for( const auto cf :
-                        Range{ c, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        const auto step_squared_distance =
-                            directional_squared_distance( c, cf, d );
-                        if( min_dist < step_squared_distance )
-                        {
-                            break;
-                        }
-                        Index index;
-                        index[d] = cf;
-                        index[d2] = c2;
-                        min_dist = std::min( min_dist,
-                            distance_map_->value( grid_.cell_index( index ) )
-                                + step_squared_distance );
-                    }
-                    for( const auto cb : ReverseRange{ c, 0 } )
-                    {
-                        const auto step_squared_distance =
-                            directional_squared_distance( c, cb, d );
-                        if( min_dist < step_squared_distance )
-                        {
-                            break;
-                        }
-                        Index index;
-                        index[d] = cb;
-                        index[d2] = c2;
-                        min_dist = std::min( min_dist,
-                            distance_map_->value( grid_.cell_index( index ) )
-                                + step_squared_distance );
-                    }
-                    temps_dist[c] = min_dist;
-                }
-                for( const auto c :
-                    Range{ 0, grid_.nb_cells_in_direction( d ) } )
+            for( const auto d : LRange{ dimension } )
+            {
+                if( box_min_[d] >= box_max_[d] )
                 {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    distance_map_->set_value(
-                        grid_.cell_index( index ), temps_dist[c] );
+                    return true;
                 }
-            } );
+            }
+            return false;
         }
-        for( auto& task : async::when_all( tasks ).get() )
+
+        index_t box_extent( index_t d ) const
         {
-            task.get();
+            return box_max_[d] - box_min_[d];
         }
-    }
-    template <>
-    void EuclideanDistanceTransform< 3 >::combine_squared_distance_components(
-        const index_t d )
-    {
-        const auto d2 = d == 2 ? 0 : d + 1;
-        const auto d3 = d2 == 2 ? 0 : d2 + 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 )
-            * grid_.nb_cells_in_direction( d3 ) );
-        index_t task_id{ 0 };
-        for( const auto c3 : Range{ grid_.nb_cells_in_direction( d3 ) } )
+
+        /*!
+         * Apply the 1D transform on every line of the box along the given
+         * direction. Lines are processed by tiles of TILE_SIZE neighbors in
+         * the fastest other direction.
+         */
+        void transform_direction( index_t direction )
         {
-            for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
+            const index_t fast = direction == 0 ? 1 : 0;
+            index_t nb_slow_lines{ 1 };
+            std::array< index_t, dimension > slow_directions;
+            index_t nb_slow_directions{ 0 };
+            for( const auto d : LRange{ dimension } )
             {
-                tasks[task_id++] = async::spawn( [this, d, d2, d3, c2, c3] {
-                    absl::FixedArray< double > temps_dist(
-                        grid_.nb_cells_in_direction( d ) );
-                    for( const auto c :
-                        Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        auto min_dist = std::numeric_limits< double >::max();
-                        for( const auto cf :
-                            Range{ c, grid_.nb_cells_in_direction( d ) } )
-                        {
-                            const auto step_squared_distance =
-                                directional_squared_distance( c, cf, d );
-                            if( min_dist < step_squared_distance )
-                            {
-                                break;
-                            }
-                            Index index;
-                            index[d] = cf;
-                            index[d2] = c2;
-                            index[d3] = c3;
-                            min_dist = std::min(
-                                min_dist, distance_map_->value(
-                                              grid_.cell_index( index ) )
-                                              + step_squared_distance );
-                        }
-                        for( const auto cb : ReverseRange{ c, 0 } )
-                        {
-                            const auto step_squared_distance =
-                                directional_squared_distance( c, cb, d );
-                            if( min_dist < step_squared_distance )
-                            {
-                                break;
-                            }
-                            Index index;
-                            index[d] = cb;
-                            index[d2] = c2;
-                            index[d3] = c3;
-                            min_dist = std::min(
-                                min_dist, distance_map_->value(
-                                              grid_.cell_index( index ) )
-                                              + step_squared_distance );
-                        }
-                        temps_dist[c] = min_dist;
-                    }
-                    for( const auto c :
-                        Range{ 0, grid_.nb_cells_in_direction( d ) } )
+                if( d != direction && d != fast )
+                {
+                    slow_directions[nb_slow_directions++] = d;
+                    nb_slow_lines *= box_extent( d );
+                }
+            }
+            const auto nb_fast_tiles =
+                ( box_extent( fast ) + TILE_SIZE - 1 ) / TILE_SIZE;
+            async::parallel_for(
+                async::irange( index_t{ 0 }, nb_fast_tiles * nb_slow_lines ),
+                [this, direction, fast, nb_fast_tiles, &slow_directions,
+                    nb_slow_directions]( index_t tile_id ) {
+                    Index first_cell;
+                    first_cell[direction] = box_min_[direction];
+                    const auto fast_tile = tile_id % nb_fast_tiles;
+                    first_cell[fast] = box_min_[fast] + fast_tile * TILE_SIZE;
+                    auto slow_id = tile_id / nb_fast_tiles;
+                    for( const auto s : Range{ nb_slow_directions } )
                     {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        distance_map_->set_value(
-                            grid_.cell_index( index ), temps_dist[c] );
+                        const auto d = slow_directions[s];
+                        first_cell[d] = box_min_[d] + slow_id % box_extent( d );
+                        slow_id /= box_extent( d );
                     }
+                    const auto nb_lines = std::min(
+                        TILE_SIZE, box_max_[fast] - first_cell[fast] );
+                    transform_tile( first_cell, direction, fast, nb_lines );
                 } );
-            }
         }
-        for( auto& task : async::when_all( tasks ).get() )
+
+        void transform_tile( const Index& first_cell,
+            index_t direction,
+            index_t fast,
+            index_t nb_lines )
         {
-            task.get();
+            const auto length = box_extent( direction );
+            auto& scratch = thread_scratch( length );
+            auto first = grid_.cell_index( first_cell );
+            const auto line_stride = strides_[direction];
+            const auto tile_stride = strides_[fast];
+            const auto cell = [first, line_stride, tile_stride](
+                                  index_t line, index_t position ) {
+                return first + position * line_stride + line * tile_stride;
+            };
+            auto& tile = scratch.tile;
+            for( const auto p : Range{ length } )
+            {
+                for( const auto l : Range{ nb_lines } )
+                {
+                    tile[l * length + p] = values_[cell( l, p )];
+                }
+            }
+            for( const auto l : Range{ nb_lines } )
+            {
+                transform_line( absl::MakeSpan( &tile[l * length], length ),
+                    squared_cell_length_[direction], squared_max_distance_,
+                    scratch );
+            }
+            for( const auto p : Range{ length } )
+            {
+                for( const auto l : Range{ nb_lines } )
+                {
+                    values_[cell( l, p )] =
+                        static_cast< T >( tile[l * length + p] );
+                }
+            }
         }
-    }
-    template <>
-    void EuclideanDistanceTransform< 2 >::compute_squared_distance_map()
-    {
-        ProgressLogger logger{ Logger::LEVEL::info,
-            "Compute 2D euclidian distance", 2 };
-        propagate_directional_squared_distance( 0 );
-        logger.increment();
-        combine_squared_distance_components( 1 );
-        logger.increment();
-    }
-    template <>
-    void EuclideanDistanceTransform< 3 >::compute_squared_distance_map()
-    {
-        ProgressLogger logger{ Logger::LEVEL::info,
-            "Compute 3D euclidian distance", 3 };
-        propagate_directional_squared_distance( 0 );
-        logger.increment();
-        combine_squared_distance_components( 1 );
-        logger.increment();
-        combine_squared_distance_components( 2 );
-        logger.increment();
-    }
+
+    private:
+        const Grid< dimension >& grid_;
+        double squared_max_distance_;
+        std::array< double, dimension > squared_cell_length_;
+        std::array< index_t, dimension > strides_;
+        Index box_min_;
+        Index box_max_;
+        std::shared_ptr< VariableAttribute< T > > distance_map_;
+        absl::Span< T > values_;
+    };
 
     template < index_t dimension >
     std::shared_ptr< VariableAttribute< double > > euclidean_distance_transform(
@@ -406,8 +403,20 @@ namespace geode
             grid_cell_ids,
         std::string_view distance_map_name )
     {
-        EuclideanDistanceTransform< dimension > edt{ grid, grid_cell_ids,
-            distance_map_name };
+        return euclidean_distance_transform< double, dimension >(
+            grid, grid_cell_ids, distance_map_name, INF );
+    }
+
+    template < typename T, index_t dimension >
+    std::shared_ptr< VariableAttribute< T > > euclidean_distance_transform(
+        const Grid< dimension >& grid,
+        absl::Span< const typename Grid< dimension >::CellIndices >
+            grid_cell_ids,
+        std::string_view distance_map_name,
+        double max_distance )
+    {
+        EuclideanDistanceTransform< dimension, T > edt{ grid, grid_cell_ids,
+            distance_map_name, max_distance };
         edt.compute_squared_distance_map();
         edt.squared_root_filter();
         return edt.distance_map();
@@ -421,4 +430,25 @@ namespace geode
         opengeode_mesh_api euclidean_distance_transform< 3 >( const Grid3D&,
             absl::Span< const Grid3D::CellIndices >,
             std::string_view );
+
+    template std::shared_ptr< VariableAttribute< double > > opengeode_mesh_api
+        euclidean_distance_transform< double, 2 >( const Grid2D&,
+            absl::Span< const Grid2D::CellIndices >,
+            std::string_view,
+            double );
+    template std::shared_ptr< VariableAttribute< double > > opengeode_mesh_api
+        euclidean_distance_transform< double, 3 >( const Grid3D&,
+            absl::Span< const Grid3D::CellIndices >,
+            std::string_view,
+            double );
+    template std::shared_ptr< VariableAttribute< float > > opengeode_mesh_api
+        euclidean_distance_transform< float, 2 >( const Grid2D&,
+            absl::Span< const Grid2D::CellIndices >,
+            std::string_view,
+            double );
+    template std::shared_ptr< VariableAttribute< float > > opengeode_mesh_api
+        euclidean_distance_transform< float, 3 >( const Grid3D&,
+            absl::Span< const Grid3D::CellIndices >,
+            std::string_view,
+            double );
 } // namespace geode
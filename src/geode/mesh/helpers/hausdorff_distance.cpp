@@ -23,39 +23,87 @@
 
 #include <geode/mesh/helpers/hausdorff_distance.hpp>
 
+#include <atomic>
+#include <cmath>
+
+#include <async++.h>
+
 #include <geode/basic/assert.hpp>
-#include <geode/basic/logger.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/distance.hpp>
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/core/triangulated_surface.hpp>
-#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
-#include <geode/mesh/io/triangulated_surface_input.hpp>
-
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 
 namespace
 {
-    double one_sided_hausdorff_distance(
-        const geode::TriangulatedSurface3D& mesh_A,
-        const geode::TriangulatedSurface3D& mesh_B )
+    class MaximalDistance
     {
-        const auto mesh_B_tree = geode::create_aabb_tree( mesh_B );
-        const geode::DistanceToTriangle3D distance_action{ mesh_B };
-        double min_dist = 0;
-        for( auto v : geode::Range{ mesh_A.nb_vertices() } )
+    public:
+        explicit MaximalDistance( const geode::TriangulatedSurface3D& mesh )
+            : tree_( geode::create_aabb_tree( mesh ) ), distance_action_( mesh )
+        {
+        }
+
+        void add_sample( const geode::Point3D& point )
         {
-            const auto& query = mesh_A.point( v );
-            const auto closest_element =
-                mesh_B_tree.closest_element_box( query, distance_action );
-            const auto distance = std::get< 1 >( closest_element );
-            if( distance > min_dist )
+            auto current_max = max_distance_.load( std::memory_order_relaxed );
+            const auto distance = std::get< 1 >( tree_.closest_element_box(
+                point, distance_action_, current_max ) );
+            while( distance > current_max
+                   && !max_distance_.compare_exchange_weak( current_max,
+                       distance, std::memory_order_relaxed ) )
             {
-                min_dist = distance;
             }
         }
-        return min_dist;
+
+        [[nodiscard]] double value() const
+        {
+            return max_distance_.load();
+        }
+
+    private:
+        const geode::AABBTree3D tree_;
+        const geode::DistanceToTriangle3D distance_action_;
+        std::atomic< double > max_distance_{ 0 };
+    };
+
+    void sample_triangle( const geode::Triangle3D& triangle,
+        double sampling_distance,
+        MaximalDistance& max_distance )
+    {
+        const auto& vertices = triangle.vertices();
+        const geode::Point3D& p0 = vertices[0];
+        const geode::Point3D& p1 = vertices[1];
+        const geode::Point3D& p2 = vertices[2];
+        const auto max_length =
+            std::max( { geode::point_point_distance( p0, p1 ),
+                geode::point_point_distance( p1, p2 ),
+                geode::point_point_distance( p2, p0 ) } );
+        const auto nb_segments = static_cast< geode::index_t >(
+            std::ceil( max_length / sampling_distance ) );
+        if( nb_segments < 2 )
+        {
+            return;
+        }
+        const auto step = 1. / nb_segments;
+        for( const auto i : geode::Range{ nb_segments + 1 } )
+        {
+            for( const auto j : geode::Range{ nb_segments + 1 - i } )
+            {
+                const auto k = nb_segments - i - j;
+                if( i == nb_segments || j == nb_segments || k == nb_segments )
+                {
+                    // Triangle vertices are already sampled
+                    continue;
+                }
+                max_distance.add_sample( p0 * ( i * step ) + p1 * ( j * step )
+                                         + p2 * ( k * step ) );
+            }
+        }
     }
 } // namespace
 
@@ -64,7 +112,44 @@ namespace geode
     double hausdorff_distance( const TriangulatedSurface3D& mesh_A,
         const TriangulatedSurface3D& mesh_B )
     {
-        return std::max( one_sided_hausdorff_distance( mesh_A, mesh_B ),
-            one_sided_hausdorff_distance( mesh_B, mesh_A ) );
+        return hausdorff_distances( mesh_A, mesh_B, 0 ).value();
+    }
+
+    double one_sided_hausdorff_distance( const TriangulatedSurface3D& mesh_A,
+        const TriangulatedSurface3D& mesh_B,
+        double sampling_distance )
+    {
+        OpenGeodeMeshException::check_exception( sampling_distance >= 0,
+            nullptr, OpenGeodeException::TYPE::data,
+            "[one_sided_hausdorff_distance] Sampling distance should not be "
+            "negative" );
+        MaximalDistance max_distance{ mesh_B };
+        async::parallel_for(
+            async::irange( index_t{ 0 }, mesh_A.nb_vertices() ),
+            [&max_distance, &mesh_A]( index_t v ) {
+                max_distance.add_sample( mesh_A.point( v ) );
+            } );
+        if( sampling_distance > 0 )
+        {
+            async::parallel_for(
+                async::irange( index_t{ 0 }, mesh_A.nb_polygons() ),
+                [&max_distance, &mesh_A, sampling_distance]( index_t t ) {
+                    sample_triangle(
+                        mesh_A.triangle( t ), sampling_distance, max_distance );
+                } );
+        }
+        return max_distance.value();
+    }
+
+    HausdorffDistances hausdorff_distances( const TriangulatedSurface3D& mesh_A,
+        const TriangulatedSurface3D& mesh_B,
+        double sampling_distance )
+    {
+        HausdorffDistances result;
+        result.A_to_B = one_sided_hausdorff_distance(
+            mesh_A, mesh_B, sampling_distance );
+        result.B_to_A = one_sided_hausdorff_distance(
+            mesh_B, mesh_A, sampling_distance );
+        return result;
     }
 } // namespace geode
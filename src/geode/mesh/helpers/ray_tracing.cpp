@@ -23,9 +23,13 @@
 
 #include <geode/mesh/helpers/ray_tracing.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/basic_objects/segment.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/bounding_box.hpp>
@@ -223,6 +227,49 @@ namespace
         }
         return test_edge_mode( mesh, polygon0, polygon1 );
     }
+
+    template < typename RayTracing, typename Mesh >
+    auto compute_packet_intersections( const Mesh& mesh,
+        const geode::AABBTree< Mesh::dim >& aabb,
+        absl::Span< const geode::Ray< Mesh::dim > > rays )
+    {
+        std::vector< RayTracing > tracings;
+        tracings.reserve( rays.size() );
+        for( const auto& ray : rays )
+        {
+            tracings.emplace_back( mesh, aabb.bounding_box(), ray );
+        }
+        auto action = [&tracings](
+                          geode::index_t ray_id, geode::index_t element_id ) {
+            return tracings[ray_id]( element_id );
+        };
+        aabb.compute_ray_packet_element_bbox_intersections( rays, action );
+        std::vector< decltype( tracings.front().all_intersections() ) >
+            intersections;
+        intersections.reserve( tracings.size() );
+        for( const auto& tracing : tracings )
+        {
+            intersections.push_back( tracing.all_intersections() );
+        }
+        return intersections;
+    }
+
+    template < typename RayTracing, typename Mesh >
+    auto compute_packet_intersections( const Mesh& mesh,
+        const geode::AABBTreeWide< Mesh::dim >& aabb,
+        absl::Span< const geode::Ray< Mesh::dim > > rays )
+    {
+        std::vector< decltype( std::declval< const RayTracing& >()
+                                   .all_intersections() ) >
+            intersections( rays.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, rays.size() ),
+            [&mesh, &aabb, &rays, &intersections]( size_t r ) {
+                RayTracing tracing{ mesh, aabb.bounding_box(), rays[r] };
+                aabb.compute_ray_element_bbox_intersections( rays[r], tracing );
+                intersections[r] = tracing.all_intersections();
+            } );
+        return intersections;
+    }
 } // namespace
 
 namespace geode
@@ -404,6 +451,24 @@ namespace geode
         return impl_->all_intersections();
     }
 
+    std::vector< std::vector< RayTracing2D::EdgeDistance > >
+        RayTracing2D::packet_intersections( const EdgedCurve2D& mesh,
+            const AABBTree2D& aabb,
+            absl::Span< const Ray2D > rays )
+    {
+        return compute_packet_intersections< RayTracing2D >(
+            mesh, aabb, rays );
+    }
+
+    std::vector< std::vector< RayTracing2D::EdgeDistance > >
+        RayTracing2D::packet_intersections( const EdgedCurve2D& mesh,
+            const AABBTreeWide2D& aabb,
+            absl::Span< const Ray2D > rays )
+    {
+        return compute_packet_intersections< RayTracing2D >(
+            mesh, aabb, rays );
+    }
+
     bool RayTracing2D::operator()( index_t edge_id )
     {
         return impl_->compute( edge_id );
@@ -632,6 +697,24 @@ namespace geode
         return impl_->all_intersections();
     }
 
+    std::vector< std::vector< RayTracing3D::PolygonDistance > >
+        RayTracing3D::packet_intersections( const SurfaceMesh3D& mesh,
+            const AABBTree3D& aabb,
+            absl::Span< const Ray3D > rays )
+    {
+        return compute_packet_intersections< RayTracing3D >(
+            mesh, aabb, rays );
+    }
+
+    std::vector< std::vector< RayTracing3D::PolygonDistance > >
+        RayTracing3D::packet_intersections( const SurfaceMesh3D& mesh,
+            const AABBTreeWide3D& aabb,
+            absl::Span< const Ray3D > rays )
+    {
+        return compute_packet_intersections< RayTracing3D >(
+            mesh, aabb, rays );
+    }
+
     bool RayTracing3D::operator()( index_t polygon_id )
     {
         return impl_->compute( polygon_id );
@@ -33,6 +33,7 @@
 #include <geode/basic/detail/geode_output_impl.hpp>
 #include <geode/basic/io.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/mesh/core/light_regular_grid.hpp>
 
@@ -42,18 +43,19 @@ namespace geode
     std::vector< std::string > LightRegularGridOutput< dimension >::write(
         const LightRegularGrid< dimension >& grid ) const
     {
-        std::ofstream file{ to_string( this->filename() ),
-            std::ofstream::binary };
+        const auto file = open_output_file( this->filename() );
         TContext context{};
         BitseryExtensions::register_serialize_pcontext(
             std::get< 0 >( context ) );
-        Serializer archive{ context, file };
+        std::get< detail::RawValuesContext >( context ).output = file.get();
+        Serializer archive{ context, *file };
         archive.object( grid );
         archive.adapter().flush();
         OpenGeodeMeshException::check_exception(
             std::get< 1 >( context ).isValid(), nullptr,
             OpenGeodeException::TYPE::internal,
             "[Bitsery::write] Error while writing file: ", this->filename() );
+        file->close();
         return { to_string( this->filename() ) };
     }
 
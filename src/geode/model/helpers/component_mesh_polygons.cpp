@@ -559,8 +559,7 @@ namespace
         const geode::PolygonVertices& polygon_unique_vertices,
         const geode::ComponentType& type )
     {
-        std::vector< absl::Span< const geode::ComponentMeshVertex > >
-            unique_vertices;
+        std::vector< geode::ComponentMeshVertices > unique_vertices;
         unique_vertices.reserve( polygon_unique_vertices.size() );
         for( const auto polygon_unique_vertex : polygon_unique_vertices )
         {
@@ -577,8 +576,7 @@ namespace
         const geode::PolygonVertices& polygon_unique_vertices,
         const geode::ComponentID& component )
     {
-        std::vector< absl::Span< const geode::ComponentMeshVertex > >
-            unique_vertices;
+        std::vector< geode::ComponentMeshVertices > unique_vertices;
         unique_vertices.reserve( polygon_unique_vertices.size() );
         for( const auto polygon_unique_vertex : polygon_unique_vertices )
         {
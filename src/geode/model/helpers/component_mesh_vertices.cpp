@@ -33,8 +33,7 @@ namespace
         geode::ComponentMeshVertexGeneric< dimension >& result,
         geode::ComponentMeshVertexGenericStorage< dimension >& current_result,
         const geode::ComponentMeshVertex& previous,
-        absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-            unique_vertices,
+        absl::Span< const geode::ComponentMeshVertices > unique_vertices,
         const Compare& compare )
     {
         if( index == unique_vertices.size() )
@@ -64,17 +63,16 @@ namespace
     template < geode::index_t dimension, typename Compare >
     geode::ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices,
+            absl::Span< const geode::ComponentMeshVertices > unique_vertices,
             const Compare& compare )
     {
         if( unique_vertices.empty() )
         {
             return {};
         }
-        for( const auto& span : unique_vertices )
+        for( const auto& vertices : unique_vertices )
         {
-            if( span.empty() )
+            if( vertices.empty() )
             {
                 return {};
             }
@@ -95,11 +93,11 @@ namespace
 namespace geode
 {
     ComponentMeshVertexPairs component_mesh_vertex_pairs(
-        absl::Span< const ComponentMeshVertex > unique_vertices0,
-        absl::Span< const ComponentMeshVertex > unique_vertices1 )
+        const ComponentMeshVertices& unique_vertices0,
+        const ComponentMeshVertices& unique_vertices1 )
     {
         return ::component_mesh_vertex_generic< 2 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices0, unique_vertices1 ),
             []( const ComponentMeshVertex& cmv0,
                 const ComponentMeshVertex& cmv1 ) {
@@ -108,12 +106,12 @@ namespace geode
     }
 
     ComponentMeshVertexPairs component_mesh_vertex_pairs(
-        absl::Span< const ComponentMeshVertex > unique_vertices0,
-        absl::Span< const ComponentMeshVertex > unique_vertices1,
+        const ComponentMeshVertices& unique_vertices0,
+        const ComponentMeshVertices& unique_vertices1,
         const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< 2 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices0, unique_vertices1 ),
             [type]( const ComponentMeshVertex& cmv0,
                 const ComponentMeshVertex& cmv1 ) {
@@ -123,12 +121,12 @@ namespace geode
     }
 
     ComponentMeshVertexPairs component_mesh_vertex_pairs(
-        absl::Span< const ComponentMeshVertex > unique_vertices0,
-        absl::Span< const ComponentMeshVertex > unique_vertices1,
+        const ComponentMeshVertices& unique_vertices0,
+        const ComponentMeshVertices& unique_vertices1,
         const ComponentID& component )
     {
         return ::component_mesh_vertex_generic< 2 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices0, unique_vertices1 ),
             [&component]( const ComponentMeshVertex& cmv0,
                 const ComponentMeshVertex& cmv1 ) {
@@ -138,12 +136,12 @@ namespace geode
     }
 
     ComponentMeshVertexTriplets component_mesh_vertex_triplets(
-        absl::Span< const ComponentMeshVertex > unique_vertices0,
-        absl::Span< const ComponentMeshVertex > unique_vertices1,
-        absl::Span< const ComponentMeshVertex > unique_vertices2 )
+        const ComponentMeshVertices& unique_vertices0,
+        const ComponentMeshVertices& unique_vertices1,
+        const ComponentMeshVertices& unique_vertices2 )
     {
         return ::component_mesh_vertex_generic< 3 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices0, unique_vertices1, unique_vertices2 ),
             []( const ComponentMeshVertex& cmv0,
                 const ComponentMeshVertex& cmv1 ) {
@@ -152,13 +150,13 @@ namespace geode
     }
 
     ComponentMeshVertexTriplets component_mesh_vertex_triplets(
-        absl::Span< const ComponentMeshVertex > unique_vertices0,
-        absl::Span< const ComponentMeshVertex > unique_vertices1,
-        absl::Span< const ComponentMeshVertex > unique_vertices2,
+        const ComponentMeshVertices& unique_vertices0,
+        const ComponentMeshVertices& unique_vertices1,
+        const ComponentMeshVertices& unique_vertices2,
         const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< 3 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices0, unique_vertices1, unique_vertices2 ),
             [type]( const ComponentMeshVertex& cmv0,
                 const ComponentMeshVertex& cmv1 ) {
@@ -168,13 +166,13 @@ namespace geode
     }
 
     ComponentMeshVertexTriplets component_mesh_vertex_triplets(
-        absl::Span< const ComponentMeshVertex > unique_vertices0,
-        absl::Span< const ComponentMeshVertex > unique_vertices1,
-        absl::Span< const ComponentMeshVertex > unique_vertices2,
+        const ComponentMeshVertices& unique_vertices0,
+        const ComponentMeshVertices& unique_vertices1,
+        const ComponentMeshVertices& unique_vertices2,
         const ComponentID& component )
     {
         return ::component_mesh_vertex_generic< 3 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
+            to_array< ComponentMeshVertices >(
                 unique_vertices0, unique_vertices1, unique_vertices2 ),
             [&component]( const ComponentMeshVertex& cmv0,
                 const ComponentMeshVertex& cmv1 ) {
@@ -186,8 +184,7 @@ namespace geode
     template < geode::index_t dimension >
     geode::ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices )
+            absl::Span< const geode::ComponentMeshVertices > unique_vertices )
     {
         return ::component_mesh_vertex_generic< dimension >(
             unique_vertices, []( const ComponentMeshVertex& cmv0,
@@ -199,8 +196,7 @@ namespace geode
     template < geode::index_t dimension >
     geode::ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices,
+            absl::Span< const geode::ComponentMeshVertices > unique_vertices,
             const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< dimension >(
@@ -214,8 +210,7 @@ namespace geode
     template < geode::index_t dimension >
     geode::ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices,
+            absl::Span< const geode::ComponentMeshVertices > unique_vertices,
             const ComponentID& component )
     {
         return ::component_mesh_vertex_generic< dimension >(
@@ -228,37 +223,37 @@ namespace geode
 
     template ComponentMeshVertexGeneric< 2 >
         opengeode_model_api component_mesh_vertex_generic< 2 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > > );
+            absl::Span< const ComponentMeshVertices > );
     template ComponentMeshVertexGeneric< 3 >
         opengeode_model_api component_mesh_vertex_generic< 3 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > > );
+            absl::Span< const ComponentMeshVertices > );
     template ComponentMeshVertexGeneric< 4 >
         opengeode_model_api component_mesh_vertex_generic< 4 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > > );
+            absl::Span< const ComponentMeshVertices > );
 
     template ComponentMeshVertexGeneric< 2 >
         opengeode_model_api component_mesh_vertex_generic< 2 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >,
+            absl::Span< const ComponentMeshVertices >,
             const ComponentType& );
     template ComponentMeshVertexGeneric< 3 >
         opengeode_model_api component_mesh_vertex_generic< 3 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >,
+            absl::Span< const ComponentMeshVertices >,
             const ComponentType& );
     template ComponentMeshVertexGeneric< 4 >
         opengeode_model_api component_mesh_vertex_generic< 4 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >,
+            absl::Span< const ComponentMeshVertices >,
             const ComponentType& );
 
     template ComponentMeshVertexGeneric< 2 >
         opengeode_model_api component_mesh_vertex_generic< 2 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >,
+            absl::Span< const ComponentMeshVertices >,
             const ComponentID& );
     template ComponentMeshVertexGeneric< 3 >
         opengeode_model_api component_mesh_vertex_generic< 3 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >,
+            absl::Span< const ComponentMeshVertices >,
             const ComponentID& );
     template ComponentMeshVertexGeneric< 4 >
         opengeode_model_api component_mesh_vertex_generic< 4 >(
-            absl::Span< const absl::Span< const ComponentMeshVertex > >,
+            absl::Span< const ComponentMeshVertices >,
             const ComponentID& );
 } // namespace geode
\ No newline at end of file
@@ -23,6 +23,12 @@
 
 #include <geode/model/helpers/compute_unique_vertices.hpp>
 
+#include <thread>
+
+#include <async++.h>
+
+#include <absl/container/flat_hash_map.h>
+
 #include <geode/geometry/nn_search.hpp>
 
 #include <geode/mesh/core/edged_curve.hpp>
@@ -41,204 +47,195 @@
 
 namespace
 {
-    template < typename Model >
-    std::vector< geode::Point< Model::dim > > get_all_points_base(
-        const Model& model )
+    /*!
+     * Vertices of a model component, numbered from offset in the list of
+     * all the model points.
+     */
+    template < geode::index_t dimension >
+    struct ComponentVertices
     {
-        std::vector< geode::Point< Model::dim > > points;
-        for( const auto& corner : model.corners() )
-        {
-            for( const auto v : geode::Range{ corner.mesh().nb_vertices() } )
-            {
-                points.emplace_back( corner.mesh().point( v ) );
-            }
-        }
-        for( const auto& line : model.lines() )
-        {
-            for( const auto v : geode::Range{ line.mesh().nb_vertices() } )
-            {
-                points.emplace_back( line.mesh().point( v ) );
-            }
-        }
-        for( const auto& surface : model.surfaces() )
+        geode::ComponentID id;
+        const geode::CoordinateReferenceSystemManagers< dimension >* mesh;
+        geode::index_t nb_vertices;
+        geode::index_t offset;
+    };
+
+    template < typename Model, typename Components >
+    void add_components(
+        std::vector< ComponentVertices< Model::dim > >& components,
+        const Components& model_components )
+    {
+        for( const auto& component : model_components )
         {
-            for( const auto v : geode::Range{ surface.mesh().nb_vertices() } )
-            {
-                points.emplace_back( surface.mesh().point( v ) );
-            }
+            const auto& mesh = component.mesh();
+            components.push_back( { component.component_id(), &mesh,
+                mesh.nb_vertices(), geode::NO_ID } );
         }
-        return points;
     }
 
-    std::vector< geode::Point2D > get_all_points( const geode::Section& model )
+    template < typename Model >
+    std::vector< ComponentVertices< Model::dim > > get_components_base(
+        const Model& model )
     {
-        return get_all_points_base< geode::Section >( model );
+        std::vector< ComponentVertices< Model::dim > > components;
+        add_components< Model >( components, model.corners() );
+        add_components< Model >( components, model.lines() );
+        add_components< Model >( components, model.surfaces() );
+        return components;
     }
 
-    std::vector< geode::Point3D > get_all_points( const geode::BRep& model )
+    std::vector< ComponentVertices< 2 > > get_components(
+        const geode::Section& model )
     {
-        auto points = get_all_points_base< geode::BRep >( model );
-        for( const auto& block : model.blocks() )
-        {
-            for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
-            {
-                points.emplace_back( block.mesh().point( v ) );
-            }
-        }
-        return points;
+        return get_components_base< geode::Section >( model );
     }
 
-    template < typename Model >
-    const geode::Point< Model::dim >& get_point_base(
-        const Model& model, const geode::ComponentMeshVertex& cmv )
+    std::vector< ComponentVertices< 3 > > get_components(
+        const geode::BRep& model )
     {
-        if( cmv.component_id.type
-            == geode::Surface< Model::dim >::component_type_static() )
-        {
-            const auto& surface = model.surface( cmv.component_id.id );
-            return surface.mesh().point( cmv.vertex );
-        }
-        if( cmv.component_id.type
-            == geode::Line< Model::dim >::component_type_static() )
-        {
-            const auto& line = model.line( cmv.component_id.id );
-            return line.mesh().point( cmv.vertex );
-        }
-        if( cmv.component_id.type
-            == geode::Corner< Model::dim >::component_type_static() )
-        {
-            const auto& corner = model.corner( cmv.component_id.id );
-            return corner.mesh().point( cmv.vertex );
-        }
-        throw geode::OpenGeodeModelException{ nullptr,
-            geode::OpenGeodeException::TYPE::data,
-            "[compute_unique_vertices::get_point] Unknown component type: ",
-            cmv.component_id.string() };
-        const auto& corner = model.corner( cmv.component_id.id );
-        return corner.mesh().point( cmv.vertex );
+        auto components = get_components_base< geode::BRep >( model );
+        add_components< geode::BRep >( components, model.blocks() );
+        return components;
     }
 
-    const geode::Point2D& get_point(
-        const geode::Section& model, const geode::ComponentMeshVertex& cmv )
+    template < geode::index_t dimension >
+    std::vector< geode::Point< dimension > > get_all_points(
+        absl::Span< const ComponentVertices< dimension > > components )
     {
-        return get_point_base< geode::Section >( model, cmv );
+        const auto nb_points =
+            components.empty() ? 0
+                               : components.back().offset
+                                     + components.back().nb_vertices;
+        std::vector< geode::Point< dimension > > points( nb_points );
+        async::parallel_for( async::irange( size_t{ 0 }, components.size() ),
+            [&components, &points]( size_t c ) {
+                const auto& component = components[c];
+                async::parallel_for(
+                    async::irange( geode::index_t{ 0 }, component.nb_vertices ),
+                    [&component, &points]( geode::index_t v ) {
+                        points[component.offset + v] =
+                            component.mesh->point( v );
+                    } );
+            } );
+        return points;
     }
 
-    const geode::Point3D& get_point(
-        const geode::BRep& model, const geode::ComponentMeshVertex& cmv )
+    /*!
+     * For each point, return the smallest index of the points having
+     * exactly the same coordinates.
+     * Points are dispatched in hash buckets processed in parallel.
+     */
+    template < geode::index_t dimension >
+    std::vector< geode::index_t > exact_colocated_points(
+        absl::Span< const geode::Point< dimension > > points )
     {
-        if( cmv.component_id.type
-            == geode::Block< 3 >::component_type_static() )
+        const auto nb_buckets = static_cast< geode::index_t >(
+            8 * std::max( std::thread::hardware_concurrency(), 1u ) );
+        std::vector< geode::index_t > point_buckets( points.size() );
+        async::parallel_for(
+            async::irange( size_t{ 0 }, points.size() ),
+            [&points, &point_buckets, nb_buckets]( size_t p ) {
+                point_buckets[p] =
+                    absl::Hash< geode::Point< dimension > >{}( points[p] )
+                    % nb_buckets;
+            } );
+        std::vector< geode::index_t > bucket_offsets( nb_buckets + 1, 0 );
+        for( const auto bucket : point_buckets )
         {
-            const auto& block = model.block( cmv.component_id.id );
-            return block.mesh().point( cmv.vertex );
+            bucket_offsets[bucket + 1]++;
         }
-        return get_point_base< geode::BRep >( model, cmv );
-    }
-
-    template < typename Model >
-    void set_unique_vertices_base( const Model& model,
-        typename Model::Builder& builder,
-        absl::Span< const geode::index_t > initial_uv_correspondance,
-        const geode::NNSearch< Model::dim >& unique_nns )
-    {
-        for( const auto& corner : model.corners() )
+        for( const auto b : geode::Range{ nb_buckets } )
         {
-            for( const auto v : geode::Range{ corner.mesh().nb_vertices() } )
-            {
-                geode::ComponentMeshVertex cmv{ corner.component_id(), v };
-                if( model.unique_vertex( { corner.component_id(), v } )
-                    != geode::NO_ID )
-                {
-                    continue;
-                }
-                const auto& point = corner.mesh().point( v );
-                const auto unique_vertex_id =
-                    unique_nns.closest_neighbor( point );
-                builder.set_unique_vertex(
-                    cmv, initial_uv_correspondance[unique_vertex_id] );
-            }
+            bucket_offsets[b + 1] += bucket_offsets[b];
         }
-        for( const auto& line : model.lines() )
+        std::vector< geode::index_t > bucket_points( points.size() );
+        auto positions = bucket_offsets;
+        for( const auto p : geode::Indices{ point_buckets } )
         {
-            for( const auto v : geode::Range{ line.mesh().nb_vertices() } )
-            {
-                geode::ComponentMeshVertex cmv{ line.component_id(), v };
-                if( model.unique_vertex( cmv ) != geode::NO_ID )
-                {
-                    continue;
-                }
-                const auto& point = line.mesh().point( v );
-                const auto unique_vertex_id =
-                    unique_nns.closest_neighbor( point );
-                builder.set_unique_vertex(
-                    cmv, initial_uv_correspondance[unique_vertex_id] );
-            }
+            bucket_points[positions[point_buckets[p]]++] = p;
         }
-        for( const auto& surface : model.surfaces() )
-        {
-            for( const auto v : geode::Range{ surface.mesh().nb_vertices() } )
-            {
-                geode::ComponentMeshVertex cmv{ surface.component_id(), v };
-                if( model.unique_vertex( cmv ) != geode::NO_ID )
+        std::vector< geode::index_t > colocated( points.size() );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_buckets ),
+            [&points, &bucket_offsets, &bucket_points, &colocated](
+                geode::index_t b ) {
+                absl::flat_hash_map< geode::Point< dimension >, geode::index_t >
+                    first_points;
+                first_points.reserve(
+                    bucket_offsets[b + 1] - bucket_offsets[b] );
+                for( const auto i :
+                    geode::Range{ bucket_offsets[b], bucket_offsets[b + 1] } )
                 {
-                    continue;
+                    const auto p = bucket_points[i];
+                    colocated[p] =
+                        first_points.try_emplace( points[p], p ).first->second;
                 }
-                const auto& point = surface.mesh().point( v );
-                const auto unique_vertex_id =
-                    unique_nns.closest_neighbor( point );
-                builder.set_unique_vertex(
-                    cmv, initial_uv_correspondance[unique_vertex_id] );
-            }
-        }
+            } );
+        return colocated;
     }
 
-    void set_unique_vertices( const geode::Section& model,
-        geode::SectionBuilder& builder,
-        absl::Span< const geode::index_t > initial_uv_correspondance,
-        const geode::NNSearch2D& unique_nns )
+    /*!
+     * Return the unique point index of each point.
+     * Exact duplicates are merged first by hashing, then the remaining
+     * distinct points are merged within GLOBAL_EPSILON.
+     * This is equivalent to calling NNSearch::colocated_index_mapping on all
+     * the points.
+     */
+    template < geode::index_t dimension >
+    std::pair< std::vector< geode::index_t >, geode::index_t >
+        compute_colocated_mapping(
+            absl::Span< const geode::Point< dimension > > points )
     {
-        set_unique_vertices_base(
-            model, builder, initial_uv_correspondance, unique_nns );
-    }
-
-    void set_unique_vertices( const geode::BRep& model,
-        geode::BRepBuilder& builder,
-        absl::Span< const geode::index_t > initial_uv_correspondance,
-        const geode::NNSearch3D& unique_nns )
-    {
-        set_unique_vertices_base(
-            model, builder, initial_uv_correspondance, unique_nns );
-        for( const auto& block : model.blocks() )
+        const auto exact_colocated = exact_colocated_points( points );
+        std::vector< geode::index_t > distinct_ids(
+            points.size(), geode::NO_ID );
+        std::vector< geode::Point< dimension > > distinct_points;
+        for( const auto p : geode::Indices{ points } )
         {
-            for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+            if( exact_colocated[p] == p )
             {
-                geode::ComponentMeshVertex cmv{ block.component_id(), v };
-                if( model.unique_vertex( cmv ) != geode::NO_ID )
-                {
-                    continue;
-                }
-                const auto& point = block.mesh().point( v );
-                const auto unique_vertex_id =
-                    unique_nns.closest_neighbor( point );
-                builder.set_unique_vertex(
-                    cmv, initial_uv_correspondance[unique_vertex_id] );
+                distinct_ids[p] = distinct_points.size();
+                distinct_points.push_back( points[p] );
             }
         }
+        const geode::NNSearch< dimension > nns{ std::move( distinct_points ) };
+        const auto colocated_info =
+            nns.colocated_index_mapping( geode::GLOBAL_EPSILON );
+        std::vector< geode::index_t > mapping( points.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, points.size() ),
+            [&mapping, &colocated_info, &distinct_ids, &exact_colocated](
+                size_t p ) {
+                mapping[p] = colocated_info.colocated_mapping
+                                 [distinct_ids[exact_colocated[p]]];
+            } );
+        return { std::move( mapping ), colocated_info.nb_unique_points() };
     }
 
     template < typename Model >
     std::vector< geode::index_t > compute_initial_uv_correspondance(
-        const Model& model, const geode::NNSearch< Model::dim >& unique_nns )
+        const Model& model,
+        absl::Span< const ComponentVertices< Model::dim > > components,
+        absl::Span< const geode::index_t > colocated_mapping,
+        geode::index_t nb_unique_points )
     {
+        absl::flat_hash_map< geode::uuid, geode::index_t > offsets;
+        offsets.reserve( components.size() );
+        for( const auto& component : components )
+        {
+            offsets.emplace( component.id.id, component.offset );
+        }
         std::vector< geode::index_t > initial_uv_correspondance(
-            unique_nns.nb_points(), geode::NO_ID );
+            nb_unique_points, geode::NO_ID );
         for( const auto uv : geode::Range{ model.nb_unique_vertices() } )
         {
-            const auto& cmv = model.component_mesh_vertices( uv ).front();
-            const auto& point = get_point( model, cmv );
-            initial_uv_correspondance[unique_nns.closest_neighbor( point )] =
-                uv;
+            const auto cmvs = model.component_mesh_vertices( uv );
+            if( cmvs.empty() )
+            {
+                continue;
+            }
+            const auto& cmv = cmvs.front();
+            const auto point =
+                offsets.at( cmv.component_id.id ) + cmv.vertex;
+            initial_uv_correspondance[colocated_mapping[point]] = uv;
         }
         geode::index_t new_uv = model.nb_unique_vertices();
         for( auto& uv : initial_uv_correspondance )
@@ -251,6 +248,41 @@ namespace
         return initial_uv_correspondance;
     }
 
+    template < typename Model >
+    void set_unique_vertices( const Model& model,
+        typename Model::Builder& builder,
+        absl::Span< const ComponentVertices< Model::dim > > components,
+        absl::Span< const geode::index_t > colocated_mapping,
+        absl::Span< const geode::index_t > initial_uv_correspondance )
+    {
+        std::vector< std::vector< geode::ComponentMeshVertex > >
+            component_vertices( components.size() );
+        std::vector< std::vector< geode::index_t > > unique_vertices(
+            components.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, components.size() ),
+            [&model, &components, &colocated_mapping,
+                &initial_uv_correspondance, &component_vertices,
+                &unique_vertices]( size_t c ) {
+                const auto& component = components[c];
+                for( const auto v : geode::Range{ component.nb_vertices } )
+                {
+                    geode::ComponentMeshVertex cmv{ component.id, v };
+                    if( model.unique_vertex( cmv ) != geode::NO_ID )
+                    {
+                        continue;
+                    }
+                    component_vertices[c].emplace_back( std::move( cmv ) );
+                    unique_vertices[c].push_back(
+                        initial_uv_correspondance
+                            [colocated_mapping[component.offset + v]] );
+                }
+            } );
+        for( const auto c : geode::Indices{ components } )
+        {
+            builder.set_unique_vertices(
+                component_vertices[c], unique_vertices[c] );
+        }
+    }
 } // namespace
 
 namespace geode
@@ -259,18 +291,24 @@ namespace geode
     void compute_model_unique_vertices(
         const Model& model, typename Model::Builder& builder )
     {
-        auto all_vertices = get_all_points( model );
-        NNSearch< Model::dim > nns{ all_vertices };
-        const auto colocated_info =
-            nns.colocated_index_mapping( GLOBAL_EPSILON );
+        auto components = get_components( model );
+        index_t nb_points{ 0 };
+        for( auto& component : components )
+        {
+            component.offset = nb_points;
+            nb_points += component.nb_vertices;
+        }
+        const auto all_points = get_all_points< Model::dim >( components );
+        const auto [colocated_mapping, nb_unique_points] =
+            compute_colocated_mapping< Model::dim >( all_points );
         const auto nb_initial_unique_vertices = model.nb_unique_vertices();
-        NNSearch< Model::dim > unique_nns{ colocated_info.unique_points };
         const auto initial_uv_correspondance =
-            compute_initial_uv_correspondance( model, unique_nns );
+            compute_initial_uv_correspondance< Model >(
+                model, components, colocated_mapping, nb_unique_points );
         builder.create_unique_vertices(
-            colocated_info.nb_unique_points() - nb_initial_unique_vertices );
-        set_unique_vertices(
-            model, builder, initial_uv_correspondance, unique_nns );
+            nb_unique_points - nb_initial_unique_vertices );
+        set_unique_vertices< Model >( model, builder, components,
+            colocated_mapping, initial_uv_correspondance );
     }
 
     template void opengeode_model_api compute_model_unique_vertices(
@@ -190,9 +190,9 @@ namespace geode
                     PolygonsAroundVertex total_polygons;
                     while( nb_polygons_around != polygon_vertices.size() )
                     {
-                        for( auto& polygon : polygons_around )
+                        for( const auto& polygon : polygons_around )
                         {
-                            total_polygons.emplace_back( std::move( polygon ) );
+                            total_polygons.emplace_back( polygon );
                         }
                         mapping.emplace_back(
                             process_component( surface, mesh, builder,
@@ -23,6 +23,8 @@
 
 #include <geode/model/helpers/ray_tracing.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/geometry/aabb.hpp>
@@ -128,6 +130,167 @@ namespace
         }
         return result;
     }
+
+    /*!
+     * Adaptive 2^dimension-tree subdividing the cells crossed by a model
+     * boundary. Leaves not crossed by any boundary lie in a single region
+     * and are tagged with it, the other leaves are left undetermined.
+     */
+    template < geode::index_t dimension >
+    class PointLocationTree
+    {
+        static constexpr geode::index_t NB_CHILDREN{ 1u << dimension };
+        struct Node
+        {
+            geode::BoundingBox< dimension > box;
+            geode::index_t first_child{ geode::NO_ID };
+            geode::index_t region{ geode::NO_ID };
+        };
+
+    public:
+        template < typename IsCrossed, typename LocateRegion >
+        PointLocationTree( geode::BoundingBox< dimension > box,
+            geode::index_t max_depth,
+            const IsCrossed& is_crossed,
+            const LocateRegion& locate_region )
+        {
+            nodes_.push_back( { std::move( box ) } );
+            std::vector< geode::index_t > leaves;
+            std::vector< geode::index_t > level{ 0 };
+            for( const auto depth : geode::Range{ max_depth + 1 } )
+            {
+                std::vector< char > crossed( level.size() );
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, level.size() ),
+                    [this, &level, &crossed, &is_crossed]( size_t n ) {
+                        crossed[n] = is_crossed( nodes_[level[n]].box );
+                    } );
+                std::vector< geode::index_t > next_level;
+                for( const auto n : geode::Indices{ level } )
+                {
+                    if( !crossed[n] )
+                    {
+                        leaves.push_back( level[n] );
+                    }
+                    else if( depth < max_depth )
+                    {
+                        subdivide( level[n], next_level );
+                    }
+                }
+                level = std::move( next_level );
+            }
+            std::vector< std::optional< geode::uuid > > leaf_regions(
+                leaves.size() );
+            async::parallel_for( async::irange( size_t{ 0 }, leaves.size() ),
+                [this, &leaves, &leaf_regions, &locate_region]( size_t l ) {
+                    leaf_regions[l] =
+                        locate_region( nodes_[leaves[l]].box.center() );
+                } );
+            absl::flat_hash_map< geode::uuid, geode::index_t > region_ids;
+            regions_.emplace_back( std::nullopt );
+            for( const auto l : geode::Indices{ leaves } )
+            {
+                auto& node = nodes_[leaves[l]];
+                if( !leaf_regions[l] )
+                {
+                    node.region = 0;
+                    continue;
+                }
+                const auto output = region_ids.emplace(
+                    leaf_regions[l].value(), regions_.size() );
+                if( output.second )
+                {
+                    regions_.emplace_back( leaf_regions[l] );
+                }
+                node.region = output.first->second;
+            }
+        }
+
+        /*!
+         * Return the region of the leaf containing the point, or NO_ID if
+         * this leaf is crossed by a boundary.
+         */
+        [[nodiscard]] geode::index_t region(
+            const geode::Point< dimension >& point ) const
+        {
+            if( !nodes_.front().box.contains( point ) )
+            {
+                return 0;
+            }
+            geode::index_t node_id{ 0 };
+            while( nodes_[node_id].first_child != geode::NO_ID )
+            {
+                const auto center = nodes_[node_id].box.center();
+                geode::index_t child{ 0 };
+                for( const auto d : geode::LRange{ dimension } )
+                {
+                    if( point.value( d ) >= center.value( d ) )
+                    {
+                        child |= 1u << d;
+                    }
+                }
+                node_id = nodes_[node_id].first_child + child;
+            }
+            return nodes_[node_id].region;
+        }
+
+        [[nodiscard]] const std::optional< geode::uuid >& region_id(
+            geode::index_t region ) const
+        {
+            return regions_[region];
+        }
+
+    private:
+        void subdivide(
+            geode::index_t node_id, std::vector< geode::index_t >& children )
+        {
+            const auto first_child = nodes_.size();
+            nodes_[node_id].first_child = first_child;
+            const auto box = nodes_[node_id].box;
+            const auto center = box.center();
+            for( const auto child : geode::Range{ NB_CHILDREN } )
+            {
+                auto min = box.min();
+                auto max = center;
+                for( const auto d : geode::LRange{ dimension } )
+                {
+                    if( ( child >> d ) & 1u )
+                    {
+                        min.set_value( d, center.value( d ) );
+                        max.set_value( d, box.max().value( d ) );
+                    }
+                }
+                nodes_.push_back(
+                    { geode::BoundingBox< dimension >{ min, max } } );
+                children.push_back( first_child + child );
+            }
+        }
+
+    private:
+        std::vector< Node > nodes_;
+        std::vector< std::optional< geode::uuid > > regions_;
+    };
+
+    template < geode::index_t dimension >
+    bool is_box_crossed( const geode::BoundingBox< dimension >& box,
+        absl::Span< const geode::AABBTree< dimension >* const > boundaries )
+    {
+        for( const auto* aabb : boundaries )
+        {
+            bool crossed{ false };
+            auto eval_intersection = [&crossed]( geode::index_t /*unused*/ ) {
+                crossed = true;
+                return true;
+            };
+            aabb->compute_bbox_element_bbox_intersections(
+                box, eval_intersection );
+            if( crossed )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
 } // namespace
 
 namespace geode
@@ -177,6 +340,33 @@ namespace geode
         }
 
         std::optional< uuid > surface_containing_point( const Point2D& point )
+        {
+            if( tree_ )
+            {
+                const auto region = tree_->region( point );
+                if( region != NO_ID )
+                {
+                    return tree_->region_id( region );
+                }
+            }
+            return cast_surface_containing_point( point );
+        }
+
+        std::vector< std::optional< uuid > > surfaces_containing_points(
+            absl::Span< const Point2D > points )
+        {
+            build_point_location_tree();
+            std::vector< std::optional< uuid > > result( points.size() );
+            async::parallel_for( async::irange( size_t{ 0 }, points.size() ),
+                [this, &points, &result]( size_t p ) {
+                    result[p] = surface_containing_point( points[p] );
+                } );
+            return result;
+        }
+
+    private:
+        std::optional< uuid > cast_surface_containing_point(
+            const Point2D& point )
         {
             for( const auto& surface : section_.surfaces() )
             {
@@ -188,7 +378,39 @@ namespace geode
             return std::nullopt;
         }
 
-    private:
+        void build_point_location_tree()
+        {
+            if( tree_ )
+            {
+                return;
+            }
+            for( const auto& line : section_.lines() )
+            {
+                line_aabb( line );
+            }
+            std::vector< const AABBTree2D* > boundaries;
+            BoundingBox2D box;
+            for( const auto& line : section_.lines() )
+            {
+                if( line.mesh().nb_edges() == 0 )
+                {
+                    continue;
+                }
+                const auto& aabb = aabb_trees_.at( line.id() );
+                boundaries.push_back( &aabb );
+                box.add_box( aabb.bounding_box() );
+            }
+            box.extends( GLOBAL_EPSILON );
+            tree_.emplace(
+                std::move( box ), MAX_DEPTH_2D,
+                [&boundaries]( const BoundingBox2D& cell ) {
+                    return is_box_crossed< 2 >( cell, boundaries );
+                },
+                [this]( const Point2D& center ) {
+                    return cast_surface_containing_point( center );
+                } );
+        }
+
         const AABBTree2D& line_aabb( const Line2D& line )
         {
             if( aabb_trees_.contains( line.id() ) )
@@ -201,8 +423,10 @@ namespace geode
         }
 
     private:
+        static constexpr index_t MAX_DEPTH_2D{ 12 };
         const Section& section_;
         absl::flat_hash_map< uuid, AABBTree2D > aabb_trees_;
+        std::optional< PointLocationTree< 2 > > tree_;
     };
 
     SectionRayTracing::SectionRayTracing( const Section& section )
@@ -224,6 +448,13 @@ namespace geode
         return impl_->surface_containing_point( point );
     }
 
+    std::vector< std::optional< uuid > >
+        SectionRayTracing::surfaces_containing_points(
+            absl::Span< const Point2D > points )
+    {
+        return impl_->surfaces_containing_points( points );
+    }
+
     class BRepRayTracing::Impl
     {
     public:
@@ -285,6 +516,33 @@ namespace geode
         }
 
         std::optional< uuid > block_containing_point( const Point3D& point )
+        {
+            if( tree_ )
+            {
+                const auto region = tree_->region( point );
+                if( region != NO_ID )
+                {
+                    return tree_->region_id( region );
+                }
+            }
+            return cast_block_containing_point( point );
+        }
+
+        std::vector< std::optional< uuid > > blocks_containing_points(
+            absl::Span< const Point3D > points )
+        {
+            build_point_location_tree();
+            std::vector< std::optional< uuid > > result( points.size() );
+            async::parallel_for( async::irange( size_t{ 0 }, points.size() ),
+                [this, &points, &result]( size_t p ) {
+                    result[p] = block_containing_point( points[p] );
+                } );
+            return result;
+        }
+
+    private:
+        std::optional< uuid > cast_block_containing_point(
+            const Point3D& point )
         {
             for( const auto& block : brep_.blocks() )
             {
@@ -296,7 +554,39 @@ namespace geode
             return std::nullopt;
         }
 
-    private:
+        void build_point_location_tree()
+        {
+            if( tree_ )
+            {
+                return;
+            }
+            for( const auto& surface : brep_.surfaces() )
+            {
+                surface_aabb( surface );
+            }
+            std::vector< const AABBTree3D* > boundaries;
+            BoundingBox3D box;
+            for( const auto& surface : brep_.surfaces() )
+            {
+                if( surface.mesh().nb_polygons() == 0 )
+                {
+                    continue;
+                }
+                const auto& aabb = aabb_trees_.at( surface.id() );
+                boundaries.push_back( &aabb );
+                box.add_box( aabb.bounding_box() );
+            }
+            box.extends( GLOBAL_EPSILON );
+            tree_.emplace(
+                std::move( box ), MAX_DEPTH_3D,
+                [&boundaries]( const BoundingBox3D& cell ) {
+                    return is_box_crossed< 3 >( cell, boundaries );
+                },
+                [this]( const Point3D& center ) {
+                    return cast_block_containing_point( center );
+                } );
+        }
+
         const AABBTree3D& surface_aabb( const Surface3D& surface )
         {
             if( aabb_trees_.contains( surface.id() ) )
@@ -309,8 +599,10 @@ namespace geode
         }
 
     private:
+        static constexpr index_t MAX_DEPTH_3D{ 7 };
         const BRep& brep_;
         absl::flat_hash_map< uuid, AABBTree3D > aabb_trees_;
+        std::optional< PointLocationTree< 3 > > tree_;
     };
 
     BRepRayTracing::BRepRayTracing( const BRep& brep ) : impl_{ brep } {}
@@ -337,6 +629,13 @@ namespace geode
         return impl_->block_containing_point( point );
     }
 
+    std::vector< std::optional< uuid > >
+        BRepRayTracing::blocks_containing_points(
+            absl::Span< const Point3D > points )
+    {
+        return impl_->blocks_containing_points( points );
+    }
+
     RayTracingResult is_point_inside_closed_surface( const Point3D& point,
         const SurfaceMesh3D& surface,
         const AABBTree3D& surface_aabb )
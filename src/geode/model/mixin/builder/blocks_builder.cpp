@@ -75,6 +75,14 @@ namespace geode
             directory, typename Blocks< dimension >::BlocksBuilderKey{} );
     }
 
+    template < index_t dimension >
+    void BlocksBuilder< dimension >::load_blocks(
+        std::shared_ptr< const UnzipFile > archive )
+    {
+        return blocks_.load_blocks( std::move( archive ),
+            typename Blocks< dimension >::BlocksBuilderKey{} );
+    }
+
     template < index_t dimension >
     void BlocksBuilder< dimension >::set_block_name(
         const Block< dimension >& block, std::string_view name )
@@ -76,6 +76,14 @@ namespace geode
             directory, typename Corners< dimension >::CornersBuilderKey{} );
     }
 
+    template < index_t dimension >
+    void CornersBuilder< dimension >::load_corners(
+        std::shared_ptr< const UnzipFile > archive )
+    {
+        return corners_.load_corners( std::move( archive ),
+            typename Corners< dimension >::CornersBuilderKey{} );
+    }
+
     template < index_t dimension >
     std::unique_ptr< PointSetBuilder< dimension > >
         CornersBuilder< dimension >::corner_mesh_builder(
@@ -74,6 +74,14 @@ namespace geode
             directory, typename Lines< dimension >::LinesBuilderKey{} );
     }
 
+    template < index_t dimension >
+    void LinesBuilder< dimension >::load_lines(
+        std::shared_ptr< const UnzipFile > archive )
+    {
+        return lines_.load_lines( std::move( archive ),
+            typename Lines< dimension >::LinesBuilderKey{} );
+    }
+
     template < index_t dimension >
     std::unique_ptr< EdgedCurveBuilder< dimension > >
         LinesBuilder< dimension >::line_mesh_builder(
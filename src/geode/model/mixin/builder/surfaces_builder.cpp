@@ -77,6 +77,14 @@ namespace geode
             directory, typename Surface< dimension >::SurfacesBuilderKey{} );
     }
 
+    template < index_t dimension >
+    void SurfacesBuilder< dimension >::load_surfaces(
+        std::shared_ptr< const UnzipFile > archive )
+    {
+        return surfaces_.load_surfaces( std::move( archive ),
+            typename Surfaces< dimension >::SurfacesBuilderKey{} );
+    }
+
     template < index_t dimension >
     void SurfacesBuilder< dimension >::set_surface_name(
         const Surface< dimension >& surface, std::string_view name )
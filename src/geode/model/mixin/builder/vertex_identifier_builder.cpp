@@ -50,6 +50,14 @@ namespace geode
             unique_vertex_id, VertexIdentifier::BuilderKey{} );
     }
 
+    void VertexIdentifierBuilder::set_unique_vertices(
+        absl::Span< const ComponentMeshVertex > component_vertices,
+        absl::Span< const index_t > unique_vertex_ids )
+    {
+        vertex_identifier_.set_unique_vertices( component_vertices,
+            unique_vertex_ids, VertexIdentifier::BuilderKey{} );
+    }
+
     void VertexIdentifierBuilder::unset_unique_vertex(
         const ComponentMeshVertex& component_vertex_id,
         index_t unique_vertex_id )
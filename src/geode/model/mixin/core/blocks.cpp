@@ -29,6 +29,7 @@
 #include <geode/basic/identifier_builder.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/range.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/mesh/core/hybrid_solid.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
@@ -44,6 +45,26 @@
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/detail/components_storage.hpp>
 
+namespace
+{
+    template < geode::index_t dimension >
+    std::unique_ptr< geode::SolidMesh< dimension > > load_block_mesh(
+        const geode::MeshImpl& mesh_type, std::string_view file )
+    {
+        const auto& type = geode::MeshFactory::type( mesh_type );
+        if( type == geode::TetrahedralSolid< dimension >::type_name_static() )
+        {
+            return geode::load_tetrahedral_solid< dimension >(
+                mesh_type, file );
+        }
+        if( type == geode::HybridSolid< dimension >::type_name_static() )
+        {
+            return geode::load_hybrid_solid< dimension >( mesh_type, file );
+        }
+        return geode::load_polyhedral_solid< dimension >( mesh_type, file );
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -98,15 +119,34 @@ namespace geode
 
     template < index_t dimension >
     void Blocks< dimension >::save_blocks( std::string_view directory ) const
+    {
+        save_blocks(
+            directory,
+            []( const Block< dimension >& /*unused*/ ) {
+                return true;
+            },
+            "" );
+    }
+
+    template < index_t dimension >
+    void Blocks< dimension >::save_blocks( std::string_view directory,
+        const std::function< bool( const Block< dimension >& ) >& mesh_filter,
+        std::string_view archive_id ) const
     {
         impl_->save_components( absl::StrCat( directory, "/blocks" ) );
         const auto prefix = absl::StrCat(
             directory, "/", Block< dimension >::component_type_static().get() );
-        absl::FixedArray< async::task< void > > tasks( nb_blocks() );
-        index_t count{ 0 };
+        std::vector< async::task< void > > tasks;
+        tasks.reserve( nb_blocks() );
         for( const auto& block : blocks() )
         {
-            tasks[count++] = async::spawn( [&block, &prefix] {
+            if( !mesh_filter( block ) )
+            {
+                block.set_mesh_saved(
+                    archive_id, typename Block< dimension >::BlocksKey{} );
+                continue;
+            }
+            tasks.emplace_back( async::spawn( [&block, &prefix, &archive_id] {
                 const auto& mesh = block.mesh();
                 const auto file = absl::StrCat(
                     prefix, block.id().string(), ".", mesh.native_extension() );
@@ -135,7 +175,9 @@ namespace geode
                         "[Blocks::save_blocks] Cannot find the explicit "
                         "SolidMesh type" };
                 }
-            } );
+                block.set_mesh_saved(
+                    archive_id, typename Block< dimension >::BlocksKey{} );
+            } ) );
         }
         for( auto& task : async::when_all( tasks ).get() )
         {
@@ -155,26 +197,9 @@ namespace geode
         {
             tasks[count++] = async::spawn( [&block, &mapping] {
                 const auto file = mapping.at( block.id().string() );
-                if( MeshFactory::type( block.mesh_type() )
-                    == TetrahedralSolid< dimension >::type_name_static() )
-                {
-                    block.set_mesh( load_tetrahedral_solid< dimension >(
-                                        block.mesh_type(), file ),
-                        typename Block< dimension >::BlocksKey{} );
-                }
-                else if( MeshFactory::type( block.mesh_type() )
-                         == HybridSolid< dimension >::type_name_static() )
-                {
-                    block.set_mesh( load_hybrid_solid< dimension >(
-                                        block.mesh_type(), file ),
-                        typename Block< dimension >::BlocksKey{} );
-                }
-                else
-                {
-                    block.set_mesh( load_polyhedral_solid< dimension >(
-                                        block.mesh_type(), file ),
-                        typename Block< dimension >::BlocksKey{} );
-                }
+                block.set_mesh(
+                    load_block_mesh< dimension >( block.mesh_type(), file ),
+                    typename Block< dimension >::BlocksKey{} );
             } );
         }
         for( auto& task : async::when_all( tasks ).get() )
@@ -183,6 +208,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Blocks< dimension >::load_blocks(
+        std::shared_ptr< const UnzipFile > archive, BlocksBuilderKey key )
+    {
+        impl_->load_components(
+            absl::StrCat( archive->directory(), "/blocks" ) );
+        const auto mapping = impl_->file_mapping( *archive );
+        const auto archive_id = detail::model_archive_id( *archive );
+        for( auto& block : modifiable_blocks( key ) )
+        {
+            block.set_mesh_loader(
+                [archive, file = mapping.at( block.id().string() ),
+                    type = block.mesh_type()] {
+                    return detail::load_mesh_from_archive(
+                        *archive, file, [&type]( std::string_view path ) {
+                            return load_block_mesh< dimension >( type, path );
+                        } );
+                },
+                typename Block< dimension >::BlocksKey{} );
+            block.set_mesh_saved(
+                archive_id, typename Block< dimension >::BlocksKey{} );
+        }
+    }
+
     template < index_t dimension >
     const uuid& Blocks< dimension >::create_block( BlocksBuilderKey /*unused*/ )
     {
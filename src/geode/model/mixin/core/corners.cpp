@@ -29,6 +29,7 @@
 #include <geode/basic/identifier_builder.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/range.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/mesh/core/point_set.hpp>
 #include <geode/mesh/io/point_set_input.hpp>
@@ -92,20 +93,41 @@ namespace geode
 
     template < index_t dimension >
     void Corners< dimension >::save_corners( std::string_view directory ) const
+    {
+        save_corners(
+            directory,
+            []( const Corner< dimension >& /*unused*/ ) {
+                return true;
+            },
+            "" );
+    }
+
+    template < index_t dimension >
+    void Corners< dimension >::save_corners( std::string_view directory,
+        const std::function< bool( const Corner< dimension >& ) >& mesh_filter,
+        std::string_view archive_id ) const
     {
         impl_->save_components( absl::StrCat( directory, "/corners" ) );
         const auto prefix = absl::StrCat( directory, "/",
             Corner< dimension >::component_type_static().get() );
-        absl::FixedArray< async::task< void > > tasks( nb_corners() );
-        index_t count{ 0 };
+        std::vector< async::task< void > > tasks;
+        tasks.reserve( nb_corners() );
         for( const auto& corner : corners() )
         {
-            tasks[count++] = async::spawn( [&corner, &prefix] {
+            if( !mesh_filter( corner ) )
+            {
+                corner.set_mesh_saved(
+                    archive_id, typename Corner< dimension >::CornersKey{} );
+                continue;
+            }
+            tasks.emplace_back( async::spawn( [&corner, &prefix, &archive_id] {
                 const auto& mesh = corner.mesh();
                 const auto file = absl::StrCat( prefix, corner.id().string(),
                     ".", mesh.native_extension() );
                 save_point_set( mesh, file );
-            } );
+                corner.set_mesh_saved(
+                    archive_id, typename Corner< dimension >::CornersKey{} );
+            } ) );
         }
         for( auto& task : async::when_all( tasks ).get() )
         {
@@ -136,6 +158,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Corners< dimension >::load_corners(
+        std::shared_ptr< const UnzipFile > archive, CornersBuilderKey key )
+    {
+        impl_->load_components(
+            absl::StrCat( archive->directory(), "/corners" ) );
+        const auto mapping = impl_->file_mapping( *archive );
+        const auto archive_id = detail::model_archive_id( *archive );
+        for( auto& corner : modifiable_corners( key ) )
+        {
+            corner.set_mesh_loader(
+                [archive, file = mapping.at( corner.id().string() ),
+                    type = corner.mesh_type()] {
+                    return detail::load_mesh_from_archive(
+                        *archive, file, [&type]( std::string_view path ) {
+                            return load_point_set< dimension >( type, path );
+                        } );
+                },
+                typename Corner< dimension >::CornersKey{} );
+            corner.set_mesh_saved(
+                archive_id, typename Corner< dimension >::CornersKey{} );
+        }
+    }
+
     template < index_t dimension >
     auto Corners< dimension >::corners() const -> CornerRange
     {
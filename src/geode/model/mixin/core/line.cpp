@@ -110,6 +110,33 @@ namespace geode
         return impl_->mesh_type();
     }
 
+    template < index_t dimension >
+    bool Line< dimension >::is_mesh_loaded() const
+    {
+        return impl_->is_mesh_loaded();
+    }
+
+    template < index_t dimension >
+    bool Line< dimension >::is_mesh_saved(
+        std::string_view archive_id ) const
+    {
+        return impl_->is_mesh_saved( archive_id );
+    }
+
+    template < index_t dimension >
+    void Line< dimension >::set_mesh_loader(
+        std::function< std::unique_ptr< Mesh >() > loader, LinesKey /*unused*/ )
+    {
+        impl_->set_mesh_loader( this->id(), std::move( loader ) );
+    }
+
+    template < index_t dimension >
+    void Line< dimension >::set_mesh_saved(
+        std::string_view archive_id, LinesKey /*unused*/ ) const
+    {
+        impl_->set_mesh_saved( archive_id );
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void Line< dimension >::serialize( Archive& serializer )
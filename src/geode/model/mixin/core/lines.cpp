@@ -29,6 +29,7 @@
 #include <geode/basic/identifier_builder.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/range.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/io/edged_curve_input.hpp>
@@ -90,20 +91,41 @@ namespace geode
 
     template < index_t dimension >
     void Lines< dimension >::save_lines( std::string_view directory ) const
+    {
+        save_lines(
+            directory,
+            []( const Line< dimension >& /*unused*/ ) {
+                return true;
+            },
+            "" );
+    }
+
+    template < index_t dimension >
+    void Lines< dimension >::save_lines( std::string_view directory,
+        const std::function< bool( const Line< dimension >& ) >& mesh_filter,
+        std::string_view archive_id ) const
     {
         impl_->save_components( absl::StrCat( directory, "/lines" ) );
         const auto prefix = absl::StrCat(
             directory, "/", Line< dimension >::component_type_static().get() );
-        absl::FixedArray< async::task< void > > tasks( nb_lines() );
-        index_t count{ 0 };
+        std::vector< async::task< void > > tasks;
+        tasks.reserve( nb_lines() );
         for( const auto& line : lines() )
         {
-            tasks[count++] = async::spawn( [&line, &prefix] {
+            if( !mesh_filter( line ) )
+            {
+                line.set_mesh_saved(
+                    archive_id, typename Line< dimension >::LinesKey{} );
+                continue;
+            }
+            tasks.emplace_back( async::spawn( [&line, &prefix, &archive_id] {
                 const auto& mesh = line.mesh();
                 const auto file = absl::StrCat(
                     prefix, line.id().string(), ".", mesh.native_extension() );
                 save_edged_curve( mesh, file );
-            } );
+                line.set_mesh_saved(
+                    archive_id, typename Line< dimension >::LinesKey{} );
+            } ) );
         }
         for( auto& task : async::when_all( tasks ).get() )
         {
@@ -134,6 +156,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Lines< dimension >::load_lines(
+        std::shared_ptr< const UnzipFile > archive, LinesBuilderKey key )
+    {
+        impl_->load_components(
+            absl::StrCat( archive->directory(), "/lines" ) );
+        const auto mapping = impl_->file_mapping( *archive );
+        const auto archive_id = detail::model_archive_id( *archive );
+        for( auto& line : modifiable_lines( key ) )
+        {
+            line.set_mesh_loader(
+                [archive, file = mapping.at( line.id().string() ),
+                    type = line.mesh_type()] {
+                    return detail::load_mesh_from_archive(
+                        *archive, file, [&type]( std::string_view path ) {
+                            return load_edged_curve< dimension >( type, path );
+                        } );
+                },
+                typename Line< dimension >::LinesKey{} );
+            line.set_mesh_saved(
+                archive_id, typename Line< dimension >::LinesKey{} );
+        }
+    }
+
     template < index_t dimension >
     auto Lines< dimension >::lines() const -> LineRange
     {
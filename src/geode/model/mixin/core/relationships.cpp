@@ -23,13 +23,12 @@
 
 #include <geode/model/mixin/core/relationships.hpp>
 
-#include <fstream>
-
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/detail/count_range_elements.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/bitsery_archive.hpp>
 
@@ -167,27 +166,28 @@ namespace geode
         void save( std::string_view directory ) const
         {
             const auto filename = absl::StrCat( directory, "/relationships" );
-            std::ofstream file{ filename, std::ofstream::binary };
+            const auto file = open_output_file( filename );
             TContext context{};
             BitseryExtensions::register_serialize_pcontext(
                 std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, *file };
             archive.object( *this );
             archive.adapter().flush();
             OpenGeodeModelException::check_exception(
                 std::get< 1 >( context ).isValid(), nullptr,
                 OpenGeodeException::TYPE::internal,
                 "[Relationships::save] Error while writing file: ", filename );
+            file->close();
         }
 
         void load( std::string_view directory )
         {
             const auto filename = absl::StrCat( directory, "/relationships" );
-            std::ifstream file{ filename, std::ifstream::binary };
+            const auto file = open_input_file( filename );
             TContext context{};
             BitseryExtensions::register_deserialize_pcontext(
                 std::get< 0 >( context ) );
-            Deserializer archive{ context, file };
+            Deserializer archive{ context, *file };
             archive.object( *this );
             const auto& adapter = archive.adapter();
             OpenGeodeModelException::check_exception(
@@ -107,6 +107,34 @@ namespace geode
         return impl_->mesh_type();
     }
 
+    template < index_t dimension >
+    bool Surface< dimension >::is_mesh_loaded() const
+    {
+        return impl_->is_mesh_loaded();
+    }
+
+    template < index_t dimension >
+    bool Surface< dimension >::is_mesh_saved(
+        std::string_view archive_id ) const
+    {
+        return impl_->is_mesh_saved( archive_id );
+    }
+
+    template < index_t dimension >
+    void Surface< dimension >::set_mesh_loader(
+        std::function< std::unique_ptr< Mesh >() > loader,
+        SurfacesKey /*unused*/ )
+    {
+        impl_->set_mesh_loader( this->id(), std::move( loader ) );
+    }
+
+    template < index_t dimension >
+    void Surface< dimension >::set_mesh_saved(
+        std::string_view archive_id, SurfacesKey /*unused*/ ) const
+    {
+        impl_->set_mesh_saved( archive_id );
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void Surface< dimension >::serialize( Archive& serializer )
@@ -29,6 +29,7 @@
 #include <geode/basic/identifier_builder.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/range.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/mesh/core/mesh_factory.hpp>
 #include <geode/mesh/core/polygonal_surface.hpp>
@@ -41,6 +42,22 @@
 #include <geode/model/mixin/core/detail/components_storage.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 
+namespace
+{
+    template < geode::index_t dimension >
+    std::unique_ptr< geode::SurfaceMesh< dimension > > load_surface_mesh(
+        const geode::MeshImpl& mesh_type, std::string_view file )
+    {
+        if( geode::MeshFactory::type( mesh_type )
+            == geode::TriangulatedSurface< dimension >::type_name_static() )
+        {
+            return geode::load_triangulated_surface< dimension >(
+                mesh_type, file );
+        }
+        return geode::load_polygonal_surface< dimension >( mesh_type, file );
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -97,15 +114,35 @@ namespace geode
     template < index_t dimension >
     void Surfaces< dimension >::save_surfaces(
         std::string_view directory ) const
+    {
+        save_surfaces(
+            directory,
+            []( const Surface< dimension >& /*unused*/ ) {
+                return true;
+            },
+            "" );
+    }
+
+    template < index_t dimension >
+    void Surfaces< dimension >::save_surfaces( std::string_view directory,
+        const std::function< bool( const Surface< dimension >& ) >&
+            mesh_filter,
+        std::string_view archive_id ) const
     {
         impl_->save_components( absl::StrCat( directory, "/surfaces" ) );
         const auto prefix = absl::StrCat( directory, "/",
             Surface< dimension >::component_type_static().get() );
-        absl::FixedArray< async::task< void > > tasks( nb_surfaces() );
-        index_t count{ 0 };
+        std::vector< async::task< void > > tasks;
+        tasks.reserve( nb_surfaces() );
         for( const auto& surface : surfaces() )
         {
-            tasks[count++] = async::spawn( [&surface, &prefix] {
+            if( !mesh_filter( surface ) )
+            {
+                surface.set_mesh_saved(
+                    archive_id, typename Surface< dimension >::SurfacesKey{} );
+                continue;
+            }
+            tasks.emplace_back( async::spawn( [&surface, &prefix, &archive_id] {
                 const auto& mesh = surface.mesh();
                 const auto file = absl::StrCat( prefix, surface.id().string(),
                     ".", mesh.native_extension() );
@@ -127,7 +164,9 @@ namespace geode
                         "[Surfaces::save_surfaces] Cannot find the explicit "
                         "SurfaceMesh type" };
                 }
-            } );
+                surface.set_mesh_saved(
+                    archive_id, typename Surface< dimension >::SurfacesKey{} );
+            } ) );
         }
         for( auto& task : async::when_all( tasks ).get() )
         {
@@ -147,19 +186,9 @@ namespace geode
         {
             tasks[count++] = async::spawn( [&surface, &mapping] {
                 const auto file = mapping.at( surface.id().string() );
-                if( MeshFactory::type( surface.mesh_type() )
-                    == TriangulatedSurface< dimension >::type_name_static() )
-                {
-                    surface.set_mesh( load_triangulated_surface< dimension >(
-                                          surface.mesh_type(), file ),
-                        typename Surface< dimension >::SurfacesKey{} );
-                }
-                else
-                {
-                    surface.set_mesh( load_polygonal_surface< dimension >(
-                                          surface.mesh_type(), file ),
-                        typename Surface< dimension >::SurfacesKey{} );
-                }
+                surface.set_mesh(
+                    load_surface_mesh< dimension >( surface.mesh_type(), file ),
+                    typename Surface< dimension >::SurfacesKey{} );
             } );
         }
         for( auto& task : async::when_all( tasks ).get() )
@@ -168,6 +197,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Surfaces< dimension >::load_surfaces(
+        std::shared_ptr< const UnzipFile > archive, SurfacesBuilderKey key )
+    {
+        impl_->load_components(
+            absl::StrCat( archive->directory(), "/surfaces" ) );
+        const auto mapping = impl_->file_mapping( *archive );
+        const auto archive_id = detail::model_archive_id( *archive );
+        for( auto& surface : modifiable_surfaces( key ) )
+        {
+            surface.set_mesh_loader(
+                [archive, file = mapping.at( surface.id().string() ),
+                    type = surface.mesh_type()] {
+                    return detail::load_mesh_from_archive(
+                        *archive, file, [&type]( std::string_view path ) {
+                            return load_surface_mesh< dimension >( type, path );
+                        } );
+                },
+                typename Surface< dimension >::SurfacesKey{} );
+            surface.set_mesh_saved(
+                archive_id, typename Surface< dimension >::SurfacesKey{} );
+        }
+    }
+
     template < index_t dimension >
     auto Surfaces< dimension >::surfaces() const -> SurfaceRange
     {
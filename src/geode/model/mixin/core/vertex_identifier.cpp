@@ -23,17 +23,21 @@
 
 #include <geode/model/mixin/core/vertex_identifier.hpp>
 
-#include <fstream>
+#include <functional>
 
 #include <async++.h>
 
+#include <absl/base/call_once.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
 
+#include <geode/basic/algorithm.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/variable_attribute.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/bitsery_archive.hpp>
 
@@ -52,6 +56,381 @@
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 
+namespace
+{
+    /*!
+     * Unique vertex attribute of a component mesh.
+     * When the component mesh is loaded on demand, the attribute is only
+     * retrieved on first access to avoid decoding the mesh.
+     */
+    class ComponentUniqueVertices
+    {
+    public:
+        using Attribute = geode::VariableAttribute< geode::index_t >;
+        using AttributeLoader = std::function< std::shared_ptr< Attribute >() >;
+
+        explicit ComponentUniqueVertices(
+            std::shared_ptr< Attribute > attribute )
+            : attribute_{ std::move( attribute ) }
+        {
+        }
+
+        explicit ComponentUniqueVertices( AttributeLoader loader )
+            : loader_{ std::move( loader ) }
+        {
+        }
+
+        [[nodiscard]] Attribute* operator->() const
+        {
+            return attribute().get();
+        }
+
+        void set_value(
+            geode::index_t vertex, geode::index_t unique_vertex ) const
+        {
+            attribute()->set_value( vertex, unique_vertex );
+        }
+
+    private:
+        [[nodiscard]] const std::shared_ptr< Attribute >& attribute() const
+        {
+            absl::call_once( once_, [this] {
+                if( loader_ )
+                {
+                    attribute_ = loader_();
+                    loader_ = nullptr;
+                }
+            } );
+            return attribute_;
+        }
+
+    private:
+        mutable absl::once_flag once_;
+        mutable AttributeLoader loader_;
+        mutable std::shared_ptr< Attribute > attribute_;
+    };
+
+    /*!
+     * Component mesh vertices of all the unique vertices, stored in a single
+     * buffer in which each unique vertex owns a contiguous slice.
+     * A full slice is moved at the end of the buffer with a doubled capacity,
+     * the buffer is compacted when the unused space becomes too large.
+     * Each component id is stored once, the buffer only holds its index.
+     */
+    class ComponentMeshVerticesPool
+    {
+        using Vertex = geode::detail::InternedComponentMeshVertex;
+        struct Slice
+        {
+            geode::index_t offset{ 0 };
+            geode::index_t size{ 0 };
+            geode::index_t capacity{ 0 };
+        };
+
+    public:
+        [[nodiscard]] geode::ComponentMeshVertices vertices(
+            geode::index_t unique_vertex ) const
+        {
+            return { interned_vertices( unique_vertex ), components_ };
+        }
+
+        [[nodiscard]] absl::Span< const Vertex > interned_vertices(
+            geode::index_t unique_vertex ) const
+        {
+            const auto& slice = slices_[unique_vertex];
+            return { pool_.data() + slice.offset, slice.size };
+        }
+
+        [[nodiscard]] absl::Span< Vertex > modifiable_vertices(
+            geode::index_t unique_vertex )
+        {
+            const auto& slice = slices_[unique_vertex];
+            return { pool_.data() + slice.offset, slice.size };
+        }
+
+        [[nodiscard]] const geode::ComponentID& component(
+            geode::index_t component ) const
+        {
+            return components_[component];
+        }
+
+        /*!
+         * Return the index of a component, NO_ID if it was never interned
+         */
+        [[nodiscard]] geode::index_t component_index(
+            const geode::uuid& component_id ) const
+        {
+            const auto it = component_indices_.find( component_id );
+            if( it == component_indices_.end() )
+            {
+                return geode::NO_ID;
+            }
+            return it->second;
+        }
+
+        [[nodiscard]] Vertex interned(
+            const geode::ComponentMeshVertex& component_vertex ) const
+        {
+            return { component_index( component_vertex.component_id.id ),
+                component_vertex.vertex };
+        }
+
+        /*!
+         * Return the index of a component, adding it to the known components
+         * if needed. Indices are never reused.
+         */
+        geode::index_t intern( const geode::ComponentID& component_id )
+        {
+            const auto [it, inserted] = component_indices_.try_emplace(
+                component_id.id, components_.size() );
+            if( inserted )
+            {
+                components_.push_back( component_id );
+            }
+            return it->second;
+        }
+
+        void create_unique_vertices( geode::index_t nb )
+        {
+            slices_.resize( slices_.size() + nb );
+        }
+
+        void add( geode::index_t unique_vertex, Vertex component_vertex )
+        {
+            const auto& slice = slices_[unique_vertex];
+            if( slice.size == slice.capacity )
+            {
+                reserve( unique_vertex,
+                    std::max( geode::index_t{ 2 }, 2 * slice.capacity ) );
+            }
+            auto& new_slice = slices_[unique_vertex];
+            pool_[new_slice.offset + new_slice.size] = component_vertex;
+            new_slice.size++;
+        }
+
+        /*!
+         * Make room for the given number of additional vertices in the slice
+         * of each given unique vertex, so that the next calls to add_reserved
+         * on them do not move the buffer. Such calls can then be done
+         * concurrently on different unique vertices.
+         * The buffer is compacted and grown at most once, before any slice is
+         * moved, so that the room reserved for a unique vertex is kept.
+         */
+        void reserve_additional(
+            absl::Span< const geode::index_t > unique_vertices,
+            absl::Span< const geode::index_t > nb_added )
+        {
+            if( 2 * nb_unused_ > pool_.size() )
+            {
+                compact();
+            }
+            auto offset = static_cast< geode::index_t >( pool_.size() );
+            geode::index_t nb_new{ 0 };
+            for( const auto i : geode::Indices{ unique_vertices } )
+            {
+                const auto& slice = slices_[unique_vertices[i]];
+                if( slice.size + nb_added[i] > slice.capacity )
+                {
+                    nb_new += std::max(
+                        geode::index_t{ 2 }, slice.size + nb_added[i] );
+                }
+            }
+            if( nb_new == 0 )
+            {
+                return;
+            }
+            pool_.resize( offset + nb_new );
+            for( const auto i : geode::Indices{ unique_vertices } )
+            {
+                auto& slice = slices_[unique_vertices[i]];
+                if( slice.size + nb_added[i] <= slice.capacity )
+                {
+                    continue;
+                }
+                const auto capacity =
+                    std::max( geode::index_t{ 2 }, slice.size + nb_added[i] );
+                move_slice( slice, offset, capacity );
+                offset += capacity;
+            }
+        }
+
+        /*!
+         * Add a vertex to a slice which has enough room for it,
+         * see reserve_additional. The buffer is never moved.
+         */
+        void add_reserved(
+            geode::index_t unique_vertex, Vertex component_vertex )
+        {
+            auto& slice = slices_[unique_vertex];
+            geode::OpenGeodeModelException::check_assertion(
+                slice.size < slice.capacity,
+                "[ComponentMeshVerticesPool::add_reserved] Slice capacity "
+                "should have been reserved" );
+            pool_[slice.offset + slice.size] = component_vertex;
+            slice.size++;
+        }
+
+        template < typename DeleteContainer >
+        void remove(
+            geode::index_t unique_vertex, const DeleteContainer& to_delete )
+        {
+            auto vertices = modifiable_vertices( unique_vertex );
+            geode::index_t nb_kept{ 0 };
+            for( const auto v : geode::Indices{ vertices } )
+            {
+                if( to_delete[v] )
+                {
+                    continue;
+                }
+                if( nb_kept != v )
+                {
+                    vertices[nb_kept] = vertices[v];
+                }
+                nb_kept++;
+            }
+            slices_[unique_vertex].size = nb_kept;
+        }
+
+        void delete_unique_vertices(
+            absl::Span< const geode::index_t > old2new )
+        {
+            geode::index_t nb_kept{ 0 };
+            for( const auto v : geode::Indices{ old2new } )
+            {
+                if( old2new[v] == geode::NO_ID )
+                {
+                    nb_unused_ += slices_[v].capacity;
+                    continue;
+                }
+                slices_[old2new[v]] = slices_[v];
+                nb_kept++;
+            }
+            slices_.resize( nb_kept );
+            if( 2 * nb_unused_ > pool_.size() )
+            {
+                compact();
+            }
+        }
+
+        void compact()
+        {
+            geode::index_t nb_used{ 0 };
+            for( const auto& slice : slices_ )
+            {
+                nb_used += slice.size;
+            }
+            if( nb_used == pool_.size() )
+            {
+                return;
+            }
+            std::vector< Vertex > pool;
+            pool.reserve( nb_used );
+            for( auto& slice : slices_ )
+            {
+                const auto offset =
+                    static_cast< geode::index_t >( pool.size() );
+                for( const auto v : geode::Range{ slice.size } )
+                {
+                    pool.push_back( pool_[slice.offset + v] );
+                }
+                slice.offset = offset;
+                slice.capacity = slice.size;
+            }
+            pool_ = std::move( pool );
+            nb_unused_ = 0;
+        }
+
+    private:
+        void reserve( geode::index_t unique_vertex, geode::index_t capacity )
+        {
+            if( 2 * nb_unused_ > pool_.size() )
+            {
+                compact();
+            }
+            const auto offset = static_cast< geode::index_t >( pool_.size() );
+            pool_.resize( offset + capacity );
+            move_slice( slices_[unique_vertex], offset, capacity );
+        }
+
+        void move_slice(
+            Slice& slice, geode::index_t offset, geode::index_t capacity )
+        {
+            std::copy( pool_.begin() + slice.offset,
+                pool_.begin() + slice.offset + slice.size,
+                pool_.begin() + offset );
+            nb_unused_ += slice.capacity;
+            slice.offset = offset;
+            slice.capacity = capacity;
+        }
+
+        friend class bitsery::Access;
+        template < typename Archive >
+        void serialize( Archive& serializer )
+        {
+            serializer.ext( *this,
+                geode::Growable< Archive, ComponentMeshVerticesPool >{
+                    { []( Archive& archive, ComponentMeshVerticesPool& pool ) {
+                         archive.container( pool.slices_,
+                             pool.slices_.max_size(), serialize_slice );
+                         std::vector< geode::ComponentMeshVertex > vertices;
+                         pool.pool_.clear();
+                         archive.container( vertices, vertices.max_size(),
+                             []( Archive& archive2,
+                                 geode::ComponentMeshVertex& vertex ) {
+                                 archive2.object( vertex );
+                             } );
+                         pool.pool_.reserve( vertices.size() );
+                         for( const auto& vertex : vertices )
+                         {
+                             pool.pool_.push_back(
+                                 { pool.intern( vertex.component_id ),
+                                     vertex.vertex } );
+                         }
+                     },
+                        []( Archive& archive,
+                            ComponentMeshVerticesPool& pool ) {
+                            pool.compact();
+                            archive.container( pool.slices_,
+                                pool.slices_.max_size(), serialize_slice );
+                            archive.container( pool.components_,
+                                pool.components_.max_size(),
+                                []( Archive& archive2,
+                                    geode::ComponentID& component_id ) {
+                                    archive2.object( component_id );
+                                } );
+                            archive.container( pool.pool_,
+                                pool.pool_.max_size(),
+                                []( Archive& archive2, Vertex& vertex ) {
+                                    archive2.value4b( vertex.component );
+                                    archive2.value4b( vertex.vertex );
+                                } );
+                            pool.component_indices_.clear();
+                            for( const auto c :
+                                geode::Indices{ pool.components_ } )
+                            {
+                                pool.component_indices_.emplace(
+                                    pool.components_[c].id, c );
+                            }
+                        } } } );
+        }
+
+        template < typename Archive >
+        static void serialize_slice( Archive& archive, Slice& slice )
+        {
+            archive.value4b( slice.offset );
+            archive.value4b( slice.size );
+            archive.value4b( slice.capacity );
+        }
+
+    private:
+        std::vector< Slice > slices_;
+        std::vector< Vertex > pool_;
+        geode::index_t nb_unused_{ 0 };
+        std::vector< geode::ComponentID > components_;
+        absl::flat_hash_map< geode::uuid, geode::index_t > component_indices_;
+    };
+} // namespace
+
 namespace geode
 {
     ComponentMeshVertex::ComponentMeshVertex(
@@ -103,30 +482,11 @@ namespace geode
     class VertexIdentifier::Impl
     {
         constexpr static auto UNIQUE_VERTICES_NAME = "unique vertices";
+        using ComponentVerticesAttribute = std::shared_ptr<
+            VariableAttribute< std::vector< ComponentMeshVertex > > >;
 
     public:
-        Impl()
-        {
-            AttributeProperties attribute_properties;
-            attribute_properties.assignable = false;
-            attribute_properties.interpolable = false;
-            attribute_properties.transferable = false;
-            AttributeValues< std::vector< ComponentMeshVertex > >
-                component_vertices_attribute_values;
-            component_vertices_attribute_values.default_value = {};
-            component_vertices_attribute_values.no_value = {};
-            const auto unique_vertices_attribute_id =
-                unique_vertices_.vertex_attribute_manager()
-                    .create_attribute< VariableAttribute,
-                        std::vector< ComponentMeshVertex > >(
-                        "component vertices",
-                        component_vertices_attribute_values,
-                        attribute_properties );
-            component_vertices_ = unique_vertices_.vertex_attribute_manager()
-                                      .find_attribute< VariableAttribute,
-                                          std::vector< ComponentMeshVertex > >(
-                                          unique_vertices_attribute_id );
-        }
+        Impl() = default;
 
         Impl( BITSERY ) {}
 
@@ -140,7 +500,7 @@ namespace geode
             return component_mesh_vertices( unique_vertex_id ).empty();
         }
 
-        const std::vector< ComponentMeshVertex >& component_mesh_vertices(
+        ComponentMeshVertices component_mesh_vertices(
             index_t unique_vertex_id ) const
         {
             OpenGeodeModelException::check_assertion(
@@ -148,7 +508,7 @@ namespace geode
                 "[VertexIdentifier::component_mesh_vertices] Given "
                 "unique_vertex_id is bigger than the number of unique "
                 "vertices." );
-            return component_vertices_->value( unique_vertex_id );
+            return component_vertices_.vertices( unique_vertex_id );
         }
 
         index_t unique_vertex(
@@ -160,11 +520,12 @@ namespace geode
         bool has_component_mesh_vertices(
             index_t unique_vertex_id, const ComponentType& type ) const
         {
-            const auto& component_vertices =
-                component_mesh_vertices( unique_vertex_id );
-            for( const auto& component_vertex : component_vertices )
+            for( const auto& component_vertex :
+                component_vertices_.interned_vertices( unique_vertex_id ) )
             {
-                if( component_vertex.component_id.type == type )
+                if( component_vertices_.component( component_vertex.component )
+                        .type
+                    == type )
                 {
                     return true;
                 }
@@ -175,15 +536,17 @@ namespace geode
         bool has_component_mesh_vertices(
             index_t unique_vertex_id, const uuid& component_id ) const
         {
-            for( const auto& component_vertex :
-                component_mesh_vertices( unique_vertex_id ) )
+            const auto component = component_vertices_.component_index(
+                component_id );
+            if( component == NO_ID )
             {
-                if( component_vertex.component_id.id == component_id )
-                {
-                    return true;
-                }
+                return false;
             }
-            return false;
+            return absl::c_any_of(
+                component_vertices_.interned_vertices( unique_vertex_id ),
+                [component]( const auto& component_vertex ) {
+                    return component_vertex.component == component;
+                } );
         }
 
         template < typename MeshComponent >
@@ -202,11 +565,11 @@ namespace geode
                     .template create_attribute< VariableAttribute, index_t >(
                         UNIQUE_VERTICES_NAME, unqiue_vertex_attribute_values,
                         attribute_properties );
-            const auto [_, inserted] =
-                vertex2unique_vertex_.emplace( component.id(),
-                    mesh.vertex_attribute_manager()
-                        .template find_attribute< VariableAttribute, index_t >(
-                            unique_vertices_attribute_id ) );
+            const auto [_, inserted] = vertex2unique_vertex_.try_emplace(
+                component.id(),
+                mesh.vertex_attribute_manager()
+                    .template find_attribute< VariableAttribute, index_t >(
+                        unique_vertices_attribute_id ) );
             OpenGeodeModelException::check_exception( inserted,
                 component.component_id(), OpenGeodeException::TYPE::data,
                 "[VertexIdentifier::register_component] Component ",
@@ -216,45 +579,42 @@ namespace geode
         template < typename MeshComponent >
         void load_component( const MeshComponent& component )
         {
-            const auto& mesh = component.mesh();
-            const auto unique_vertices_ids =
-                mesh.vertex_attribute_manager().attribute_ids_matching_name(
-                    UNIQUE_VERTICES_NAME );
-            OpenGeodeModelException::check_exception(
-                unique_vertices_ids.has_value(), nullptr,
-                OpenGeodeException::TYPE::data,
-                "[VertexIdentifier::load_component] Unique vertices "
-                "attribute not found." );
-            const auto [_, inserted] =
-                vertex2unique_vertex_.emplace( component.id(),
-                    mesh.vertex_attribute_manager()
-                        .template find_attribute< VariableAttribute, index_t >(
-                            unique_vertices_ids.value().front() ) );
-            OpenGeodeModelException::check_exception( inserted,
-                component.component_id(), OpenGeodeException::TYPE::data,
-                "[VertexIdentifier::load_component] Component ",
-                component.id().string(), " is already registered." );
+            if( component.is_mesh_loaded() )
+            {
+                const auto [_, inserted] = vertex2unique_vertex_.try_emplace(
+                    component.id(), find_unique_vertices( component ) );
+                check_loaded_component( component, inserted );
+                return;
+            }
+            const auto [_, inserted] = vertex2unique_vertex_.try_emplace(
+                component.id(), ComponentUniqueVertices::AttributeLoader{
+                                    [&component] {
+                                        return find_unique_vertices(
+                                            component );
+                                    } } );
+            check_loaded_component( component, inserted );
         }
 
         template < typename MeshComponent >
         void unregister_component( const MeshComponent& component )
         {
             const auto& mesh = component.mesh();
-            auto attribute = vertex2unique_vertex_.at( component.id() );
-            const auto attribute_id = attribute->id();
+            const auto attribute_id =
+                vertex2unique_vertex_.at( component.id() )->id();
             mesh.vertex_attribute_manager().delete_attribute( attribute_id );
             vertex2unique_vertex_.erase( component.id() );
             filter_component_vertices( component.id() );
+            component_unique_vertices_.erase( component.id() );
         }
 
         index_t create_unique_vertex()
         {
-            return VertexSetBuilder::create( unique_vertices_ )
-                ->create_vertex();
+            return create_unique_vertices( 1 );
         }
 
         index_t create_unique_vertices( const index_t nb )
         {
+            component_vertices_.create_unique_vertices( nb );
             return VertexSetBuilder::create( unique_vertices_ )
                 ->create_vertices( nb );
         }
@@ -262,27 +622,87 @@ namespace geode
         void set_unique_vertex( ComponentMeshVertex component_vertex_id,
             const index_t unique_vertex_id )
         {
-            OpenGeodeModelException::check_assertion(
-                unique_vertex_id < nb_unique_vertices(),
-                "[VertexIdentifier::set_unique_vertex] Unique vertex ",
-                unique_vertex_id, " does not exist (nb=", nb_unique_vertices(),
-                ")" );
-            const auto& old_unique_id =
-                vertex2unique_vertex_.at( component_vertex_id.component_id.id )
-                    ->value( component_vertex_id.vertex );
-            if( old_unique_id != NO_ID )
+            update_component_vertex( component_vertex_id, unique_vertex_id );
+            const auto interned =
+                component_vertices_.interned( component_vertex_id );
+            const auto vertices =
+                component_vertices_.interned_vertices( unique_vertex_id );
+            if( absl::c_find( vertices, interned ) == vertices.end() )
             {
-                unset_unique_vertex( component_vertex_id, old_unique_id );
+                component_vertices_.add( unique_vertex_id, interned );
             }
-            vertex2unique_vertex_.at( component_vertex_id.component_id.id )
-                ->set_value( component_vertex_id.vertex, unique_vertex_id );
-            component_vertices_->modify_value( unique_vertex_id,
-                [&component_vertex_id](
-                    std::vector< ComponentMeshVertex >& value ) {
-                    if( absl::c_find( value, component_vertex_id )
-                        == value.end() )
+        }
+
+        void set_unique_vertices(
+            absl::Span< const ComponentMeshVertex > component_vertices,
+            absl::Span< const index_t > unique_vertex_ids )
+        {
+            OpenGeodeModelException::check_exception(
+                component_vertices.size() == unique_vertex_ids.size(),
+                nullptr, OpenGeodeException::TYPE::data,
+                "[VertexIdentifier::set_unique_vertices] Number of component "
+                "vertices and unique vertices should match" );
+            std::vector< index_t > to_add( component_vertices.size() );
+            for( const auto i : Indices{ component_vertices } )
+            {
+                update_component_vertex(
+                    component_vertices[i], unique_vertex_ids[i] );
+                to_add[i] = i;
+            }
+            // Group the additions by unique vertex, keeping the input order
+            // in each group so that the result does not depend on threads
+            absl::c_stable_sort(
+                to_add, [&unique_vertex_ids]( index_t lhs, index_t rhs ) {
+                    return unique_vertex_ids[lhs] < unique_vertex_ids[rhs];
+                } );
+            std::vector< index_t > groups;
+            for( const auto i : Indices{ to_add } )
+            {
+                if( i == 0
+                    || unique_vertex_ids[to_add[i]]
+                           != unique_vertex_ids[to_add[i - 1]] )
+                {
+                    groups.push_back( i );
+                }
+            }
+            groups.push_back( to_add.size() );
+            std::vector< index_t > group_unique_vertices( groups.size() - 1 );
+            std::vector< index_t > group_sizes( groups.size() - 1 );
+            for( const auto g : Indices{ group_unique_vertices } )
+            {
+                group_unique_vertices[g] =
+                    unique_vertex_ids[to_add[groups[g]]];
+                group_sizes[g] = groups[g + 1] - groups[g];
+            }
+            component_vertices_.reserve_additional(
+                group_unique_vertices, group_sizes );
+            async::parallel_for(
+                async::irange( size_t{ 0 }, groups.size() - 1 ),
+                [this, &component_vertices, &to_add, &groups,
+                    &group_unique_vertices]( size_t g ) {
+                    const auto unique_vertex_id = group_unique_vertices[g];
+                    for( const auto i : Range{ groups[g], groups[g + 1] } )
                     {
-                        value.emplace_back( std::move( component_vertex_id ) );
+                        const auto& component_vertex =
+                            component_vertices[to_add[i]];
+                        // Skip vertices set again later in the batch
+                        if( unique_vertex( component_vertex.component_id.id,
+                                component_vertex.vertex )
+                            != unique_vertex_id )
+                        {
+                            continue;
+                        }
+                        const auto interned =
+                            component_vertices_.interned( component_vertex );
+                        const auto vertices =
+                            component_vertices_.interned_vertices(
+                                unique_vertex_id );
+                        if( absl::c_find( vertices, interned )
+                            == vertices.end() )
+                        {
+                            component_vertices_.add_reserved(
+                                unique_vertex_id, interned );
+                        }
                     }
                 } );
         }
@@ -292,39 +712,32 @@ namespace geode
             const index_t unique_vertex_id )
         {
             vertex2unique_vertex_.at( component_vertex_id.component_id.id )
-                ->set_value( component_vertex_id.vertex, NO_ID );
-            const auto& vertices =
-                component_vertices_->value( unique_vertex_id );
-            const auto it = absl::c_find( vertices, component_vertex_id );
-            if( it == vertices.end() )
-            {
-                return;
-            }
-            component_vertices_->modify_value( unique_vertex_id,
-                [&it]( std::vector< ComponentMeshVertex >& value ) {
-                    value.erase(
-                        // workaround for gcc < 4.9
-                        value.begin() + ( it - value.cbegin() ) );
-                } );
+                .set_value( component_vertex_id.vertex, NO_ID );
+            remove_component_vertex( component_vertex_id, unique_vertex_id );
         }
 
         void update_unique_vertices( const ComponentID& component_id,
             absl::Span< const index_t > old2new )
         {
+            auto& unique_vertices =
+                component_unique_vertices( component_id.id );
+            std::vector< uint8_t > to_keep( unique_vertices.size(), true );
+            const auto component =
+                component_vertices_.component_index( component_id.id );
             async::parallel_for(
-                async::irange( index_t{ 0 }, nb_unique_vertices() ),
-                [this, &component_id, &old2new]( index_t uv ) {
-                    if( !has_component_mesh_vertices( uv, component_id.id ) )
-                    {
-                        return;
-                    }
-                    const auto& all_vertices = component_vertices_->value( uv );
+                async::irange( size_t{ 0 }, unique_vertices.size() ),
+                [this, component, &old2new, &unique_vertices, &to_keep](
+                    size_t i ) {
+                    const auto uv = unique_vertices[i];
+                    auto all_vertices =
+                        component_vertices_.modifiable_vertices( uv );
                     std::vector< bool > to_delete( all_vertices.size(), false );
                     bool need_to_delete{ false };
+                    bool is_kept{ false };
                     for( const auto v : Indices{ all_vertices } )
                     {
-                        const auto& cmv = all_vertices[v];
-                        if( cmv.component_id.id != component_id.id )
+                        auto& cmv = all_vertices[v];
+                        if( cmv.component != component )
                         {
                             continue;
                         }
@@ -336,22 +749,18 @@ namespace geode
                         }
                         else
                         {
-                            component_vertices_->modify_value( uv,
-                                [v, new_id]( std::vector< ComponentMeshVertex >&
-                                        vertices ) {
-                                    vertices[v].vertex = new_id;
-                                } );
+                            is_kept = true;
+                            cmv.vertex = new_id;
                         }
                     }
                     if( need_to_delete )
                     {
-                        component_vertices_->modify_value( uv,
-                            [&to_delete](
-                                std::vector< ComponentMeshVertex >& vertices ) {
-                                delete_vector_elements( to_delete, vertices );
-                            } );
+                        component_vertices_.remove( uv, to_delete );
                     }
+                    to_keep[i] = is_kept;
                 } );
+            unique_vertices =
+                extract_vector_elements( to_keep, unique_vertices );
         }
 
         std::vector< index_t > delete_isolated_vertices()
@@ -374,18 +783,29 @@ namespace geode
             }
             const auto old2new = VertexSetBuilder::create( unique_vertices_ )
                                      ->delete_vertices( to_delete );
+            component_vertices_.delete_unique_vertices( old2new );
+            for( auto& [_, unique_vertices] : component_unique_vertices_ )
+            {
+                for( auto& unique_vertex : unique_vertices )
+                {
+                    unique_vertex = old2new[unique_vertex];
+                }
+                unique_vertices.erase( std::remove( unique_vertices.begin(),
+                                           unique_vertices.end(), NO_ID ),
+                    unique_vertices.end() );
+            }
             for( const auto& component_vertices : components_vertices )
             {
-                auto& attribute =
+                const auto& attribute =
                     vertex2unique_vertex_.at( component_vertices.first );
                 for( const auto v : component_vertices.second )
                 {
                     const auto value = attribute->value( v );
-                    if( value == NO_ID )
+                    if( value == NO_ID || old2new[value] == value )
                     {
                         continue;
                     }
-                    attribute->set_value( v, old2new[value] );
+                    attribute.set_value( v, old2new[value] );
                 }
             }
             return old2new;
@@ -394,11 +814,11 @@ namespace geode
         void save( std::string_view directory ) const
         {
             const auto filename = absl::StrCat( directory, "/vertices" );
-            std::ofstream file{ filename, std::ofstream::binary };
+            const auto file = open_output_file( filename );
             TContext context{};
             BitseryExtensions::register_serialize_pcontext(
                 std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, *file };
             archive.object( *this );
             archive.adapter().flush();
             OpenGeodeModelException::check_exception(
@@ -406,17 +826,20 @@ namespace geode
                 OpenGeodeException::TYPE::internal,
                 "[VertexIdentifier::save] Error while writing file: ",
                 filename );
+            file->close();
         }
 
         void load( std::string_view directory )
         {
             const auto filename = absl::StrCat( directory, "/vertices" );
-            std::ifstream file{ filename, std::ifstream::binary };
+            const auto file = open_input_file( filename );
             TContext context{};
             BitseryExtensions::register_deserialize_pcontext(
                 std::get< 0 >( context ) );
-            Deserializer archive{ context, file };
+            Deserializer archive{ context, *file };
             archive.object( *this );
+            component_unique_vertices_.clear();
+            component_unique_vertices_initialized_ = false;
             const auto& adapter = archive.adapter();
             OpenGeodeModelException::check_exception(
                 adapter.error() == bitsery::ReaderError::NoError
@@ -428,6 +851,34 @@ namespace geode
         }
 
     private:
+        template < typename MeshComponent >
+        static std::shared_ptr< VariableAttribute< index_t > >
+            find_unique_vertices( const MeshComponent& component )
+        {
+            const auto& mesh = component.mesh();
+            const auto unique_vertices_ids =
+                mesh.vertex_attribute_manager().attribute_ids_matching_name(
+                    UNIQUE_VERTICES_NAME );
+            OpenGeodeModelException::check_exception(
+                unique_vertices_ids.has_value(), nullptr,
+                OpenGeodeException::TYPE::data,
+                "[VertexIdentifier::load_component] Unique vertices "
+                "attribute not found." );
+            return mesh.vertex_attribute_manager()
+                .template find_attribute< VariableAttribute, index_t >(
+                    unique_vertices_ids.value().front() );
+        }
+
+        template < typename MeshComponent >
+        static void check_loaded_component(
+            const MeshComponent& component, bool inserted )
+        {
+            OpenGeodeModelException::check_exception( inserted,
+                component.component_id(), OpenGeodeException::TYPE::data,
+                "[VertexIdentifier::load_component] Component ",
+                component.id().string(), " is already registered." );
+        }
+
         friend class bitsery::Access;
         template < typename Archive >
         void serialize( Archive& serializer )
@@ -436,8 +887,9 @@ namespace geode
                 Growable< Archive, Impl >{
                     { []( Archive& archive, Impl& impl ) {
                          archive.object( impl.unique_vertices_ );
-                         archive.ext( impl.component_vertices_,
-                             bitsery::ext::StdSmartPtr{} );
+                         ComponentVerticesAttribute component_vertices;
+                         archive.ext(
+                             component_vertices, bitsery::ext::StdSmartPtr{} );
                          absl::flat_hash_map< uuid,
                              std::shared_ptr< VariableAttribute< index_t > > >
                              old_map;
@@ -450,16 +902,12 @@ namespace geode
                                  archive2.ext(
                                      attribute, bitsery::ext::StdSmartPtr{} );
                              } );
-                         const auto& old_component_vertices_properties =
-                             impl.component_vertices_->properties();
-                         impl.component_vertices_->set_properties(
-                             { old_component_vertices_properties.assignable,
-                                 old_component_vertices_properties.interpolable,
-                                 false } );
+                         impl.import_component_vertices( *component_vertices );
                      },
                         []( Archive& archive, Impl& impl ) {
                             archive.object( impl.unique_vertices_ );
-                            archive.ext( impl.component_vertices_,
+                            ComponentVerticesAttribute component_vertices;
+                            archive.ext( component_vertices,
                                 bitsery::ext::StdSmartPtr{} );
                             absl::flat_hash_map< uuid,
                                 std::shared_ptr<
@@ -474,50 +922,161 @@ namespace geode
                                     archive2.ext( attribute,
                                         bitsery::ext::StdSmartPtr{} );
                                 } );
+                            impl.import_component_vertices(
+                                *component_vertices );
                         },
                         []( Archive& archive, Impl& impl ) {
                             archive.object( impl.unique_vertices_ );
-                            archive.ext( impl.component_vertices_,
+                            ComponentVerticesAttribute component_vertices;
+                            archive.ext( component_vertices,
                                 bitsery::ext::StdSmartPtr{} );
+                            impl.import_component_vertices(
+                                *component_vertices );
+                        },
+                        []( Archive& archive, Impl& impl ) {
+                            archive.object( impl.unique_vertices_ );
+                            archive.object( impl.component_vertices_ );
                         } } } );
         }
 
+        /*!
+         * Move the component vertices stored as a unique vertex attribute
+         * (older file versions) into the pool.
+         */
+        void import_component_vertices(
+            const VariableAttribute< std::vector< ComponentMeshVertex > >&
+                attribute )
+        {
+            component_vertices_.create_unique_vertices( nb_unique_vertices() );
+            for( const auto uv : Range{ nb_unique_vertices() } )
+            {
+                for( const auto& cmv : attribute.value( uv ) )
+                {
+                    component_vertices_.add( uv,
+                        { component_vertices_.intern( cmv.component_id ),
+                            cmv.vertex } );
+                }
+            }
+            unique_vertices_.vertex_attribute_manager().delete_attribute(
+                attribute.id() );
+        }
+
+        /*!
+         * Return the unique vertices referencing the given component.
+         * The reverse index is built from the unique vertices on first access,
+         * then kept up to date by set_unique_vertex. It may contain
+         * duplicated or stale values which are cleaned here.
+         */
+        std::vector< index_t >& component_unique_vertices(
+            const uuid& component_id )
+        {
+            if( !component_unique_vertices_initialized_ )
+            {
+                for( const auto uv : Range{ nb_unique_vertices() } )
+                {
+                    for( const auto& cmv : component_mesh_vertices( uv ) )
+                    {
+                        auto& unique_vertices =
+                            component_unique_vertices_[cmv.component_id.id];
+                        if( unique_vertices.empty()
+                            || unique_vertices.back() != uv )
+                        {
+                            unique_vertices.push_back( uv );
+                        }
+                    }
+                }
+                component_unique_vertices_initialized_ = true;
+            }
+            auto& unique_vertices = component_unique_vertices_[component_id];
+            sort_unique( unique_vertices );
+            return unique_vertices;
+        }
+
+        /*!
+         * Update the unique vertex of a component vertex and its reverse
+         * index, and remove it from its previous unique vertex. The caller
+         * adds it to the vertices of the new unique vertex.
+         */
+        void update_component_vertex(
+            const ComponentMeshVertex& component_vertex_id,
+            index_t unique_vertex_id )
+        {
+            OpenGeodeModelException::check_assertion(
+                unique_vertex_id < nb_unique_vertices(),
+                "[VertexIdentifier::set_unique_vertex] Unique vertex ",
+                unique_vertex_id, " does not exist (nb=", nb_unique_vertices(),
+                ")" );
+            component_vertices_.intern( component_vertex_id.component_id );
+            const auto& attribute =
+                vertex2unique_vertex_.at( component_vertex_id.component_id.id );
+            const auto old_unique_id =
+                attribute->value( component_vertex_id.vertex );
+            attribute.set_value( component_vertex_id.vertex, unique_vertex_id );
+            if( old_unique_id != NO_ID && old_unique_id != unique_vertex_id )
+            {
+                remove_component_vertex( component_vertex_id, old_unique_id );
+            }
+            if( component_unique_vertices_initialized_ )
+            {
+                component_unique_vertices_[component_vertex_id.component_id.id]
+                    .push_back( unique_vertex_id );
+            }
+        }
+
+        void remove_component_vertex(
+            const ComponentMeshVertex& component_vertex_id,
+            index_t unique_vertex_id )
+        {
+            const auto vertices =
+                component_vertices_.interned_vertices( unique_vertex_id );
+            const auto it = absl::c_find(
+                vertices, component_vertices_.interned( component_vertex_id ) );
+            if( it == vertices.end() )
+            {
+                return;
+            }
+            std::vector< bool > to_delete( vertices.size(), false );
+            to_delete[it - vertices.begin()] = true;
+            component_vertices_.remove( unique_vertex_id, to_delete );
+        }
+
         void filter_component_vertices( const uuid& component_id )
         {
+            const auto& unique_vertices =
+                component_unique_vertices( component_id );
+            const auto component =
+                component_vertices_.component_index( component_id );
             async::parallel_for(
-                async::irange( index_t{ 0 }, nb_unique_vertices() ),
-                [this, &component_id]( index_t uv_id ) {
-                    const auto& component_mesh_vertices =
-                        component_vertices_->value( uv_id );
-                    std::vector< bool > to_keep(
-                        component_mesh_vertices.size(), true );
+                async::irange( size_t{ 0 }, unique_vertices.size() ),
+                [this, component, &unique_vertices]( size_t index ) {
+                    const auto uv_id = unique_vertices[index];
+                    const auto vertices =
+                        component_vertices_.interned_vertices( uv_id );
+                    std::vector< bool > to_delete( vertices.size(), false );
                     bool update{ false };
-                    for( const auto i : Indices{ component_mesh_vertices } )
+                    for( const auto i : Indices{ vertices } )
                     {
-                        if( component_mesh_vertices[i].component_id.id
-                            == component_id )
+                        if( vertices[i].component == component )
                         {
-                            to_keep[i] = false;
+                            to_delete[i] = true;
                             update = true;
                         }
                     }
                     if( update )
                     {
-                        component_vertices_->set_value(
-                            uv_id, extract_vector_elements(
-                                       to_keep, component_mesh_vertices ) );
+                        component_vertices_.remove( uv_id, to_delete );
                     }
                 } );
         }
 
     private:
         OpenGeodeVertexSet unique_vertices_;
-        std::shared_ptr<
-            VariableAttribute< std::vector< ComponentMeshVertex > > >
-            component_vertices_;
-        absl::flat_hash_map< uuid,
-            std::shared_ptr< VariableAttribute< index_t > > >
+        ComponentMeshVerticesPool component_vertices_;
+        absl::node_hash_map< uuid, ComponentUniqueVertices >
             vertex2unique_vertex_;
+        absl::flat_hash_map< uuid, std::vector< index_t > >
+            component_unique_vertices_;
+        bool component_unique_vertices_initialized_{ false };
     };
 
     VertexIdentifier::VertexIdentifier() = default;
@@ -540,9 +1099,8 @@ namespace geode
         return impl_->is_unique_vertex_isolated( unique_vertex_id );
     }
 
-    const std::vector< ComponentMeshVertex >&
-        VertexIdentifier::component_mesh_vertices(
-            index_t unique_vertex_id ) const
+    ComponentMeshVertices VertexIdentifier::component_mesh_vertices(
+        index_t unique_vertex_id ) const
     {
         return impl_->component_mesh_vertices( unique_vertex_id );
     }
@@ -608,6 +1166,14 @@ namespace geode
             std::move( component_vertex_id ), unique_vertex_id );
     }
 
+    void VertexIdentifier::set_unique_vertices(
+        absl::Span< const ComponentMeshVertex > component_vertices,
+        absl::Span< const index_t > unique_vertex_ids,
+        BuilderKey /*key*/ )
+    {
+        impl_->set_unique_vertices( component_vertices, unique_vertex_ids );
+    }
+
     void VertexIdentifier::unset_unique_vertex(
         const ComponentMeshVertex& component_vertex_id,
         index_t unique_vertex_id,
@@ -27,11 +27,16 @@
 #include <string_view>
 #include <vector>
 
+#include <absl/strings/ascii.h>
+
 #include <geode/basic/detail/geode_output_impl.hpp>
+#include <geode/basic/filename.hpp>
 #include <geode/basic/io.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 
 #include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/io/geode/geode_brep_output.hpp>
 
 namespace geode
 {
@@ -54,6 +59,33 @@ namespace geode
         }
     }
 
+    std::vector< std::string > save_brep_incrementally(
+        const BRep& brep, std::string_view filename )
+    {
+        filename = absl::StripAsciiWhitespace( filename );
+        if( absl::AsciiStrToLower( extension_from_filename( filename ) )
+            != OpenGeodeBRepOutput::extension() )
+        {
+            return save_brep( brep, filename );
+        }
+        try
+        {
+            const Timer timer;
+            const OpenGeodeBRepOutput output{ filename };
+            auto output_filenames = output.update( brep );
+            Logger::info( "BRep updated in ", output_filenames.front(),
+                " in ", timer.duration() );
+            return output_filenames;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeModelException{ nullptr,
+                OpenGeodeException::TYPE::internal,
+                "Cannot save BRep in file: ", filename };
+        }
+    }
+
     bool is_brep_saveable( const BRep& brep, std::string_view filename )
     {
         try
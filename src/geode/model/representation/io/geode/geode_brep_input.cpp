@@ -23,10 +23,19 @@
 
 #include <geode/model/representation/io/geode/geode_brep_input.hpp>
 
+#include <vector>
+
 #include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/block_collection.hpp>
 #include <geode/model/mixin/core/corner.hpp>
@@ -38,14 +47,83 @@
 #include <geode/model/mixin/core/surface_collection.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+namespace
+{
+    template < typename Range >
+    void spawn_mesh_loads(
+        const Range& components, std::vector< async::task< void > >& tasks )
+    {
+        for( const auto& component : components )
+        {
+            tasks.push_back( async::spawn( [&component] {
+                geode_unused( component.mesh() );
+            } ) );
+        }
+    }
+
+    /*!
+     * Each task extracts a component mesh from the archive and decodes it as
+     * soon as it is extracted: extraction and decoding of different meshes
+     * overlap.
+     */
+    void load_component_meshes( const geode::BRep& brep )
+    {
+        std::vector< async::task< void > > tasks;
+        tasks.reserve( brep.nb_corners() + brep.nb_lines() + brep.nb_surfaces()
+                       + brep.nb_blocks() );
+        spawn_mesh_loads( brep.corners(), tasks );
+        spawn_mesh_loads( brep.lines(), tasks );
+        spawn_mesh_loads( brep.surfaces(), tasks );
+        spawn_mesh_loads( brep.blocks(), tasks );
+        for( auto& task : async::when_all( tasks ).get() )
+        {
+            task.get();
+        }
+    }
+
+    geode::BRep read_brep_archive(
+        std::shared_ptr< const geode::UnzipFile > zip_reader, bool lazy )
+    {
+        geode::BRep brep{ geode::BITSERY::constructor };
+        geode::detail::load_brep_files( brep, std::move( zip_reader ) );
+        if( !lazy )
+        {
+            const geode::LoggerLevelGuard level_guard{
+                geode::Logger::LEVEL::warning
+            };
+            load_component_meshes( brep );
+        }
+        return brep;
+    }
+} // namespace
+
 namespace geode
 {
     BRep OpenGeodeBRepInput::read()
     {
-        const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
-        BRep brep{ BITSERY::constructor };
-        detail::load_brep_files( brep, zip_reader.directory() );
+        return read_brep_archive(
+            std::make_shared< const UnzipFile >( filename(), uuid{}.string() ),
+            false );
+    }
+
+    BRep lazy_load_brep( std::string_view filename )
+    {
+        return read_brep_archive( std::make_shared< const UnzipFile >(
+                                      filename, uuid{}.string(), false ),
+            true );
+    }
+
+    BRep load_brep_from_buffer( std::string_view buffer )
+    {
+        const Timer timer;
+        auto brep = read_brep_archive(
+            std::make_shared< const UnzipFile >(
+                absl::MakeConstSpan(
+                    reinterpret_cast< const uint8_t* >( buffer.data() ),
+                    buffer.size() ),
+                uuid{}.string() ),
+            false );
+        Logger::info( "BRep loaded from buffer in ", timer.duration() );
         return brep;
     }
 } // namespace geode
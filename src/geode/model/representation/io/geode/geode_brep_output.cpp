@@ -29,9 +29,16 @@
 
 #include <async++.h>
 
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/detail/components_storage.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
 namespace geode
@@ -39,6 +46,8 @@ namespace geode
     void OpenGeodeBRepOutput::archive_brep_files(
         const ZipFile& zip_writer ) const
     {
+        // Native files are streamed into the archive while being saved,
+        // only files written on disk by other outputs remain to archive.
         for( const auto& file :
             std::filesystem::directory_iterator( zip_writer.directory() ) )
         {
@@ -49,8 +58,25 @@ namespace geode
     void OpenGeodeBRepOutput::save_brep_files(
         const BRep& brep, std::string_view directory ) const
     {
-        const auto level = Logger::level();
-        Logger::set_level( Logger::LEVEL::warning );
+        save_brep_files( brep, directory, {}, "" );
+    }
+
+    void OpenGeodeBRepOutput::save_brep_files( const BRep& brep,
+        std::string_view directory,
+        const absl::flat_hash_set< uuid >& saved_meshes,
+        std::string_view archive_id ) const
+    {
+        const auto mesh_filter = [&saved_meshes]( const auto& component ) {
+            return !saved_meshes.contains( component.id() );
+        };
+        if( !archive_id.empty() )
+        {
+            const auto file = open_output_file( absl::StrCat(
+                directory, "/", detail::MODEL_ARCHIVE_ID_FILE ) );
+            *file << archive_id;
+            file->close();
+        }
+        const LoggerLevelGuard level_guard{ Logger::LEVEL::warning };
         async::parallel_invoke(
             [&directory, &brep] {
                 brep.save_identifier( directory );
@@ -61,17 +87,17 @@ namespace geode
             [&directory, &brep] {
                 brep.save_unique_vertices( directory );
             },
-            [&directory, &brep] {
-                brep.save_corners( directory );
+            [&directory, &brep, &mesh_filter, &archive_id] {
+                brep.save_corners( directory, mesh_filter, archive_id );
             },
-            [&directory, &brep] {
-                brep.save_lines( directory );
+            [&directory, &brep, &mesh_filter, &archive_id] {
+                brep.save_lines( directory, mesh_filter, archive_id );
             },
-            [&directory, &brep] {
-                brep.save_surfaces( directory );
+            [&directory, &brep, &mesh_filter, &archive_id] {
+                brep.save_surfaces( directory, mesh_filter, archive_id );
             },
-            [&directory, &brep] {
-                brep.save_blocks( directory );
+            [&directory, &brep, &mesh_filter, &archive_id] {
+                brep.save_blocks( directory, mesh_filter, archive_id );
             },
             [&directory, &brep] {
                 brep.save_model_boundaries( directory );
@@ -88,15 +114,70 @@ namespace geode
             [&directory, &brep] {
                 brep.save_block_collections( directory );
             } );
-        Logger::set_level( level );
     }
 
     std::vector< std::string > OpenGeodeBRepOutput::write(
         const BRep& brep ) const
     {
         const ZipFile zip_writer{ filename(), uuid{}.string() };
-        save_brep_files( brep, zip_writer.directory() );
+        save_brep_files( brep, zip_writer.directory(), {}, uuid{}.string() );
         archive_brep_files( zip_writer );
         return { to_string( filename() ) };
     }
+
+    std::vector< std::string > OpenGeodeBRepOutput::update(
+        const BRep& brep ) const
+    {
+        const auto file = to_string( filename() );
+        if( !std::filesystem::exists( file ) )
+        {
+            return write( brep );
+        }
+        absl::flat_hash_set< uuid > saved_meshes;
+        std::vector< std::string > files_to_copy;
+        {
+            const UnzipFile archive{ file, uuid{}.string(), false };
+            const auto archive_id = detail::model_archive_id( archive );
+            const auto mesh_files = detail::archive_mesh_files( archive );
+            detail::find_saved_meshes( brep.corners(), archive_id, mesh_files,
+                saved_meshes, files_to_copy );
+            detail::find_saved_meshes( brep.lines(), archive_id, mesh_files,
+                saved_meshes, files_to_copy );
+            detail::find_saved_meshes( brep.surfaces(), archive_id, mesh_files,
+                saved_meshes, files_to_copy );
+            detail::find_saved_meshes( brep.blocks(), archive_id, mesh_files,
+                saved_meshes, files_to_copy );
+        }
+        const auto temp_file = absl::StrCat( file, ".", uuid{}.string() );
+        {
+            const ZipFile zip_writer{ temp_file, uuid{}.string() };
+            zip_writer.archive_files_from( file, files_to_copy );
+            save_brep_files( brep, zip_writer.directory(), saved_meshes,
+                uuid{}.string() );
+            archive_brep_files( zip_writer );
+        }
+        std::error_code error;
+        std::filesystem::rename( temp_file, file, error );
+        if( error )
+        {
+            std::filesystem::remove( temp_file );
+            throw OpenGeodeModelException{ nullptr,
+                OpenGeodeException::TYPE::internal,
+                "[OpenGeodeBRepOutput::update] Cannot replace ", file, ": ",
+                error.message() };
+        }
+        return { file };
+    }
+
+    std::string save_brep_to_buffer( const BRep& brep )
+    {
+        const Timer timer;
+        ZipFile zip_writer{ uuid{}.string() };
+        const OpenGeodeBRepOutput output{ "" };
+        output.save_brep_files( brep, zip_writer.directory() );
+        output.archive_brep_files( zip_writer );
+        auto buffer = zip_writer.release_buffer();
+        Logger::info( "BRep saved in buffer in ", timer.duration() );
+        return buffer;
+    }
 } // namespace geode
@@ -23,12 +23,21 @@
 
 #include <geode/model/representation/io/geode/geode_section_input.hpp>
 
+#include <memory>
+#include <vector>
+
 #include <async++.h>
 
 #include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
 #include <geode/model/mixin/core/corner.hpp>
 #include <geode/model/mixin/core/corner_collection.hpp>
 #include <geode/model/mixin/core/line.hpp>
@@ -38,14 +47,70 @@
 #include <geode/model/mixin/core/surface_collection.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+namespace
+{
+    template < typename Range >
+    void spawn_mesh_loads(
+        const Range& components, std::vector< async::task< void > >& tasks )
+    {
+        for( const auto& component : components )
+        {
+            tasks.push_back( async::spawn( [&component] {
+                geode_unused( component.mesh() );
+            } ) );
+        }
+    }
+
+    /*!
+     * Each task extracts a component mesh from the archive and decodes it as
+     * soon as it is extracted: extraction and decoding of different meshes
+     * overlap.
+     */
+    void load_component_meshes( const geode::Section& section )
+    {
+        std::vector< async::task< void > > tasks;
+        tasks.reserve(
+            section.nb_corners() + section.nb_lines() + section.nb_surfaces() );
+        spawn_mesh_loads( section.corners(), tasks );
+        spawn_mesh_loads( section.lines(), tasks );
+        spawn_mesh_loads( section.surfaces(), tasks );
+        for( auto& task : async::when_all( tasks ).get() )
+        {
+            task.get();
+        }
+    }
+
+    geode::Section read_section_archive(
+        std::shared_ptr< const geode::UnzipFile > zip_reader )
+    {
+        geode::Section section{ geode::BITSERY::constructor };
+        geode::detail::load_section_files( section, std::move( zip_reader ) );
+        const geode::LoggerLevelGuard level_guard{
+            geode::Logger::LEVEL::warning
+        };
+        load_component_meshes( section );
+        return section;
+    }
+} // namespace
+
 namespace geode
 {
     Section OpenGeodeSectionInput::read()
     {
-        const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
-        Section section{ BITSERY::constructor };
-        detail::load_section_files( section, zip_reader.directory() );
+        return read_section_archive( std::make_shared< const UnzipFile >(
+            filename(), uuid{}.string() ) );
+    }
+
+    Section load_section_from_buffer( std::string_view buffer )
+    {
+        const Timer timer;
+        auto section =
+            read_section_archive( std::make_shared< const UnzipFile >(
+                absl::MakeConstSpan(
+                    reinterpret_cast< const uint8_t* >( buffer.data() ),
+                    buffer.size() ),
+                uuid{}.string() ) );
+        Logger::info( "Section loaded from buffer in ", timer.duration() );
         return section;
     }
 } // namespace geode
@@ -29,9 +29,15 @@
 
 #include <async++.h>
 
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/detail/components_storage.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/section.hpp>
 
 namespace geode
@@ -39,8 +45,25 @@ namespace geode
     void OpenGeodeSectionOutput::save_section_files(
         const Section& section, std::string_view directory ) const
     {
-        const auto level = Logger::level();
-        Logger::set_level( Logger::LEVEL::warning );
+        save_section_files( section, directory, {}, "" );
+    }
+
+    void OpenGeodeSectionOutput::save_section_files( const Section& section,
+        std::string_view directory,
+        const absl::flat_hash_set< uuid >& saved_meshes,
+        std::string_view archive_id ) const
+    {
+        const auto mesh_filter = [&saved_meshes]( const auto& component ) {
+            return !saved_meshes.contains( component.id() );
+        };
+        if( !archive_id.empty() )
+        {
+            const auto file = open_output_file( absl::StrCat(
+                directory, "/", detail::MODEL_ARCHIVE_ID_FILE ) );
+            *file << archive_id;
+            file->close();
+        }
+        const LoggerLevelGuard level_guard{ Logger::LEVEL::warning };
         async::parallel_invoke(
             [&directory, &section] {
                 section.save_identifier( directory );
@@ -51,10 +74,10 @@ namespace geode
             [&directory, &section] {
                 section.save_unique_vertices( directory );
             },
-            [&directory, &section] {
-                section.save_corners( directory );
-                section.save_lines( directory );
-                section.save_surfaces( directory );
+            [&directory, &section, &mesh_filter, &archive_id] {
+                section.save_corners( directory, mesh_filter, archive_id );
+                section.save_lines( directory, mesh_filter, archive_id );
+                section.save_surfaces( directory, mesh_filter, archive_id );
             },
             [&directory, &section] {
                 section.save_model_boundaries( directory );
@@ -62,12 +85,13 @@ namespace geode
                 section.save_line_collections( directory );
                 section.save_surface_collections( directory );
             } );
-        Logger::set_level( level );
     }
 
     void OpenGeodeSectionOutput::archive_section_files(
         const ZipFile& zip_writer ) const
     {
+        // Native files are streamed into the archive while being saved,
+        // only files written on disk by other outputs remain to archive.
         for( const auto& file :
             std::filesystem::directory_iterator( zip_writer.directory() ) )
         {
@@ -79,8 +103,63 @@ namespace geode
         const Section& section ) const
     {
         const ZipFile zip_writer{ filename(), uuid{}.string() };
-        save_section_files( section, zip_writer.directory() );
+        save_section_files(
+            section, zip_writer.directory(), {}, uuid{}.string() );
         archive_section_files( zip_writer );
         return { to_string( filename() ) };
     }
+
+    std::vector< std::string > OpenGeodeSectionOutput::update(
+        const Section& section ) const
+    {
+        const auto file = to_string( filename() );
+        if( !std::filesystem::exists( file ) )
+        {
+            return write( section );
+        }
+        absl::flat_hash_set< uuid > saved_meshes;
+        std::vector< std::string > files_to_copy;
+        {
+            const UnzipFile archive{ file, uuid{}.string(), false };
+            const auto archive_id = detail::model_archive_id( archive );
+            const auto mesh_files = detail::archive_mesh_files( archive );
+            detail::find_saved_meshes( section.corners(), archive_id,
+                mesh_files, saved_meshes, files_to_copy );
+            detail::find_saved_meshes( section.lines(), archive_id, mesh_files,
+                saved_meshes, files_to_copy );
+            detail::find_saved_meshes( section.surfaces(), archive_id,
+                mesh_files, saved_meshes, files_to_copy );
+        }
+        const auto temp_file = absl::StrCat( file, ".", uuid{}.string() );
+        {
+            const ZipFile zip_writer{ temp_file, uuid{}.string() };
+            zip_writer.archive_files_from( file, files_to_copy );
+            save_section_files( section, zip_writer.directory(), saved_meshes,
+                uuid{}.string() );
+            archive_section_files( zip_writer );
+        }
+        std::error_code error;
+        std::filesystem::rename( temp_file, file, error );
+        if( error )
+        {
+            std::filesystem::remove( temp_file );
+            throw OpenGeodeModelException{ nullptr,
+                OpenGeodeException::TYPE::internal,
+                "[OpenGeodeSectionOutput::update] Cannot replace ", file, ": ",
+                error.message() };
+        }
+        return { file };
+    }
+
+    std::string save_section_to_buffer( const Section& section )
+    {
+        const Timer timer;
+        ZipFile zip_writer{ uuid{}.string() };
+        const OpenGeodeSectionOutput output{ "" };
+        output.save_section_files( section, zip_writer.directory() );
+        output.archive_section_files( zip_writer );
+        auto buffer = zip_writer.release_buffer();
+        Logger::info( "Section saved in buffer in ", timer.duration() );
+        return buffer;
+    }
 } // namespace geode
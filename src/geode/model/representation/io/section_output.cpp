@@ -27,11 +27,16 @@
 #include <string_view>
 #include <vector>
 
+#include <absl/strings/ascii.h>
+
 #include <geode/basic/detail/geode_output_impl.hpp>
+#include <geode/basic/filename.hpp>
 #include <geode/basic/io.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 
 #include <geode/model/representation/core/section.hpp>
+#include <geode/model/representation/io/geode/geode_section_output.hpp>
 
 namespace geode
 {
@@ -54,6 +59,33 @@ namespace geode
         }
     }
 
+    std::vector< std::string > save_section_incrementally(
+        const Section& section, std::string_view filename )
+    {
+        filename = absl::StripAsciiWhitespace( filename );
+        if( absl::AsciiStrToLower( extension_from_filename( filename ) )
+            != OpenGeodeSectionOutput::extension() )
+        {
+            return save_section( section, filename );
+        }
+        try
+        {
+            const Timer timer;
+            const OpenGeodeSectionOutput output{ filename };
+            auto output_filenames = output.update( section );
+            Logger::info( "Section updated in ", output_filenames.front(),
+                " in ", timer.duration() );
+            return output_filenames;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeModelException{ nullptr,
+                OpenGeodeException::TYPE::internal,
+                "Cannot save Section in file: ", filename };
+        }
+    }
+
     bool is_section_saveable(
         const Section& section, std::string_view filename )
     {
@@ -21,14 +21,18 @@
  *
  */
 
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
 #include <bitsery/brief_syntax/array.h>
 
 #include <geode/basic/attribute.hpp>
+#include <geode/basic/attribute_handle.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/bitsery_attribute.hpp>
+#include <geode/basic/detail/bitsery_raw_values.hpp>
 #include <geode/basic/logger.hpp>
 
 #include <geode/tests/common.hpp>
@@ -227,6 +231,26 @@ void test_int_variable_attribute(
     variable_attribute->set_value( 3, 5 );
     geode::OpenGeodeBasicException::test( attribute->value( 3 ) == 5,
         "Int variable value 3 should be equal to 5" );
+
+    const auto values = variable_attribute->values();
+    geode::OpenGeodeBasicException::test(
+        values.size() == manager.nb_elements() && values[3] == 5
+            && values[6] == 12,
+        "Wrong int variable values view" );
+    const std::vector< int > old_values{ values.begin(), values.end() };
+    std::vector< int > new_values( manager.nb_elements() );
+    for( const auto e : geode::Indices{ new_values } )
+    {
+        new_values[e] = static_cast< int >( 2 * e );
+    }
+    variable_attribute->set_values( new_values );
+    for( auto& value : variable_attribute->modifiable_values() )
+    {
+        value += 1;
+    }
+    geode::OpenGeodeBasicException::test( attribute->value( 4 ) == 9,
+        "Int variable value 4 should be equal to 9" );
+    variable_attribute->set_values( old_values );
 }
 
 void test_foo_sparse_attribute(
@@ -825,6 +849,200 @@ void test_permutation( geode::AttributeManager& manager,
         double_attribute->value( 7 ) );
 }
 
+void test_bulk_attribute_values()
+{
+    geode::AttributeManager manager;
+    geode::AttributeProperties attribute_properties;
+    attribute_properties.assignable = true;
+    attribute_properties.interpolable = true;
+    geode::AttributeValues< double > attribute_values;
+    attribute_values.default_value = 0;
+    attribute_values.no_value = -1;
+    const auto double_attribute =
+        manager.find_attribute< geode::VariableAttribute, double >(
+            manager.create_attribute< geode::VariableAttribute, double >(
+                "double", attribute_values, attribute_properties ) );
+    const auto sparse_attribute =
+        manager.find_attribute< geode::SparseAttribute, double >(
+            manager.create_attribute< geode::SparseAttribute, double >(
+                "sparse", attribute_values, attribute_properties ) );
+    const geode::index_t nb_elements{ 10000 };
+    manager.resize( 2 * nb_elements );
+    std::vector< geode::index_t > from_elements( nb_elements );
+    std::vector< geode::index_t > to_elements( nb_elements );
+    for( const auto e : geode::Range{ nb_elements } )
+    {
+        double_attribute->set_value( e, e );
+        sparse_attribute->set_value( e, 2. * e );
+        from_elements[e] = e;
+        to_elements[e] = nb_elements + e;
+    }
+    manager.assign_attribute_values( from_elements, to_elements );
+    for( const auto e : geode::Range{ nb_elements } )
+    {
+        geode::OpenGeodeBasicException::test(
+            double_attribute->value( nb_elements + e ) == e,
+            "Wrong bulk assigned variable value" );
+        geode::OpenGeodeBasicException::test(
+            sparse_attribute->value( nb_elements + e ) == 2. * e,
+            "Wrong bulk assigned sparse value" );
+    }
+    std::vector< geode::AttributeLinearInterpolation > interpolations;
+    interpolations.reserve( nb_elements - 1 );
+    for( const auto e : geode::Range{ nb_elements - 1 } )
+    {
+        interpolations.emplace_back( absl::Span< const geode::index_t >{
+                                         from_elements.data() + e, 2 },
+            absl::Span< const double >{ { 0.5, 0.5 } } );
+    }
+    manager.interpolate_attribute_values( interpolations,
+        absl::MakeConstSpan( to_elements ).subspan( 0, nb_elements - 1 ) );
+    for( const auto e : geode::Range{ nb_elements - 1 } )
+    {
+        geode::OpenGeodeBasicException::test(
+            double_attribute->value( nb_elements + e ) == e + 0.5,
+            "Wrong bulk interpolated variable value" );
+        geode::OpenGeodeBasicException::test(
+            sparse_attribute->value( nb_elements + e ) == 2. * e + 1,
+            "Wrong bulk interpolated sparse value" );
+    }
+    try
+    {
+        manager.assign_attribute_values( from_elements,
+            absl::MakeConstSpan( to_elements ).subspan( 1 ) );
+        exit( 1 );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        geode::Logger::info( "Bulk assign size mismatch correctly detected" );
+    }
+    try
+    {
+        const std::array< geode::index_t, 1 > out_of_range{ 2 * nb_elements };
+        manager.assign_attribute_values(
+            absl::MakeConstSpan( from_elements ).subspan( 0, 1 ),
+            out_of_range );
+        exit( 1 );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        geode::Logger::info( "Bulk assign out of range correctly detected" );
+    }
+    std::vector< bool > to_delete( 2 * nb_elements, false );
+    for( const auto e : geode::Range{ nb_elements } )
+    {
+        to_delete[e] = true;
+    }
+    manager.delete_elements( to_delete );
+    geode::OpenGeodeBasicException::test(
+        manager.nb_elements() == nb_elements,
+        "Wrong number of elements after bulk deletion" );
+    geode::OpenGeodeBasicException::test(
+        double_attribute->value( 0 ) == 0.5
+            && sparse_attribute->value( nb_elements - 1 )
+                   == 2. * ( nb_elements - 1 ),
+        "Wrong values after bulk deletion" );
+}
+
+void test_attribute_handle()
+{
+    geode::AttributeManager manager;
+    manager.resize( 10 );
+    geode::AttributeValues< double > attribute_values;
+    attribute_values.default_value = 1;
+    attribute_values.no_value = -1;
+    const auto attribute_id =
+        manager.create_attribute< geode::VariableAttribute, double >(
+            "handle", attribute_values, geode::AttributeProperties{} );
+    geode::AttributeHandle< geode::VariableAttribute, double > handle{
+        manager, attribute_id
+    };
+    const auto& const_manager = manager;
+    const geode::ReadOnlyAttributeHandle< double > read_only_handle{
+        const_manager, attribute_id
+    };
+    handle->set_value( 3, 42 );
+    geode::OpenGeodeBasicException::test(
+        read_only_handle->value( 3 ) == 42 && read_only_handle->value( 2 ) == 1,
+        "Wrong value read through attribute handle" );
+    geode::OpenGeodeBasicException::test( !read_only_handle.is_outdated(),
+        "Attribute handle should not be outdated" );
+    const auto other_id =
+        manager.create_attribute< geode::VariableAttribute, double >(
+            "other", attribute_values, geode::AttributeProperties{} );
+    geode::OpenGeodeBasicException::test( handle.is_outdated(),
+        "Attribute handle should be outdated after attribute creation" );
+    handle.refresh();
+    geode::OpenGeodeBasicException::test(
+        !handle.is_outdated() && handle->value( 3 ) == 42,
+        "Wrong refreshed attribute handle" );
+    manager.delete_attribute( other_id );
+    geode::OpenGeodeBasicException::test( handle.is_outdated(),
+        "Attribute handle should be outdated after attribute deletion" );
+}
+
+template < typename T >
+struct RawVector
+{
+    template < typename Archive >
+    void serialize( Archive& serializer )
+    {
+        serializer.ext( values, geode::detail::RawValues{} );
+    }
+    std::vector< T > values;
+};
+
+template < typename T >
+bool deserialize_raw_vector(
+    const std::string& serialized, RawVector< T >& reloaded )
+{
+    std::istringstream stream{ serialized };
+    geode::TContext context{};
+    geode::Deserializer unarchive{ context, stream };
+    unarchive.object( reloaded );
+    const auto& adapter = unarchive.adapter();
+    return adapter.error() == bitsery::ReaderError::NoError
+           && adapter.isCompletedSuccessfully();
+}
+
+void test_raw_values_serialization()
+{
+    RawVector< std::array< double, 3 > > points;
+    points.values.resize( 100000 );
+    for( const auto i : geode::Indices{ points.values } )
+    {
+        points.values[i] = { i * 0.5, i * 1.5, -1. * i };
+    }
+    std::ostringstream stream;
+    geode::TContext context{};
+    geode::Serializer archive{ context, stream };
+    archive.object( points );
+    archive.adapter().flush();
+    const auto serialized = stream.str();
+
+    RawVector< std::array< double, 3 > > reloaded;
+    geode::OpenGeodeBasicException::test(
+        deserialize_raw_vector( serialized, reloaded ),
+        "Error while reading raw values" );
+    geode::OpenGeodeBasicException::test(
+        reloaded.values == points.values, "Wrong reloaded raw values" );
+
+    auto corrupted = serialized;
+    const auto huge_size = std::uint64_t{ 1 } << 60;
+    std::memcpy( corrupted.data(), &huge_size, sizeof( huge_size ) );
+    RawVector< std::array< double, 3 > > corrupted_reloaded;
+    geode::OpenGeodeBasicException::test(
+        !deserialize_raw_vector( corrupted, corrupted_reloaded )
+            && corrupted_reloaded.values.empty(),
+        "Corrupted raw values size should be detected" );
+
+    const auto truncated = serialized.substr( 0, serialized.size() / 2 );
+    RawVector< std::array< double, 3 > > truncated_reloaded;
+    geode::OpenGeodeBasicException::test(
+        !deserialize_raw_vector( truncated, truncated_reloaded ),
+        "Truncated raw values should be detected" );
+}
+
 void test()
 {
     geode::AttributeManager manager;
@@ -857,6 +1075,7 @@ void test()
         bool_variable_attribute_id, foo_variable_attribute_id,
         foo_constant_attribute_id, foo_sparse_attribute_id };
     test_serialize_manager( manager, attribute_to_check );
+    test_raw_values_serialization();
     test_copy_manager( manager, bool_variable_attribute_id );
     test_import_manager( manager, bool_variable_attribute_id,
         array_double_attribute_id, double_sparse_attribute_id );
@@ -873,6 +1092,8 @@ void test()
     test_double_array_attribute( manager );
     manager.clear();
     test_number_of_attributes( manager, 0 );
+    test_bulk_attribute_values();
+    test_attribute_handle();
 }
 
 OPENGEODE_TEST( "attribute" )
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <sstream>
+#include <string>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/compression.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/tests/common.hpp>
+
+std::string create_buffer()
+{
+    std::string buffer;
+    for( const auto value : geode::Range{ 1000000 } )
+    {
+        const auto index = value / 3;
+        buffer.append(
+            reinterpret_cast< const char* >( &index ), sizeof( index ) );
+    }
+    absl::StrAppend( &buffer, "unaligned tail" );
+    return buffer;
+}
+
+void test_round_trip( const std::string& buffer )
+{
+    const auto compressed = geode::compress_buffer( buffer );
+    geode::OpenGeodeBasicException::test(
+        geode::is_compressed_buffer( compressed ),
+        "Compressed buffer should be detected" );
+    geode::OpenGeodeBasicException::test(
+        geode::decompress_buffer( compressed ) == buffer,
+        "Wrong decompressed buffer" );
+    std::istringstream stream{ compressed };
+    const auto decompressed = geode::read_compressed_stream( stream );
+    geode::OpenGeodeBasicException::test(
+        decompressed && decompressed.value() == buffer,
+        "Wrong decompressed stream" );
+}
+
+void test_compression()
+{
+    const auto buffer = create_buffer();
+    test_round_trip( buffer );
+    test_round_trip( "" );
+    const auto compressed = geode::compress_buffer( buffer );
+    geode::OpenGeodeBasicException::test(
+        compressed.size() < buffer.size() / 10,
+        "Buffer should be highly compressed" );
+    geode::OpenGeodeBasicException::test(
+        !geode::is_compressed_buffer( buffer ),
+        "Raw buffer should not be detected as compressed" );
+}
+
+void test_raw_stream()
+{
+    const std::string content{ "raw content" };
+    std::istringstream stream{ content };
+    geode::OpenGeodeBasicException::test(
+        !geode::read_compressed_stream( stream ),
+        "Raw stream should not be decompressed" );
+    std::string read;
+    std::getline( stream, read );
+    geode::OpenGeodeBasicException::test(
+        read == content, "Raw stream should be rewound" );
+}
+
+void test()
+{
+    test_compression();
+    test_raw_stream();
+}
+
+OPENGEODE_TEST( "compression" )
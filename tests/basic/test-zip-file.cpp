@@ -21,15 +21,161 @@
  *
  */
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include <async++.h>
+
 #include <absl/strings/str_cat.h>
 
 #include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
 #include <geode/basic/zip_file.hpp>
 
 #include <geode/tests/common.hpp>
 
+std::string file_content( geode::index_t id )
+{
+    return absl::StrCat( "content of file ", id );
+}
+
+void test_streamed_archive()
+{
+    constexpr geode::index_t NB_FILES{ 8 };
+    const std::string zip_filename{ "streamed.zip" };
+    {
+        const geode::ZipFile zip_writer{ zip_filename, "streamed_temp" };
+        async::parallel_for( async::irange( geode::index_t{ 0 }, NB_FILES ),
+            [&zip_writer]( geode::index_t f ) {
+                const auto file = geode::open_output_file(
+                    absl::StrCat( zip_writer.directory(), "/file", f ) );
+                *file << file_content( f );
+                file->close();
+            } );
+        geode::OpenGeodeBasicException::test(
+            std::filesystem::is_empty( zip_writer.directory() ),
+            "Streamed files should not be written on disk" );
+        const auto disk_file =
+            absl::StrCat( zip_writer.directory(), "/file", NB_FILES );
+        std::ofstream{ disk_file } << file_content( NB_FILES );
+        zip_writer.archive_file( disk_file );
+    }
+    geode::OpenGeodeBasicException::test(
+        geode::is_zip_file( zip_filename ), "Streamed zip file is not valid" );
+    const geode::UnzipFile zip_reader{ zip_filename, "streamed_unzip" };
+    zip_reader.extract_all();
+    for( const auto f : geode::Range{ NB_FILES + 1 } )
+    {
+        std::ifstream file{ absl::StrCat(
+            zip_reader.directory(), "/file", f ) };
+        const std::string content{ std::istreambuf_iterator< char >{ file },
+            std::istreambuf_iterator< char >{} };
+        geode::OpenGeodeBasicException::test( content == file_content( f ),
+            "Wrong content for archived file ", f );
+    }
+}
+
+void test_concurrent_extraction( bool load_in_memory )
+{
+    constexpr geode::index_t NB_FILES{ 100 };
+    const std::string zip_filename{ "concurrent.zip" };
+    {
+        const geode::ZipFile zip_writer{ zip_filename, "concurrent_temp" };
+        for( const auto f : geode::Range{ NB_FILES } )
+        {
+            zip_writer.archive_buffer(
+                absl::StrCat( "file", f ), file_content( f ) );
+        }
+    }
+    const geode::UnzipFile zip_reader{ zip_filename, "concurrent_unzip",
+        load_in_memory };
+    geode::OpenGeodeBasicException::test(
+        zip_reader.file_names().size() == NB_FILES,
+        "Wrong number of files in archive" );
+    async::parallel_for( async::irange( geode::index_t{ 0 }, NB_FILES ),
+        [&zip_reader]( geode::index_t f ) {
+            std::ifstream file{ zip_reader.extract_file(
+                absl::StrCat( "file", f ) ) };
+            const std::string content{ std::istreambuf_iterator< char >{
+                                           file },
+                std::istreambuf_iterator< char >{} };
+            geode::OpenGeodeBasicException::test( content == file_content( f ),
+                "Wrong content for concurrently extracted file ", f );
+        } );
+}
+
+void test_memory_archive()
+{
+    constexpr geode::index_t NB_FILES{ 8 };
+    std::string buffer;
+    {
+        geode::ZipFile zip_writer{ "memory_temp" };
+        async::parallel_for( async::irange( geode::index_t{ 0 }, NB_FILES ),
+            [&zip_writer]( geode::index_t f ) {
+                const auto file = geode::open_output_file(
+                    absl::StrCat( zip_writer.directory(), "/file", f ) );
+                *file << file_content( f );
+                file->close();
+            } );
+        buffer = zip_writer.release_buffer();
+    }
+    const geode::UnzipFile zip_reader{
+        absl::MakeConstSpan(
+            reinterpret_cast< const uint8_t* >( buffer.data() ),
+            buffer.size() ),
+        "memory_unzip"
+    };
+    zip_reader.extract_all();
+    geode::OpenGeodeBasicException::test(
+        !std::filesystem::exists( zip_reader.directory() )
+            || std::filesystem::is_empty( zip_reader.directory() ),
+        "Memory archive should not be extracted on disk" );
+    for( const auto f : geode::Range{ NB_FILES } )
+    {
+        const auto file_name = absl::StrCat( "file", f );
+        geode::OpenGeodeBasicException::test(
+            zip_reader.read_file( file_name ) == file_content( f ),
+            "Wrong content for memory archived file ", f );
+        const auto file = geode::open_input_file(
+            absl::StrCat( zip_reader.directory(), "/", file_name ) );
+        const std::string content{ std::istreambuf_iterator< char >{ *file },
+            std::istreambuf_iterator< char >{} };
+        geode::OpenGeodeBasicException::test( content == file_content( f ),
+            "Wrong content for memory input file ", f );
+    }
+    geode::OpenGeodeBasicException::test(
+        !zip_reader.has_file( "unknown" ), "Unknown file should not be found" );
+    const auto missing = geode::open_input_file(
+        absl::StrCat( zip_reader.directory(), "/unknown" ) );
+    geode::OpenGeodeBasicException::test(
+        !*missing, "Missing file stream should be invalid" );
+}
+
+void test_output_file_error()
+{
+    const auto file =
+        geode::open_output_file( "missing_directory/output_file" );
+    *file << file_content( 0 );
+    try
+    {
+        file->close();
+        exit( 1 );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        geode::Logger::info( "Output file error correctly detected" );
+    }
+}
+
 void test()
 {
+    test_streamed_archive();
+    test_concurrent_extraction( true );
+    test_concurrent_extraction( false );
+    test_memory_archive();
+    test_output_file_error();
     const auto is_not_a_zip = geode::is_zip_file(
         absl::StrCat( geode::DATA_PATH, "triange.og_tsf3d" ) );
     geode::OpenGeodeBasicException::test(
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/tests/common.hpp>
+
+/*
+ * Measures AABBTree build time against the number of boxes.
+ * The number of worker threads is controlled by the LIBASYNC_NUM_THREADS
+ * environment variable (defaults to the number of hardware threads).
+ * Larger sizes are only run when compiled with USE_BENCHMARK.
+ */
+
+template < geode::index_t dimension >
+std::vector< geode::BoundingBox< dimension > > create_boxes(
+    geode::index_t nb_boxes )
+{
+    const auto nb_boxes_per_axis = static_cast< geode::index_t >(
+        std::ceil( std::pow( nb_boxes, 1. / dimension ) ) );
+    std::vector< geode::BoundingBox< dimension > > boxes( nb_boxes );
+    for( const auto b : geode::Range{ nb_boxes } )
+    {
+        geode::Point< dimension > point;
+        auto index = b;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            point.set_value( d, index % nb_boxes_per_axis );
+            index /= nb_boxes_per_axis;
+        }
+        geode::Point< dimension > size;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            size.set_value( d, 0.4 );
+        }
+        boxes[b].add_point( point - size );
+        boxes[b].add_point( point + size );
+    }
+    return boxes;
+}
+
+template < geode::index_t dimension >
+void benchmark_build( geode::index_t nb_boxes )
+{
+    const auto boxes = create_boxes< dimension >( nb_boxes );
+    const geode::Timer timer;
+    const geode::AABBTree< dimension > aabb{ boxes };
+    geode::Logger::info( "AABB ", dimension, "D - ", nb_boxes,
+        " boxes built in ", timer.duration() );
+    geode::OpenGeodeGeometryException::test( aabb.nb_bboxes() == nb_boxes,
+        "[Benchmark] Wrong number of boxes in the tree" );
+}
+
+template < geode::index_t dimension >
+void benchmark()
+{
+    std::vector< geode::index_t > sizes{ 10000, 100000, 1000000 };
+#ifdef OPENGEODE_BENCHMARK
+    sizes.push_back( 10000000 );
+    sizes.push_back( 50000000 );
+#endif
+    for( const auto size : sizes )
+    {
+        benchmark_build< dimension >( size );
+    }
+}
+
+void test()
+{
+    const auto* nb_threads = std::getenv( "LIBASYNC_NUM_THREADS" );
+    geode::Logger::info( "Number of threads: ",
+        nb_threads ? nb_threads
+                   : std::to_string( std::thread::hardware_concurrency() ) );
+    benchmark< 2 >();
+    benchmark< 3 >();
+}
+
+OPENGEODE_TEST( "benchmark-aabb-build" )
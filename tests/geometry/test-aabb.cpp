@@ -24,6 +24,7 @@
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/distance.hpp>
 #include <geode/geometry/point.hpp>
 #include <geode/geometry/vector.hpp>
@@ -159,6 +160,20 @@ void test_nearest_neighbor_search()
                 "Containing box AABB - Wrong number of boxes" );
             geode::OpenGeodeGeometryException::test(
                 boxes[0] == box_id, "Containing box AABB - Wrong box index" );
+
+            const auto bounded_search =
+                aabb.closest_element_box( query, disteval, distance / 2 );
+            geode::OpenGeodeGeometryException::test(
+                std::get< 0 >( bounded_search ) == box_id,
+                " Nearest box to point AABB - Wrong nearest box index with "
+                "lower stop distance" );
+            const auto stop_distance = 2. * nb_boxes;
+            const auto stopped_search =
+                aabb.closest_element_box( query, disteval, stop_distance );
+            geode::OpenGeodeGeometryException::test(
+                std::get< 1 >( stopped_search ) <= stop_distance,
+                " Nearest box to point AABB - Wrong distance with greater "
+                "stop distance" );
         }
     }
 }
@@ -471,6 +486,162 @@ void test_other_intersections()
     }
 }
 
+template < geode::index_t dimension >
+void test_batch_queries()
+{
+    geode::Logger::info( "TEST", " Batch queries AABB ", dimension, "D " );
+    const geode::index_t nb_boxes{ 10 };
+    const double box_size{ 0.25 };
+    const auto box_vector =
+        create_box_vector< dimension >( nb_boxes, box_size );
+    const geode::AABBTree< dimension > aabb{ box_vector };
+
+    std::vector< geode::Point< dimension > > queries;
+    for( const auto i : geode::Range{ nb_boxes } )
+    {
+        for( const auto j : geode::Range{ nb_boxes } )
+        {
+            geode::Point< dimension > query;
+            query.set_value( 0, i );
+            query.set_value( 1, j );
+            queries.push_back( query );
+        }
+    }
+    const BoxAABBEvalDistance< dimension > disteval{ box_vector };
+    const auto closest_boxes = aabb.closest_element_boxes( queries, disteval );
+    const auto containing_boxes = aabb.containing_boxes( queries );
+    for( const auto q : geode::Indices{ queries } )
+    {
+        geode::OpenGeodeGeometryException::test(
+            std::get< 0 >( closest_boxes[q] ) == q,
+            "Batch queries AABB - Wrong nearest box index" );
+        geode::OpenGeodeGeometryException::test(
+            std::get< 1 >( closest_boxes[q] ) == 0,
+            "Batch queries AABB - Wrong distance to nearest box center" );
+        const auto boxes = containing_boxes.query_boxes( q );
+        geode::OpenGeodeGeometryException::test(
+            boxes.size() == 1 && boxes[0] == q,
+            "Batch queries AABB - Wrong containing boxes" );
+    }
+
+    geode::Vector< dimension > ray_direction;
+    ray_direction.set_value( 1, 1.0 );
+    std::vector< geode::Point< dimension > > ray_origins( nb_boxes );
+    std::vector< geode::Ray< dimension > > rays;
+    for( const auto i : geode::Range{ nb_boxes } )
+    {
+        ray_origins[i].set_value( 0, i );
+        ray_origins[i].set_value( 1, i );
+        rays.emplace_back( ray_direction, ray_origins[i] );
+    }
+    std::mutex mutex;
+    std::vector< absl::flat_hash_set< geode::index_t > > intersections(
+        nb_boxes );
+    auto eval_intersection = [&mutex, &intersections](
+                                 geode::index_t ray_id, geode::index_t box ) {
+        std::lock_guard< std::mutex > lock( mutex );
+        intersections[ray_id].emplace( box );
+        return false;
+    };
+    aabb.compute_ray_element_bbox_intersections( rays, eval_intersection );
+    for( const auto i : geode::Range{ nb_boxes } )
+    {
+        absl::flat_hash_set< geode::index_t > expected_set;
+        for( const auto c : geode::Range{ nb_boxes - i } )
+        {
+            expected_set.emplace( global_box_index( i, c + i, nb_boxes ) );
+        }
+        geode::OpenGeodeGeometryException::test(
+            intersections[i] == expected_set,
+            "Batch queries AABB - Wrong set of boxes intersected by ray ", i );
+    }
+}
+
+template < geode::index_t dimension >
+void test_wide_build()
+{
+    geode::Logger::info( "TEST", " Build wide AABB ", dimension, "D" );
+    const geode::AABBTreeWide< dimension > empty_tree;
+    geode::OpenGeodeGeometryException::test( empty_tree.nb_bboxes() == 0,
+        "Build wide AABB - Wrong number of boxes in empty tree" );
+    for( const geode::index_t nb_boxes : { 1, 3, 7, 70 } )
+    {
+        const auto box_vector = create_box_vector< dimension >( nb_boxes, 0.4 );
+        const geode::AABBTreeWide< dimension > aabb{ box_vector };
+        geode::OpenGeodeGeometryException::test(
+            aabb.nb_bboxes() == box_vector.size(),
+            "Build wide AABB - Wrong number of boxes in the tree" );
+        geode::Point< dimension > min;
+        geode::Point< dimension > max;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            min.set_value( d, -0.4 );
+            max.set_value( d, d < 2 ? nb_boxes - 0.6 : 0.4 );
+        }
+        geode::OpenGeodeGeometryException::test(
+            aabb.bounding_box().min().inexact_equal( min )
+                && aabb.bounding_box().max().inexact_equal( max ),
+            "Build wide AABB - Wrong tree bounding box" );
+    }
+}
+
+template < geode::index_t dimension >
+void test_wide_queries()
+{
+    geode::Logger::info( "TEST", " Queries wide AABB ", dimension, "D" );
+    const geode::index_t nb_boxes{ 30 };
+    const auto box_vector = create_box_vector< dimension >( nb_boxes, 0.75 );
+    const geode::AABBTree< dimension > aabb{ box_vector };
+    const geode::AABBTreeWide< dimension > wide{ box_vector };
+    const BoxAABBEvalDistance< dimension > disteval{ box_vector };
+    for( const auto i : geode::Range{ 2 * nb_boxes } )
+    {
+        geode::Point< dimension > query;
+        query.set_value( 0, i * 0.37 - 1 );
+        query.set_value( 1, i * 0.53 - 2 );
+        const auto [box, box_distance] =
+            aabb.closest_element_box( query, disteval );
+        const auto [wide_box, wide_distance] =
+            wide.closest_element_box( query, disteval );
+        geode::OpenGeodeGeometryException::test(
+            std::fabs( box_distance - wide_distance ) < geode::GLOBAL_EPSILON,
+            "Queries wide AABB - Wrong closest element distance" );
+        const auto boxes = aabb.containing_boxes( query );
+        const auto wide_boxes = wide.containing_boxes( query );
+        geode::OpenGeodeGeometryException::test(
+            absl::flat_hash_set< geode::index_t >( boxes.begin(), boxes.end() )
+                == absl::flat_hash_set< geode::index_t >(
+                    wide_boxes.begin(), wide_boxes.end() ),
+            "Queries wide AABB - Wrong containing boxes" );
+
+        geode::Vector< dimension > direction;
+        direction.set_value( 0, 1 );
+        direction.set_value( 1, 0.1 * i );
+        const geode::Ray< dimension > ray{ direction, query };
+        BoxAABBIntersection< dimension > ray_action{ box_vector };
+        aabb.compute_ray_element_bbox_intersections( ray, ray_action );
+        BoxAABBIntersection< dimension > wide_ray_action{ box_vector };
+        wide.compute_ray_element_bbox_intersections( ray, wide_ray_action );
+        geode::OpenGeodeGeometryException::test(
+            ray_action.box_intersections_
+                == wide_ray_action.box_intersections_,
+            "Queries wide AABB - Wrong ray intersections" );
+
+        geode::BoundingBox< dimension > query_box;
+        query_box.add_point( query );
+        query_box.add_point( query + direction );
+        BoxAABBIntersection< dimension > box_action{ box_vector };
+        aabb.compute_bbox_element_bbox_intersections( query_box, box_action );
+        BoxAABBIntersection< dimension > wide_box_action{ box_vector };
+        wide.compute_bbox_element_bbox_intersections(
+            query_box, wide_box_action );
+        geode::OpenGeodeGeometryException::test(
+            box_action.box_intersections_
+                == wide_box_action.box_intersections_,
+            "Queries wide AABB - Wrong box intersections" );
+    }
+}
+
 template < geode::index_t dimension >
 void do_test()
 {
@@ -480,6 +651,9 @@ void do_test()
     test_intersections_with_ray_trace< dimension >();
     test_self_intersections< dimension >();
     test_other_intersections< dimension >();
+    test_batch_queries< dimension >();
+    test_wide_build< dimension >();
+    test_wide_queries< dimension >();
 }
 
 void test()
@@ -21,6 +21,8 @@
  *
  */
 
+#include <absl/algorithm/container.h>
+
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/distance.hpp>
@@ -152,10 +154,115 @@ void second_test()
         "[Test 2] Should be 2 unique points" );
 }
 
+void chain_test()
+{
+    std::vector< geode::Point2D > points;
+    for( const auto p : geode::Range{ 10 } )
+    {
+        points.emplace_back( geode::Point2D{ { 0.6 * p, 0 } } );
+    }
+    const geode::NNSearch2D colocator{ points };
+    const auto colocated_info = colocator.colocated_index_mapping( 1 );
+    geode::OpenGeodeGeometryException::test(
+        colocated_info.nb_unique_points() == 5,
+        "[Test 3] Should be 5 unique points" );
+    for( const auto p : geode::Indices{ points } )
+    {
+        geode::OpenGeodeGeometryException::test(
+            colocated_info.colocated_input_points[p] == p - p % 2,
+            "[Test 3] Points should be mapped to the first point claiming "
+            "them" );
+        geode::OpenGeodeGeometryException::test(
+            colocated_info.colocated_mapping[p] == p / 2,
+            "[Test 3] Wrong value of colocated_mapping" );
+    }
+}
+
+void check_radius_batch( const geode::NNSearch3D& search,
+    absl::Span< const geode::Point3D > queries,
+    double radius,
+    geode::NNSearch3D::NeighborsBatch& results )
+{
+    search.radius_neighbors( queries, radius, results );
+    geode::OpenGeodeGeometryException::test(
+        results.nb_queries() == queries.size(),
+        "[Test Batch] Wrong number of radius queries" );
+    for( const auto q : geode::Indices{ queries } )
+    {
+        const auto neighbors = results.query_neighbors( q );
+        const auto expected = search.radius_neighbors( queries[q], radius );
+        geode::OpenGeodeGeometryException::test(
+            absl::c_equal( neighbors, expected ),
+            "[Test Batch] Wrong radius neighbors" );
+        for( const auto distance : results.query_distances( q ) )
+        {
+            geode::OpenGeodeGeometryException::test(
+                distance <= radius + geode::GLOBAL_EPSILON,
+                "[Test Batch] Radius neighbor too far" );
+        }
+    }
+}
+
+void batch_test()
+{
+    std::vector< geode::Point3D > points;
+    for( const auto i : geode::Range{ 20 } )
+    {
+        for( const auto j : geode::Range{ 20 } )
+        {
+            points.emplace_back( geode::Point3D{ { 0.1 * i, 0.1 * j,
+                0.01 * static_cast< double >( ( i * j ) % 7 ) } } );
+        }
+    }
+    const geode::NNSearch3D search{ points };
+    std::vector< geode::Point3D > queries;
+    for( const auto q : geode::Range{ 1500 } )
+    {
+        queries.emplace_back( geode::Point3D{ { 0.0013 * q,
+            2 - 0.0011 * q, 0.05 } } );
+    }
+
+    geode::NNSearch3D::NeighborsBatch results;
+    search.neighbors( queries, 3, results );
+    geode::OpenGeodeGeometryException::test(
+        results.nb_queries() == queries.size(),
+        "[Test Batch] Wrong number of k-NN queries" );
+    for( const auto q : geode::Indices{ queries } )
+    {
+        const auto neighbors = results.query_neighbors( q );
+        const auto distances = results.query_distances( q );
+        const auto closest = search.closest_neighbor( queries[q] );
+        geode::OpenGeodeGeometryException::test(
+            neighbors.size() == 3
+                && std::fabs( distances.front()
+                              - geode::point_point_distance(
+                                  queries[q], points[closest] ) )
+                       < geode::GLOBAL_EPSILON,
+            "[Test Batch] Wrong k-NN neighbors" );
+        for( const auto n : geode::Indices{ neighbors } )
+        {
+            geode::OpenGeodeGeometryException::test(
+                std::fabs( distances[n]
+                           - geode::point_point_distance(
+                               queries[q], points[neighbors[n]] ) )
+                    < geode::GLOBAL_EPSILON,
+                "[Test Batch] Wrong k-NN distance" );
+        }
+    }
+
+    check_radius_batch( search, queries, 0.15, results );
+    // Reuse the same batch with fewer queries and a larger radius
+    check_radius_batch( search,
+        absl::MakeConstSpan( queries ).subspan( 0, queries.size() / 3 ), 0.3,
+        results );
+}
+
 void test()
 {
     first_test();
     second_test();
+    chain_test();
+    batch_test();
 }
 
 OPENGEODE_TEST( "nnsearch" )
\ No newline at end of file
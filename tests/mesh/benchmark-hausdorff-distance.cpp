@@ -0,0 +1,107 @@
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+#include <geode/mesh/helpers/hausdorff_distance.hpp>
+#include <geode/mesh/io/triangulated_surface_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+/*
+ * Measures Hausdorff distance computation time between the Armadillo and a
+ * perturbed copy of it.
+ * The number of worker threads is controlled by the LIBASYNC_NUM_THREADS
+ * environment variable (defaults to the number of hardware threads).
+ * Finer samplings are only run when compiled with USE_BENCHMARK.
+ */
+
+double exhaustive_one_sided_distance(
+    const geode::TriangulatedSurface3D& mesh_A,
+    const geode::TriangulatedSurface3D& mesh_B )
+{
+    const auto tree = geode::create_aabb_tree( mesh_B );
+    const geode::DistanceToTriangle3D distance_action{ mesh_B };
+    std::vector< geode::Point3D > queries;
+    queries.reserve( mesh_A.nb_vertices() );
+    for( const auto v : geode::Range{ mesh_A.nb_vertices() } )
+    {
+        queries.push_back( mesh_A.point( v ) );
+    }
+    double max_distance{ 0 };
+    for( const auto& closest :
+        tree.closest_element_boxes( queries, distance_action ) )
+    {
+        max_distance = std::max( max_distance, std::get< 1 >( closest ) );
+    }
+    return max_distance;
+}
+
+void benchmark_sampling( const geode::TriangulatedSurface3D& mesh_A,
+    const geode::TriangulatedSurface3D& mesh_B,
+    double sampling_distance )
+{
+    const geode::Timer timer;
+    const auto distances =
+        geode::hausdorff_distances( mesh_A, mesh_B, sampling_distance );
+    geode::Logger::info( "Sampling distance ", sampling_distance,
+        ": A to B = ", distances.A_to_B, ", B to A = ", distances.B_to_A,
+        " computed in ", timer.duration() );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    const auto* nb_threads = std::getenv( "LIBASYNC_NUM_THREADS" );
+    geode::Logger::info( "Number of threads: ",
+        nb_threads ? nb_threads
+                   : std::to_string( std::thread::hardware_concurrency() ) );
+    const auto filename =
+        absl::StrCat( geode::DATA_PATH, "modified_Armadillo.og_tsf3d" );
+    const auto mesh_A = geode::load_triangulated_surface< 3 >( filename );
+    auto mesh_B = geode::load_triangulated_surface< 3 >( filename );
+    const auto diagonal = mesh_A->bounding_box().diagonal().length();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *mesh_B );
+    for( const auto v : geode::Range{ mesh_B->nb_vertices() } )
+    {
+        auto point = mesh_B->point( v );
+        point.set_value(
+            2, point.value( 2 ) + 0.01 * diagonal * std::sin( v * 0.1 ) );
+        builder->set_point( v, std::move( point ) );
+    }
+
+    const geode::Timer exhaustive_timer;
+    const auto exhaustive =
+        std::max( exhaustive_one_sided_distance( *mesh_A, *mesh_B ),
+            exhaustive_one_sided_distance( *mesh_B, *mesh_A ) );
+    geode::Logger::info( "Exhaustive vertex distance: ", exhaustive,
+        " computed in ", exhaustive_timer.duration() );
+    const geode::Timer timer;
+    const auto distance = geode::hausdorff_distance( *mesh_A, *mesh_B );
+    geode::Logger::info( "Pruned vertex distance: ", distance, " computed in ",
+        timer.duration() );
+    geode::OpenGeodeMeshException::test(
+        std::fabs( distance - exhaustive ) < geode::GLOBAL_EPSILON,
+        "[Benchmark] Wrong Hausdorff distance" );
+
+    std::vector< double > sampling_ratios{ 0.01 };
+#ifdef OPENGEODE_BENCHMARK
+    sampling_ratios.push_back( 0.002 );
+    sampling_ratios.push_back( 0.0005 );
+#endif
+    for( const auto ratio : sampling_ratios )
+    {
+        benchmark_sampling( *mesh_A, *mesh_B, ratio * diagonal );
+    }
+}
+
+OPENGEODE_TEST( "benchmark-hausdorff-distance" )
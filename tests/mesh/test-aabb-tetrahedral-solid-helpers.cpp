@@ -24,6 +24,7 @@
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
@@ -57,7 +58,8 @@ void build_test_solid( geode::TetrahedralSolid3D& solid )
     builder->compute_polyhedron_adjacencies();
 }
 
-void check_solid_tree( const geode::AABBTree3D& tree,
+template < typename Tree >
+void check_solid_tree( const Tree& tree,
     const geode::DistanceToTetrahedron3D& distance_action )
 {
     geode::index_t tetrahedron_box_id;
@@ -100,6 +102,9 @@ void test_SolidAABB()
     geode::DistanceToTetrahedron3D distance_action( *t_solid );
 
     check_solid_tree( aabb_tree, distance_action );
+
+    const auto wide_tree = create_aabb_tree_wide( *t_solid );
+    check_solid_tree( wide_tree, distance_action );
 }
 
 void test()
@@ -34,6 +34,7 @@
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 #include <geode/geometry/distance.hpp>
 #include <geode/geometry/point.hpp>
 
@@ -80,8 +81,8 @@ void add_triangles( geode::TriangulatedSurfaceBuilder< dimension >& builder,
     }
 }
 
-template < geode::index_t dimension >
-void check_surface_tree( const geode::AABBTree< dimension >& tree,
+template < geode::index_t dimension, typename Tree >
+void check_surface_tree( const Tree& tree,
     const geode::DistanceToTriangle< dimension >& distance_action,
     geode::index_t size )
 {
@@ -135,6 +136,9 @@ void test_SurfaceAABB()
     geode::DistanceToTriangle< dimension > distance_action( *t_surf );
 
     check_surface_tree< dimension >( aabb_tree, distance_action, size );
+
+    const auto wide_tree = create_aabb_tree_wide( *t_surf );
+    check_surface_tree< dimension >( wide_tree, distance_action, size );
 }
 
 void test()
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <vector>
+
+#include <geode/basic/logger.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/elements_around_vertices.hpp>
+
+#include <geode/tests/common.hpp>
+
+void test_polygons_around_vertices()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0.5, 0.5, 0.5 } } );
+    builder->create_triangle( { 0, 1, 4 } );
+    builder->create_triangle( { 1, 2, 4 } );
+    builder->create_triangle( { 2, 3, 4 } );
+    builder->create_triangle( { 3, 0, 4 } );
+    builder->compute_polygon_adjacencies();
+
+    const geode::PolygonsAroundVertices3D index{ *surface };
+    geode::OpenGeodeMeshException::test(
+        index.nb_vertices() == surface->nb_vertices(),
+        "[Test] Wrong number of vertices in PolygonsAroundVertices" );
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            index.polygons_around_vertex( v ).size()
+                == surface->polygons_around_vertex( v ).size(),
+            "[Test] Wrong number of polygons around vertex ", v );
+        for( const auto& polygon_vertex : index.polygons_around_vertex( v ) )
+        {
+            geode::OpenGeodeMeshException::test(
+                surface->polygon_vertex( polygon_vertex ) == v,
+                "[Test] Wrong polygon vertex around vertex ", v );
+        }
+    }
+    const auto apex = index.polygons_around_vertex( 4 );
+    for( const auto p : geode::LRange{ 4 } )
+    {
+        geode::OpenGeodeMeshException::test(
+            apex[p] == geode::PolygonVertex{ p, 2 },
+            "[Test] Polygons around vertex should be sorted" );
+    }
+    const auto corner = index.polygons_around_vertex( 0 );
+    geode::OpenGeodeMeshException::test(
+        corner[0] == geode::PolygonVertex{ 0, 0 }
+            && corner[1] == geode::PolygonVertex{ 3, 1 },
+        "[Test] Wrong polygons around vertex 0" );
+
+    std::vector< geode::PolygonsAroundVertex > cached_polygons;
+    std::vector< bool > cached_borders;
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        const auto polygons = surface->polygons_around_vertex( v );
+        cached_polygons.emplace_back( polygons.begin(), polygons.end() );
+        cached_borders.push_back( surface->is_vertex_on_border( v ) );
+    }
+    surface->build_polygons_around_vertices();
+    geode::OpenGeodeMeshException::test(
+        !surface->vertex_attribute_manager().attribute_ids_matching_name(
+            "polygons_around_vertex" ),
+        "[Test] Polygons around vertex cache should be dropped" );
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            surface->polygons_around_vertex( v ) == cached_polygons[v],
+            "[Test] Wrong built polygons around vertex ", v );
+        geode::OpenGeodeMeshException::test(
+            surface->is_vertex_on_border( v ) == cached_borders[v],
+            "[Test] Wrong built border flag of vertex ", v );
+    }
+    geode::OpenGeodeMeshException::test(
+        !surface->vertex_attribute_manager().attribute_ids_matching_name(
+            "polygons_around_vertex" ),
+        "[Test] Built polygons around vertex should not use the cache" );
+    builder->create_point( geode::Point3D{ { 0.5, -1, 0 } } );
+    builder->create_triangle( { 1, 0, 5 } );
+    builder->set_polygon_adjacent( { 0, 0 }, 4 );
+    builder->set_polygon_adjacent( { 4, 0 }, 0 );
+    geode::OpenGeodeMeshException::test(
+        surface->polygons_around_vertex( 5 ).size() == 1
+            && surface->polygons_around_vertex( 0 ).size() == 3,
+        "[Test] Wrong polygons around vertex after modification" );
+}
+
+void test_polyhedra_around_vertices()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 0, 1 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 1 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 1 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 1 } } );
+    builder->create_tetrahedron( { 0, 4, 1, 3 } );
+    builder->create_tetrahedron( { 1, 2, 3, 6 } );
+    builder->create_tetrahedron( { 1, 4, 5, 6 } );
+    builder->create_tetrahedron( { 3, 7, 4, 6 } );
+    builder->create_tetrahedron( { 1, 4, 6, 3 } );
+    builder->compute_polyhedron_adjacencies();
+
+    const geode::PolyhedraAroundVertices3D index{ *solid };
+    geode::OpenGeodeMeshException::test(
+        index.nb_vertices() == solid->nb_vertices(),
+        "[Test] Wrong number of vertices in PolyhedraAroundVertices" );
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            index.polyhedra_around_vertex( v ).size()
+                == solid->polyhedra_around_vertex( v ).size(),
+            "[Test] Wrong number of polyhedra around vertex ", v );
+        for( const auto& polyhedron_vertex :
+            index.polyhedra_around_vertex( v ) )
+        {
+            geode::OpenGeodeMeshException::test(
+                solid->polyhedron_vertex( polyhedron_vertex ) == v,
+                "[Test] Wrong polyhedron vertex around vertex ", v );
+        }
+    }
+    const auto around = index.polyhedra_around_vertex( 6 );
+    geode::OpenGeodeMeshException::test(
+        around.size() == 4 && around[0] == geode::PolyhedronVertex{ 1, 3 }
+            && around[1] == geode::PolyhedronVertex{ 2, 3 }
+            && around[2] == geode::PolyhedronVertex{ 3, 3 }
+            && around[3] == geode::PolyhedronVertex{ 4, 2 },
+        "[Test] Wrong polyhedra around vertex 6" );
+
+    std::vector< geode::PolyhedraAroundVertex > cached_polyhedra;
+    std::vector< bool > cached_borders;
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        const auto polyhedra = solid->polyhedra_around_vertex( v );
+        cached_polyhedra.emplace_back( polyhedra.begin(), polyhedra.end() );
+        cached_borders.push_back( solid->is_vertex_on_border( v ) );
+    }
+    solid->build_polyhedra_around_vertices();
+    geode::OpenGeodeMeshException::test(
+        !solid->vertex_attribute_manager().attribute_ids_matching_name(
+            "polyhedra_around_vertex" ),
+        "[Test] Polyhedra around vertex cache should be dropped" );
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            solid->polyhedra_around_vertex( v ) == cached_polyhedra[v],
+            "[Test] Wrong built polyhedra around vertex ", v );
+        geode::OpenGeodeMeshException::test(
+            solid->is_vertex_on_border( v ) == cached_borders[v],
+            "[Test] Wrong built border flag of vertex ", v );
+    }
+    geode::OpenGeodeMeshException::test(
+        !solid->vertex_attribute_manager().attribute_ids_matching_name(
+            "polyhedra_around_vertex" ),
+        "[Test] Built polyhedra around vertex should not use the cache" );
+    builder->create_point( geode::Point3D{ { 0.5, 0.5, -1 } } );
+    builder->create_tetrahedron( { 0, 1, 3, 8 } );
+    builder->set_polyhedron_adjacent( { 0, 1 }, 5 );
+    builder->set_polyhedron_adjacent( { 5, 3 }, 0 );
+    geode::OpenGeodeMeshException::test(
+        solid->polyhedra_around_vertex( 8 ).size() == 1
+            && solid->polyhedra_around_vertex( 0 ).size() == 2,
+        "[Test] Wrong polyhedra around vertex after modification" );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_polygons_around_vertices();
+    test_polyhedra_around_vertices();
+}
+
+OPENGEODE_TEST( "elements-around-vertices" )
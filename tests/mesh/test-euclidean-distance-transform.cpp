@@ -140,11 +140,45 @@ void test_distance_transform_3D( double cell_length )
             "Wrong 3D euclidean distance map" );
     }
 }
+void test_narrow_band_distance_transform_3D()
+{
+    const auto grid = geode::RegularGrid3D::create();
+    const auto builder = geode::RegularGridBuilder3D::create( *grid );
+    builder->initialize_grid(
+        geode::Point3D{ { 0., 0., 0. } }, { 40, 30, 20 }, { 1., 2., 0.5 } );
+    const std::array< const geode::Grid3D::CellIndices, 3 > objects_raster{
+        { { 5, 5, 5 }, { 20, 15, 10 }, { 21, 15, 10 } }
+    };
+    const auto distance_map = geode::euclidean_distance_transform< 3 >(
+        *grid, objects_raster, "full_edt" );
+    const double max_distance{ 6. };
+    const auto band_map = geode::euclidean_distance_transform< float, 3 >(
+        *grid, objects_raster, "band_edt", max_distance );
+    for( const auto c : geode::Range{ grid->nb_cells() } )
+    {
+        const auto distance = distance_map->value( c );
+        const auto band_distance = band_map->value( c );
+        if( distance <= max_distance )
+        {
+            geode::OpenGeodeMeshException::test(
+                std::fabs( band_distance - distance ) < 1e-5,
+                "Wrong narrow band euclidean distance map" );
+        }
+        else
+        {
+            geode::OpenGeodeMeshException::test(
+                band_distance == std::numeric_limits< float >::max(),
+                "Wrong value outside narrow band" );
+        }
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
     test_distance_transform_2D( 0.5 );
     test_distance_transform_3D( 4.8 );
+    test_narrow_band_distance_transform_3D();
 }
 
 OPENGEODE_TEST( "euclidean distance transform" )
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <geode/geometry/aabb.hpp>
 #include <geode/geometry/point.hpp>
 
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 #include <geode/mesh/helpers/hausdorff_distance.hpp>
@@ -11,10 +12,70 @@
 
 #include <geode/tests/common.hpp>
 
-void test()
+std::unique_ptr< geode::TriangulatedSurface3D > create_square()
+{
+    auto mesh = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *mesh );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 0, 2, 3 } );
+    return mesh;
+}
+
+std::unique_ptr< geode::TriangulatedSurface3D > create_tent()
+{
+    auto mesh = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *mesh );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0.5, 0.5, 0.5 } } );
+    builder->create_triangle( { 0, 1, 4 } );
+    builder->create_triangle( { 1, 2, 4 } );
+    builder->create_triangle( { 2, 3, 4 } );
+    builder->create_triangle( { 3, 0, 4 } );
+    return mesh;
+}
+
+void test_one_sided()
+{
+    const auto square = create_square();
+    const auto tent = create_tent();
+
+    const auto vertices_only = geode::hausdorff_distances( *square, *tent, 0 );
+    geode::OpenGeodeMeshException::test(
+        std::fabs( vertices_only.A_to_B ) < geode::GLOBAL_EPSILON,
+        "[Test] Wrong square to tent distance without sampling" );
+    geode::OpenGeodeMeshException::test(
+        std::fabs( vertices_only.B_to_A - 0.5 ) < geode::GLOBAL_EPSILON,
+        "[Test] Wrong tent to square distance without sampling" );
+    geode::OpenGeodeMeshException::test(
+        std::fabs( geode::hausdorff_distance( *square, *tent ) - 0.5 )
+            < geode::GLOBAL_EPSILON,
+        "[Test] Wrong Hausdorff distance without sampling" );
+
+    const auto sampled = geode::hausdorff_distances( *square, *tent, 0.1 );
+    // The farthest point of the square is its center, at a distance of
+    // sqrt( 2 ) / 4 from the tent
+    geode::OpenGeodeMeshException::test(
+        sampled.A_to_B > 0.3 && sampled.A_to_B < 0.3536,
+        "[Test] Wrong square to tent distance with sampling" );
+    geode::OpenGeodeMeshException::test(
+        std::fabs( sampled.B_to_A - 0.5 ) < geode::GLOBAL_EPSILON,
+        "[Test] Wrong tent to square distance with sampling" );
+    geode::OpenGeodeMeshException::test(
+        std::fabs( geode::one_sided_hausdorff_distance( *square, *tent, 0.1 )
+                   - sampled.A_to_B )
+            < geode::GLOBAL_EPSILON,
+        "[Test] Wrong one-sided distance" );
+}
+
+void test_armadillo()
 {
-    geode::OpenGeodeMeshLibrary::initialize();
-    geode::Logger::set_level( geode::Logger::LEVEL::debug );
     const auto initial_mesh_filename =
         absl::StrCat( geode::DATA_PATH, "Armadillo.og_tsf3d" );
     const auto mesh_A =
@@ -29,4 +90,12 @@ void test()
     DEBUG( hausdorff_distance );
 }
 
-OPENGEODE_TEST( "hausdorff-distance" )
\ No newline at end of file
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    geode::Logger::set_level( geode::Logger::LEVEL::debug );
+    test_one_sided();
+    test_armadillo();
+}
+
+OPENGEODE_TEST( "hausdorff-distance" )
@@ -609,7 +609,11 @@ void test_replace_vertex( const geode::PolygonalSurface3D& polygonal_surface,
     geode::PolygonalSurfaceBuilder3D& builder )
 {
     const auto new_id = builder.create_vertex();
-    const auto polygons_around = polygonal_surface.polygons_around_vertex( 1 );
+    const auto polygons_around_view =
+        polygonal_surface.polygons_around_vertex( 1 );
+    const geode::PolygonsAroundVertex polygons_around{
+        polygons_around_view.begin(), polygons_around_view.end()
+    };
     builder.replace_vertex( 1, new_id );
     for( const auto& pv : polygons_around )
     {
@@ -25,6 +25,7 @@
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/aabb_wide.hpp>
 
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
@@ -120,12 +121,85 @@ namespace
             result->distance == 1, "Ray edge wrong distance" );
     }
 
+    void test_ray_packet()
+    {
+        geode::Logger::info( "Test ray packet" );
+        auto mesh = geode::SurfaceMesh3D::create();
+        auto builder = geode::SurfaceMeshBuilder3D::create( *mesh );
+        builder->create_point( geode::Point3D{ { -1, -1, 1 } } );
+        builder->create_point( geode::Point3D{ { 1, -1, 1 } } );
+        builder->create_point( geode::Point3D{ { 0, 1, 1 } } );
+        builder->create_point( geode::Point3D{ { -1, -1, 2 } } );
+        builder->create_point( geode::Point3D{ { 1, -1, 2 } } );
+        builder->create_point( geode::Point3D{ { 0, 1, 2 } } );
+        builder->create_point( geode::Point3D{ { -1, -1, 0 } } );
+        builder->create_point( geode::Point3D{ { -1, 1, 0 } } );
+        builder->create_point( geode::Point3D{ { -2, 0, 0 } } );
+        builder->create_polygon( { 0, 1, 2 } );
+        builder->create_polygon( { 3, 4, 5 } );
+        builder->create_polygon( { 6, 7, 8 } );
+
+        const auto aabb = geode::create_aabb_tree( *mesh );
+        const geode::Point3D origin{ { 0, 0, 0 } };
+        const std::array< geode::Vector3D, 5 > directions{
+            geode::Vector3D{ { 0, 0, 1 } }, geode::Vector3D{ { 0, 0, -1 } },
+            geode::Vector3D{ { 0.1, 0.1, 1 } },
+            geode::Vector3D{ { -1, 0, 0 } }, geode::Vector3D{ { 1, 0, 0 } }
+        };
+        std::vector< geode::Ray3D > rays;
+        for( const auto& direction : directions )
+        {
+            rays.emplace_back( direction, origin );
+        }
+        const auto packet =
+            geode::RayTracing3D::packet_intersections( *mesh, aabb, rays );
+        geode::OpenGeodeMeshException::test(
+            packet.size() == rays.size() && packet[0].size() == 2
+                && packet[1].empty() && packet[2].size() == 2,
+            "Ray packet wrong results" );
+        for( const auto r : geode::Indices{ rays } )
+        {
+            geode::RayTracing3D tracing{ *mesh, aabb.bounding_box(),
+                rays[r] };
+            aabb.compute_ray_element_bbox_intersections( rays[r], tracing );
+            const auto expected = tracing.all_intersections();
+            geode::OpenGeodeMeshException::test(
+                packet[r].size() == expected.size(),
+                "Ray packet wrong number of intersections for ray ", r );
+            for( const auto i : geode::Indices{ expected } )
+            {
+                geode::OpenGeodeMeshException::test(
+                    packet[r][i].polygon == expected[i].polygon
+                        && packet[r][i].distance == expected[i].distance,
+                    "Ray packet wrong intersection for ray ", r );
+            }
+        }
+
+        const auto wide_aabb = geode::create_aabb_tree_wide( *mesh );
+        const auto wide_packet = geode::RayTracing3D::packet_intersections(
+            *mesh, wide_aabb, rays );
+        for( const auto r : geode::Indices{ rays } )
+        {
+            geode::OpenGeodeMeshException::test(
+                wide_packet[r].size() == packet[r].size(),
+                "Wide ray packet wrong number of intersections for ray ", r );
+            for( const auto i : geode::Indices{ packet[r] } )
+            {
+                geode::OpenGeodeMeshException::test(
+                    wide_packet[r][i].polygon == packet[r][i].polygon
+                        && wide_packet[r][i].distance == packet[r][i].distance,
+                    "Wide ray packet wrong intersection for ray ", r );
+            }
+        }
+    }
+
     void test()
     {
         geode::OpenGeodeMeshLibrary::initialize();
         test_ray_inside();
         test_ray_edge();
         test_ray_parallel();
+        test_ray_packet();
     }
 } // namespace
 
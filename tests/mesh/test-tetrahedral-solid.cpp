@@ -22,6 +22,8 @@
  */
 
 #include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/compression.hpp>
+#include <geode/basic/mapped_file.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/variable_attribute.hpp>
 
@@ -36,6 +38,8 @@
 #include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
 #include <geode/mesh/core/solid_edges.hpp>
 #include <geode/mesh/core/solid_facets.hpp>
+#include <geode/mesh/io/geode/geode_tetrahedral_solid_input.hpp>
+#include <geode/mesh/io/geode/geode_tetrahedral_solid_output.hpp>
 #include <geode/mesh/io/tetrahedral_solid_input.hpp>
 #include <geode/mesh/io/tetrahedral_solid_output.hpp>
 
@@ -323,9 +327,80 @@ void test_io(
         "Reloaded TetrahedralSolid should have 3 polyhedra" );
 }
 
-void test_backward_io( const std::string& filename )
+void test_mapped_io(
+    const geode::TetrahedralSolid3D& solid, const std::string& filename )
+{
+    geode::save_tetrahedral_solid( solid, filename );
+    geode::set_native_mapping( true );
+    auto mapped_solid = geode::load_tetrahedral_solid< 3 >( filename );
+    geode::OpenGeodeMeshException::test(
+        mapped_solid->nb_polyhedra() == solid.nb_polyhedra(),
+        "Wrong number of polyhedra in mapped TetrahedralSolid" );
+    for( const auto polyhedron : geode::Range{ solid.nb_polyhedra() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            mapped_solid->polyhedron_vertices( polyhedron )
+                == solid.polyhedron_vertices( polyhedron ),
+            "Wrong mapped TetrahedralSolid polyhedron vertices" );
+    }
+    const geode::Point3D moved{ { 10, 11, 12 } };
+    geode::TetrahedralSolidBuilder3D::create( *mapped_solid )
+        ->set_point( 0, moved );
+    geode::OpenGeodeMeshException::test(
+        mapped_solid->point( 0 ).inexact_equal( moved ),
+        "Modified mapped TetrahedralSolid point is not updated" );
+    const auto reloaded = geode::load_tetrahedral_solid< 3 >( filename );
+    for( const auto vertex_id : geode::Range{ solid.nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            solid.point( vertex_id )
+                .inexact_equal( reloaded->point( vertex_id ) ),
+            "Mapped file should not be modified by the mesh" );
+        if( vertex_id != 0 )
+        {
+            geode::OpenGeodeMeshException::test(
+                solid.point( vertex_id )
+                    .inexact_equal( mapped_solid->point( vertex_id ) ),
+                "Wrong mapped TetrahedralSolid point coordinates" );
+        }
+    }
+    geode::set_native_mapping( false );
+}
+
+void test_buffer_io( const geode::TetrahedralSolid3D& solid )
+{
+    const auto buffer = geode::save_mesh_to_buffer<
+        geode::OpenGeodeTetrahedralSolidOutput3D >( solid );
+    const auto new_solid = geode::load_mesh_from_buffer<
+        geode::OpenGeodeTetrahedralSolidInput3D >( buffer );
+    geode::OpenGeodeMeshException::test(
+        new_solid->nb_vertices() == solid.nb_vertices(),
+        "Wrong number of vertices in TetrahedralSolid loaded from buffer" );
+    geode::OpenGeodeMeshException::test(
+        new_solid->nb_polyhedra() == solid.nb_polyhedra(),
+        "Wrong number of polyhedra in TetrahedralSolid loaded from buffer" );
+    for( const auto vertex_id : geode::Range{ solid.nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            solid.point( vertex_id )
+                .inexact_equal( new_solid->point( vertex_id ) ),
+            "Wrong buffer mesh point coordinates." );
+    }
+}
+
+void test_backward_io( const geode::TetrahedralSolid3D& expected_solid,
+    const std::string& filename )
 {
     const auto solid = geode::load_tetrahedral_solid< 3 >( filename );
+    // Files written before raw attribute serialization store each value
+    // independently
+    for( const auto vertex_id : geode::Range{ expected_solid.nb_vertices() } )
+    {
+        geode::OpenGeodeMeshException::test(
+            solid->point( vertex_id )
+                .inexact_equal( expected_solid.point( vertex_id ) ),
+            "Wrong backward TetrahedralSolid point coordinates" );
+    }
     geode::OpenGeodeMeshException::test( solid->nb_vertices() == 6,
         "Backward TetrahedralSolid should have 6 vertices" );
     geode::OpenGeodeMeshException::test( solid->nb_polyhedra() == 3,
@@ -475,6 +550,77 @@ void test_delete_all( const geode::TetrahedralSolid3D& solid,
         solid.nb_vertices() == 0, "TetrahedralSolid should have 0 vertex" );
 }
 
+void test_sorted_polyhedron_adjacencies()
+{
+    auto solid = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    constexpr geode::index_t nb_cells{ 10 };
+    constexpr geode::index_t nb_points{ nb_cells + 1 };
+    for( const auto k : geode::Range{ nb_points } )
+    {
+        for( const auto j : geode::Range{ nb_points } )
+        {
+            for( const auto i : geode::Range{ nb_points } )
+            {
+                builder->create_point(
+                    geode::Point3D{ { static_cast< double >( i ),
+                        static_cast< double >( j ),
+                        static_cast< double >( k ) } } );
+            }
+        }
+    }
+    const std::array< geode::index_t, 3 > steps{ 1, nb_points,
+        nb_points * nb_points };
+    const std::array< std::array< geode::index_t, 3 >, 6 > axes{
+        { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 },
+            { 2, 1, 0 } }
+    };
+    for( const auto k : geode::Range{ nb_cells } )
+    {
+        for( const auto j : geode::Range{ nb_cells } )
+        {
+            for( const auto i : geode::Range{ nb_cells } )
+            {
+                const auto v0 = i + j * steps[1] + k * steps[2];
+                const auto v3 = v0 + steps[0] + steps[1] + steps[2];
+                for( const auto& axis : axes )
+                {
+                    const auto v1 = v0 + steps[axis[0]];
+                    const auto v2 = v1 + steps[axis[1]];
+                    builder->create_tetrahedron( { v0, v1, v2, v3 } );
+                }
+            }
+        }
+    }
+    builder->compute_polyhedron_adjacencies();
+
+    geode::index_t nb_border_facets{ 0 };
+    for( const auto p : geode::Range{ solid->nb_polyhedra() } )
+    {
+        for( const auto f : geode::LRange{ 4 } )
+        {
+            const auto adjacent = solid->polyhedron_adjacent( { p, f } );
+            if( !adjacent )
+            {
+                nb_border_facets++;
+                continue;
+            }
+            bool found{ false };
+            for( const auto f2 : geode::LRange{ 4 } )
+            {
+                found |= solid->polyhedron_adjacent( { adjacent.value(), f2 } )
+                         == p;
+            }
+            geode::OpenGeodeMeshException::test( found,
+                "[Test] Sorted polyhedron adjacencies are not symmetric" );
+        }
+    }
+    geode::OpenGeodeMeshException::test(
+        nb_border_facets == 12 * nb_cells * nb_cells,
+        "[Test] Wrong number of border facets after sorted adjacencies" );
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -489,12 +635,21 @@ void test()
     test_polyhedron_adjacencies( *solid, *builder );
     test_is_on_border( *solid );
     test_io( *solid, absl::StrCat( "test.", solid->native_extension() ) );
-    test_backward_io( absl::StrCat(
-        geode::DATA_PATH, "backward_io/v17/v17.", solid->native_extension() ) );
+    geode::set_native_compression( true );
+    test_io( *solid,
+        absl::StrCat( "test_compressed.", solid->native_extension() ) );
+    geode::set_native_compression( false );
+    test_mapped_io(
+        *solid, absl::StrCat( "test_mapped.", solid->native_extension() ) );
+    test_buffer_io( *solid );
+    test_backward_io(
+        *solid, absl::StrCat( geode::DATA_PATH, "backward_io/v17/v17.",
+                    solid->native_extension() ) );
     test_permutation( *solid, *builder );
     test_delete_polyhedron( *solid, *builder );
     test_clone( *solid );
     test_delete_all( *solid, *builder );
+    test_sorted_polyhedron_adjacencies();
 }
 
 OPENGEODE_TEST( "tetrahedral-solid" )
\ No newline at end of file
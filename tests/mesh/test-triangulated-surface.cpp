@@ -372,6 +372,118 @@ void test_delete_all( const geode::TriangulatedSurface3D& triangulated_surface,
         "[Test]TriangulatedSurface should have 0 vertex" );
 }
 
+void create_grid_triangles(
+    geode::TriangulatedSurfaceBuilder3D& builder, geode::index_t nb_cells )
+{
+    const auto nb_points = nb_cells + 1;
+    for( const auto j : geode::Range{ nb_points } )
+    {
+        for( const auto i : geode::Range{ nb_points } )
+        {
+            builder.create_point( geode::Point3D{
+                { static_cast< double >( i ), static_cast< double >( j ),
+                    0 } } );
+        }
+    }
+    for( const auto j : geode::Range{ nb_cells } )
+    {
+        for( const auto i : geode::Range{ nb_cells } )
+        {
+            const auto v0 = i + j * nb_points;
+            builder.create_triangle( { v0, v0 + 1, v0 + nb_points + 1 } );
+            builder.create_triangle(
+                { v0, v0 + nb_points + 1, v0 + nb_points } );
+        }
+    }
+}
+
+geode::index_t check_symmetric_adjacencies(
+    const geode::TriangulatedSurface3D& surface )
+{
+    geode::index_t nb_border_edges{ 0 };
+    for( const auto p : geode::Range{ surface.nb_polygons() } )
+    {
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            const auto adjacent = surface.polygon_adjacent( { p, e } );
+            if( !adjacent )
+            {
+                nb_border_edges++;
+                continue;
+            }
+            bool found{ false };
+            for( const auto e2 : geode::LRange{ 3 } )
+            {
+                found |= surface.polygon_adjacent( { adjacent.value(), e2 } )
+                         == p;
+            }
+            geode::OpenGeodeMeshException::test(
+                found, "[Test] Sorted polygon adjacencies are not symmetric" );
+        }
+    }
+    return nb_border_edges;
+}
+
+void test_sorted_polygon_adjacencies( geode::index_t nb_cells )
+{
+    auto surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    create_grid_triangles( *builder, nb_cells );
+    builder->compute_polygon_adjacencies();
+    geode::OpenGeodeMeshException::test(
+        check_symmetric_adjacencies( *surface ) == 4 * nb_cells,
+        "[Test] Wrong number of border edges after sorted adjacencies" );
+}
+
+void test_sorted_polygon_adjacencies_with_existing()
+{
+    auto surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    constexpr geode::index_t nb_cells{ 50 };
+    constexpr geode::index_t nb_points{ nb_cells + 1 };
+    create_grid_triangles( *builder, nb_cells );
+    builder->compute_polygon_adjacencies();
+    const auto nb_grid_triangles = surface->nb_polygons();
+
+    // Fins on interior diagonals make non-manifold edges with already
+    // connected triangles, flaps on the bottom border extend the grid
+    constexpr geode::index_t nb_fins{ 10 };
+    for( const auto f : geode::Range{ nb_fins } )
+    {
+        const auto v0 = ( f + 1 ) * ( nb_points + 1 );
+        const auto apex = builder->create_point( geode::Point3D{
+            { static_cast< double >( f + 1 ), static_cast< double >( f + 1 ),
+                1 } } );
+        builder->create_triangle( { v0, v0 + nb_points + 1, apex } );
+        const auto apex2 = builder->create_point( geode::Point3D{
+            { static_cast< double >( f ), -1, 0 } } );
+        builder->create_triangle( { f + 1, f, apex2 } );
+    }
+    builder->compute_polygon_adjacencies();
+
+    for( const auto p :
+        geode::Range{ nb_grid_triangles, surface->nb_polygons() } )
+    {
+        const auto is_fin = ( p - nb_grid_triangles ) % 2 == 0;
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            const auto adjacent = surface->polygon_adjacent( { p, e } );
+            geode::OpenGeodeMeshException::test(
+                is_fin == !adjacent || e != 0,
+                "[Test] Wrong adjacency on non-manifold or flap edge" );
+            geode::OpenGeodeMeshException::test( !adjacent || e == 0,
+                "[Test] Wrong adjacency on new border edge" );
+        }
+    }
+    geode::OpenGeodeMeshException::test(
+        check_symmetric_adjacencies( *surface )
+            == 4 * nb_cells + nb_fins * 3 + nb_fins * 2 - nb_fins,
+        "[Test] Wrong number of border edges after sorted adjacencies with "
+        "existing adjacencies" );
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -388,6 +500,10 @@ void test()
     test_permutation( *surface, *builder );
     test_delete_polygon( *surface, *builder );
     test_clone( *surface );
+    test_sorted_polygon_adjacencies( 50 );
+    // Enough records for the parallel sort to merge several chunks
+    test_sorted_polygon_adjacencies( 100 );
+    test_sorted_polygon_adjacencies_with_existing();
 }
 
 OPENGEODE_TEST( "triangulated-surface" )
\ No newline at end of file
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstdlib>
+#include <thread>
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+
+#include <geode/model/helpers/compute_unique_vertices.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/io/brep_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+/*
+ * Measures compute_model_unique_vertices on a structural model whose
+ * unique vertices have been removed.
+ * The number of worker threads is controlled by the LIBASYNC_NUM_THREADS
+ * environment variable (defaults to the number of hardware threads).
+ */
+
+void remove_unique_vertices(
+    const geode::BRep& brep, geode::BRepBuilder& builder )
+{
+    for( const auto uv : geode::Range{ brep.nb_unique_vertices() } )
+    {
+        const auto span = brep.component_mesh_vertices( uv );
+        const std::vector< geode::ComponentMeshVertex > cmvs{ span.begin(),
+            span.end() };
+        for( const auto& cmv : cmvs )
+        {
+            builder.unset_unique_vertex( cmv, uv );
+        }
+    }
+    builder.delete_isolated_vertices();
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    const auto* nb_threads = std::getenv( "LIBASYNC_NUM_THREADS" );
+    geode::Logger::info( "Number of threads: ",
+        nb_threads ? nb_threads
+                   : std::to_string( std::thread::hardware_concurrency() ) );
+    auto brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "structural_model.og_brep" ) );
+    const auto nb_initial_unique_vertices = brep.nb_unique_vertices();
+    geode::BRepBuilder builder{ brep };
+    remove_unique_vertices( brep, builder );
+    geode::OpenGeodeModelException::test( brep.nb_unique_vertices() == 0,
+        "[Benchmark] Unique vertices should have been removed" );
+
+    const geode::Timer timer;
+    geode::compute_model_unique_vertices( brep, builder );
+    geode::Logger::info( "Unique vertices computed in ", timer.duration(),
+        ": ", brep.nb_unique_vertices(), " unique vertices (",
+        nb_initial_unique_vertices, " in file)" );
+    for( const auto& block : brep.blocks() )
+    {
+        for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+        {
+            geode::OpenGeodeModelException::test(
+                brep.unique_vertex( { block.component_id(), v } )
+                    != geode::NO_ID,
+                "[Benchmark] Block vertex without unique vertex" );
+        }
+    }
+}
+
+OPENGEODE_TEST( "benchmark-compute-unique-vertices" )
@@ -24,10 +24,13 @@
 #include <absl/container/flat_hash_map.h>
 
 #include <geode/basic/assert.hpp>
+#include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/detail/count_range_elements.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/range.hpp>
 #include <geode/basic/uuid.hpp>
+#include <geode/basic/variable_attribute.hpp>
+#include <geode/basic/zip_file.hpp>
 
 #include <geode/geometry/point.hpp>
 
@@ -46,6 +49,7 @@
 #include <geode/model/mixin/core/block_collection.hpp>
 #include <geode/model/mixin/core/corner.hpp>
 #include <geode/model/mixin/core/corner_collection.hpp>
+#include <geode/model/mixin/core/detail/components_storage.hpp>
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/mixin/core/line_collection.hpp>
 #include <geode/model/mixin/core/model_boundary.hpp>
@@ -55,6 +59,8 @@
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
 #include <geode/model/representation/io/brep_output.hpp>
+#include <geode/model/representation/io/geode/geode_brep_input.hpp>
+#include <geode/model/representation/io/geode/geode_brep_output.hpp>
 
 #include <geode/tests/common.hpp>
 
@@ -1636,6 +1642,235 @@ void test_components_filter()
         brep.nb_components_with_relations(), " instead of 9" );
 }
 
+void test_buffer_io( const geode::BRep& model )
+{
+    const auto buffer = geode::save_brep_to_buffer( model );
+    geode::OpenGeodeModelException::test(
+        !buffer.empty(), "[Buffer_IO] Buffer should not be empty" );
+    const auto buffer_model = geode::load_brep_from_buffer( buffer );
+    test_compare_brep( model, buffer_model );
+}
+
+void test_lazy_load( const geode::BRep& model, std::string_view file )
+{
+    const auto lazy_model = geode::lazy_load_brep( file );
+    for( const auto& surface : lazy_model.surfaces() )
+    {
+        geode::OpenGeodeModelException::test( !surface.is_mesh_loaded(),
+            "[Lazy_IO] Surface mesh should not be loaded yet" );
+    }
+    geode::OpenGeodeModelException::test(
+        lazy_model.nb_unique_vertices() == model.nb_unique_vertices(),
+        "[Lazy_IO] Wrong number of unique vertices" );
+    test_compare_brep( model, lazy_model );
+    for( const auto& surface : lazy_model.surfaces() )
+    {
+        geode::OpenGeodeModelException::test( surface.is_mesh_loaded(),
+            "[Lazy_IO] Surface mesh should be loaded after access" );
+        for( const auto vertex : geode::Range{ surface.mesh().nb_vertices() } )
+        {
+            geode::OpenGeodeModelException::test(
+                lazy_model.unique_vertex( { surface.component_id(), vertex } )
+                    == model.unique_vertex(
+                        { surface.component_id(), vertex } ),
+                "[Lazy_IO] Wrong unique vertex" );
+        }
+    }
+}
+
+std::string archive_id( std::string_view file )
+{
+    const geode::UnzipFile archive{ file, geode::uuid{}.string(), false };
+    return geode::detail::model_archive_id( archive );
+}
+
+void test_incremental_save( const geode::BRep& model )
+{
+    const auto file =
+        absl::StrCat( "test_incremental.", model.native_extension() );
+    geode::save_brep( model, file );
+    auto edited = geode::load_brep( file );
+    const auto loaded_id = archive_id( file );
+    geode::OpenGeodeModelException::test(
+        !loaded_id.empty(), "[Incremental_IO] Archive should have an id" );
+    for( const auto& surface : edited.surfaces() )
+    {
+        geode::OpenGeodeModelException::test(
+            surface.is_mesh_saved( loaded_id ),
+            "[Incremental_IO] Surface mesh should be saved in the archive "
+            "after loading" );
+    }
+    const auto& surface = *edited.surfaces().begin();
+    const geode::Point3D new_point{ { 12., 13., 14. } };
+    geode::BRepBuilder builder{ edited };
+    builder.surface_mesh_builder( surface )->set_point( 0, new_point );
+    geode::OpenGeodeModelException::test( !surface.is_mesh_saved( loaded_id ),
+        "[Incremental_IO] Surface mesh should be modified" );
+    geode::save_brep_incrementally( edited, file );
+    geode::OpenGeodeModelException::test(
+        surface.is_mesh_saved( archive_id( file ) ),
+        "[Incremental_IO] Surface mesh should be saved after saving" );
+    const auto reloaded = geode::load_brep( file );
+    test_compare_brep( edited, reloaded );
+    geode::OpenGeodeModelException::test(
+        reloaded.surface( surface.id() ).mesh().point( 0 ) == new_point,
+        "[Incremental_IO] Modified surface mesh should be saved" );
+}
+
+void test_incremental_save_after_other_save( const geode::BRep& model )
+{
+    const auto file =
+        absl::StrCat( "test_incremental_other.", model.native_extension() );
+    const auto other_file =
+        absl::StrCat( "test_incremental_copy.", model.native_extension() );
+    geode::save_brep( model, file );
+    auto edited = geode::load_brep( file );
+    const auto& surface = *edited.surfaces().begin();
+    const geode::Point3D new_point{ { 15., 16., 17. } };
+    geode::BRepBuilder builder{ edited };
+    builder.surface_mesh_builder( surface )->set_point( 0, new_point );
+    geode::save_brep( edited, other_file );
+    geode::OpenGeodeModelException::test(
+        !surface.is_mesh_saved( archive_id( file ) ),
+        "[Incremental_IO] Surface mesh should not be saved in the first "
+        "file" );
+    geode::save_brep_incrementally( edited, file );
+    const auto reloaded = geode::load_brep( file );
+    test_compare_brep( edited, reloaded );
+    geode::OpenGeodeModelException::test(
+        reloaded.surface( surface.id() ).mesh().point( 0 ) == new_point,
+        "[Incremental_IO] Surface mesh saved in another file should be "
+        "saved" );
+}
+
+void test_incremental_save_after_buffer_save( const geode::BRep& model )
+{
+    const auto file =
+        absl::StrCat( "test_incremental_buffer.", model.native_extension() );
+    geode::save_brep( model, file );
+    auto edited = geode::load_brep( file );
+    const auto loaded_id = archive_id( file );
+    const auto& surface = *edited.surfaces().begin();
+    const geode::Point3D new_point{ { 18., 19., 20. } };
+    geode::BRepBuilder builder{ edited };
+    builder.surface_mesh_builder( surface )->set_point( 0, new_point );
+    const auto buffer = geode::save_brep_to_buffer( edited );
+    for( const auto& other : edited.surfaces() )
+    {
+        geode::OpenGeodeModelException::test(
+            other.is_mesh_saved( loaded_id ) == ( other.id() != surface.id() ),
+            "[Buffer_IO] Saving in a buffer should not change which meshes "
+            "are saved in the file" );
+    }
+    geode::save_brep_incrementally( edited, file );
+    const auto reloaded = geode::load_brep( file );
+    geode::OpenGeodeModelException::test(
+        reloaded.surface( surface.id() ).mesh().point( 0 ) == new_point,
+        "[Buffer_IO] Surface mesh saved in a buffer should be saved in the "
+        "file" );
+}
+
+void test_incremental_save_attribute( const geode::BRep& model )
+{
+    const auto file = absl::StrCat(
+        "test_incremental_attribute.", model.native_extension() );
+    geode::save_brep( model, file );
+    const auto surface_id = ( *model.surfaces().begin() ).id();
+    geode::uuid attribute_id;
+    {
+        auto edited = geode::load_brep( file );
+        geode::AttributeValues< double > values;
+        values.default_value = 0.;
+        values.no_value = 0.;
+        attribute_id = edited.surface( surface_id )
+                           .mesh()
+                           .vertex_attribute_manager()
+                           .create_attribute< geode::VariableAttribute,
+                               double >( "incremental", values,
+                               geode::AttributeProperties{} );
+        geode::save_brep_incrementally( edited, file );
+    }
+    auto edited = geode::load_brep( file );
+    const auto& mesh = edited.surface( surface_id ).mesh();
+    mesh.vertex_attribute_manager()
+        .find_attribute< geode::VariableAttribute, double >( attribute_id )
+        ->set_value( 0, 42. );
+    geode::OpenGeodeModelException::test(
+        !edited.surface( surface_id ).is_mesh_saved( archive_id( file ) ),
+        "[Incremental_IO] Surface mesh should be modified by an attribute "
+        "edit" );
+    geode::save_brep_incrementally( edited, file );
+    const auto reloaded = geode::load_brep( file );
+    geode::OpenGeodeModelException::test(
+        reloaded.surface( surface_id )
+                .mesh()
+                .vertex_attribute_manager()
+                .find_read_only_attribute< double >( attribute_id )
+                ->value( 0 )
+            == 42.,
+        "[Incremental_IO] Attribute edited on a const mesh should be saved" );
+}
+
+void test_incremental_save_kept_builder( const geode::BRep& model )
+{
+    const auto file =
+        absl::StrCat( "test_incremental_builder.", model.native_extension() );
+    geode::save_brep( model, file );
+    auto edited = geode::load_brep( file );
+    const auto& surface = *edited.surfaces().begin();
+    geode::BRepBuilder builder{ edited };
+    auto mesh_builder = builder.surface_mesh_builder( surface );
+    geode::save_brep_incrementally( edited, file );
+    const geode::Point3D new_point{ { 21., 22., 23. } };
+    mesh_builder->set_point( 0, new_point );
+    geode::OpenGeodeModelException::test(
+        !surface.is_mesh_saved( archive_id( file ) ),
+        "[Incremental_IO] Surface mesh with a builder should be modified" );
+    geode::save_brep_incrementally( edited, file );
+    const auto reloaded = geode::load_brep( file );
+    geode::OpenGeodeModelException::test(
+        reloaded.surface( surface.id() ).mesh().point( 0 ) == new_point,
+        "[Incremental_IO] Surface mesh edited through a kept builder should "
+        "be saved" );
+}
+
+void test_incremental_save_kept_values( const geode::BRep& model )
+{
+    const auto file =
+        absl::StrCat( "test_incremental_values.", model.native_extension() );
+    geode::save_brep( model, file );
+    auto edited = geode::load_brep( file );
+    const auto& surface = *edited.surfaces().begin();
+    geode::AttributeValues< double > values;
+    values.default_value = 0.;
+    values.no_value = 0.;
+    auto& manager = surface.mesh().vertex_attribute_manager();
+    const auto attribute_id =
+        manager.create_attribute< geode::VariableAttribute, double >(
+            "kept", values, geode::AttributeProperties{} );
+    const auto attribute =
+        manager.find_attribute< geode::VariableAttribute, double >(
+            attribute_id );
+    const auto view = attribute->modifiable_values();
+    geode::save_brep_incrementally( edited, file );
+    view[0] = 42.;
+    geode::OpenGeodeModelException::test(
+        !surface.is_mesh_saved( archive_id( file ) ),
+        "[Incremental_IO] Surface mesh with a modifiable view should be "
+        "modified" );
+    geode::save_brep_incrementally( edited, file );
+    const auto reloaded = geode::load_brep( file );
+    geode::OpenGeodeModelException::test(
+        reloaded.surface( surface.id() )
+                .mesh()
+                .vertex_attribute_manager()
+                .find_read_only_attribute< double >( attribute_id )
+                ->value( 0 )
+            == 42.,
+        "[Incremental_IO] Value written through a kept view should be "
+        "saved" );
+}
+
 std::tuple< geode::BRep, geode::ModelCopyMapping > copy_model(
     geode::BRep& brep )
 {
@@ -1737,6 +1972,14 @@ void test()
     }
     test_compare_brep( model, model2 );
     test_registry( model2, 4, 6, 9, 5, 1, 5, 2, 2, 2, 1, 3 );
+    test_lazy_load( model, file_io );
+    test_buffer_io( model );
+    test_incremental_save( model );
+    test_incremental_save_after_other_save( model );
+    test_incremental_save_after_buffer_save( model );
+    test_incremental_save_attribute( model );
+    test_incremental_save_kept_builder( model );
+    test_incremental_save_kept_values( model );
 
     geode::BRep model3{ std::move( model2 ) };
     test_compare_brep( model, model3 );
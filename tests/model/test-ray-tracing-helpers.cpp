@@ -35,6 +35,59 @@
 
 #include <geode/tests/common.hpp>
 
+void test_blocks_containing_points( const geode::BRep& brep )
+{
+    std::vector< geode::Point3D > points;
+    for( const auto i : geode::Range{ 12 } )
+    {
+        for( const auto j : geode::Range{ 12 } )
+        {
+            for( const auto k : geode::Range{ 12 } )
+            {
+                points.emplace_back( geode::Point3D{ { -2.5 + 4. * i,
+                    -1.5 + 4. * j, 0.5 + 4. * k } } );
+            }
+        }
+    }
+    geode::BRepRayTracing brep_ray_tracing{ brep };
+    const auto blocks = brep_ray_tracing.blocks_containing_points( points );
+    geode::BRepRayTracing reference{ brep };
+    for( const auto p : geode::Indices{ points } )
+    {
+        geode::OpenGeodeModelException::test(
+            blocks[p] == reference.block_containing_point( points[p] )
+                && blocks[p]
+                       == brep_ray_tracing.block_containing_point(
+                           points[p] ),
+            "Wrong block found for point [", points[p].string(),
+            "] in blocks_containing_points" );
+    }
+}
+
+void test_surfaces_containing_points( const geode::Section& section )
+{
+    std::vector< geode::Point2D > points;
+    for( const auto i : geode::Range{ 40 } )
+    {
+        for( const auto j : geode::Range{ 40 } )
+        {
+            points.emplace_back(
+                geode::Point2D{ { 200. + 2.1 * i, 200. + 1.9 * j } } );
+        }
+    }
+    geode::SectionRayTracing section_ray_tracing{ section };
+    const auto surfaces =
+        section_ray_tracing.surfaces_containing_points( points );
+    geode::SectionRayTracing reference{ section };
+    for( const auto p : geode::Indices{ points } )
+    {
+        geode::OpenGeodeModelException::test(
+            surfaces[p] == reference.surface_containing_point( points[p] ),
+            "Wrong surface found for point [", points[p].string(),
+            "] in surfaces_containing_points" );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -100,6 +153,9 @@ void test()
         "Point [", inside_2.string(), "] should be inside surface ",
         surface_2.id().string(), " but not inside surface ",
         surface_id->string() );
+
+    test_blocks_containing_points( brep );
+    test_surfaces_containing_points( section );
 }
 
 OPENGEODE_TEST( "ray-tracing-helpers" )
\ No newline at end of file
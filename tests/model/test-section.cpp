@@ -49,6 +49,8 @@
 #include <geode/model/representation/core/section.hpp>
 #include <geode/model/representation/io/section_input.hpp>
 #include <geode/model/representation/io/section_output.hpp>
+#include <geode/model/representation/io/geode/geode_section_input.hpp>
+#include <geode/model/representation/io/geode/geode_section_output.hpp>
 
 #include <geode/tests/common.hpp>
 
@@ -1048,6 +1050,10 @@ void test()
 
     geode::Section model3{ std::move( model2 ) };
     test_compare_section( model, model3 );
+
+    const auto buffer = geode::save_section_to_buffer( model );
+    const auto buffer_model = geode::load_section_from_buffer( buffer );
+    test_compare_section( model, buffer_model );
 }
 
 OPENGEODE_TEST( "section" )
\ No newline at end of file
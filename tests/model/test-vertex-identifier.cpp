@@ -238,6 +238,215 @@ void test_update_unique_vertices()
     }
 }
 
+void test_update_unique_vertices_with_several_components()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+
+    const auto& surface0_id = builder.add_surface();
+    const auto& surface1_id = builder.add_surface();
+    const auto& surface0 = provider.surface( surface0_id );
+    const auto& surface1 = provider.surface( surface1_id );
+    auto surf0_builder = builder.surface_mesh_builder( surface0 );
+    auto surf1_builder = builder.surface_mesh_builder( surface1 );
+    builder.create_unique_vertices( 6 );
+    for( const auto v : geode::Range{ 4 } )
+    {
+        surf0_builder->create_vertex();
+        surf1_builder->create_vertex();
+        builder.set_unique_vertex( { surface0.component_id(), v }, v );
+        builder.set_unique_vertex( { surface1.component_id(), v }, v + 2 );
+    }
+
+    const auto permutation_old2new =
+        surf0_builder->permute_vertices( { 3, 2, 1, 0 } );
+    builder.update_unique_vertices(
+        surface0.component_id(), permutation_old2new );
+    for( const auto v : geode::Range{ 4 } )
+    {
+        geode::OpenGeodeModelException::test(
+            provider.unique_vertex( { surface0.component_id(), 3 - v } ) == v,
+            "VertexIdentifier after permutation is not correct" );
+        geode::OpenGeodeModelException::test(
+            provider.unique_vertex( { surface1.component_id(), v } ) == v + 2,
+            "VertexIdentifier after permutation modified other component" );
+    }
+
+    const auto deletion_old2new = surf0_builder->delete_isolated_vertices();
+    builder.update_unique_vertices( surface0.component_id(), deletion_old2new );
+    for( const auto uv : geode::Range{ 6 } )
+    {
+        geode::OpenGeodeModelException::test(
+            !provider.has_component_mesh_vertices( uv, surface0_id ),
+            "VertexIdentifier after deletion is not correct" );
+    }
+    geode::OpenGeodeModelException::test(
+        provider.is_unique_vertex_isolated( 0 )
+            && provider.is_unique_vertex_isolated( 1 )
+            && provider.component_mesh_vertices( 2 ).size() == 1,
+        "VertexIdentifier after deletion is not correct (sizes)" );
+
+    builder.unregister_mesh_component( surface1 );
+    for( const auto uv : geode::Range{ 6 } )
+    {
+        geode::OpenGeodeModelException::test(
+            provider.is_unique_vertex_isolated( uv ),
+            "VertexIdentifier after unregistration is not correct" );
+    }
+}
+
+void test_many_component_vertices()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+
+    const auto& surface_id = builder.add_surface();
+    const auto& surface = provider.surface( surface_id );
+    auto surf_builder = builder.surface_mesh_builder( surface );
+    builder.create_unique_vertices( 3 );
+    for( const auto v : geode::Range{ 100 } )
+    {
+        surf_builder->create_vertex();
+        builder.set_unique_vertex( { surface.component_id(), v }, 1 );
+    }
+    for( const auto v : geode::Range{ 100 } )
+    {
+        if( v % 2 == 1 )
+        {
+            builder.set_unique_vertex( { surface.component_id(), v }, 2 );
+        }
+    }
+    geode::OpenGeodeModelException::test(
+        provider.component_mesh_vertices( 1 ).size() == 50
+            && provider.component_mesh_vertices( 2 ).size() == 50,
+        "Wrong number of component vertices after reassignment" );
+    const auto old2new = builder.delete_isolated_vertices();
+    geode::OpenGeodeModelException::test(
+        old2new[0] == geode::NO_ID && old2new[2] == 1,
+        "Wrong mapping after delete_isolated_vertices" );
+    for( const auto v : geode::Range{ 100 } )
+    {
+        const auto unique_vertex =
+            provider.unique_vertex( { surface.component_id(), v } );
+        geode::OpenGeodeModelException::test( unique_vertex == v % 2,
+            "Wrong unique vertex after delete_isolated_vertices" );
+        const auto vertices = provider.component_mesh_vertices( unique_vertex );
+        geode::OpenGeodeModelException::test(
+            vertices[v / 2].vertex == v,
+            "Wrong component vertex after delete_isolated_vertices" );
+    }
+}
+
+void test_set_unique_vertices_batch()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+
+    const auto& surface_id = builder.add_surface();
+    const auto& surface = provider.surface( surface_id );
+    auto surf_builder = builder.surface_mesh_builder( surface );
+    constexpr geode::index_t nb_vertices{ 10000 };
+    builder.create_unique_vertices( 4 );
+    surf_builder->create_vertices( nb_vertices );
+    builder.set_unique_vertex( { surface.component_id(), 0 }, 3 );
+    std::vector< geode::ComponentMeshVertex > component_vertices;
+    std::vector< geode::index_t > unique_vertices;
+    for( const auto v : geode::Range{ nb_vertices } )
+    {
+        component_vertices.emplace_back( surface.component_id(), v );
+        unique_vertices.push_back( v % 3 );
+    }
+    // Vertex 1 is set twice, the last value wins
+    component_vertices.emplace_back( surface.component_id(), 1 );
+    unique_vertices.push_back( 2 );
+    builder.set_unique_vertices( component_vertices, unique_vertices );
+
+    geode::OpenGeodeModelException::test(
+        provider.component_mesh_vertices( 3 ).empty(),
+        "Previous unique vertex should be isolated after batch" );
+    geode::OpenGeodeModelException::test(
+        provider.unique_vertex( { surface.component_id(), 1 } ) == 2,
+        "Wrong unique vertex for vertex set twice in batch" );
+    for( const auto uv : geode::Range{ 3 } )
+    {
+        const auto vertices = provider.component_mesh_vertices( uv );
+        for( const auto i : geode::Range{ 1, vertices.size() } )
+        {
+            geode::OpenGeodeModelException::test(
+                vertices[i - 1].vertex < vertices[i].vertex
+                    || vertices[i].vertex == 1,
+                "Batch component vertices should keep the input order" );
+        }
+        for( const auto& vertex : vertices )
+        {
+            geode::OpenGeodeModelException::test(
+                provider.unique_vertex( vertex ) == uv,
+                "Wrong component vertex after batch" );
+        }
+    }
+    geode::OpenGeodeModelException::test(
+        provider.component_mesh_vertices( 0 ).size()
+                + provider.component_mesh_vertices( 1 ).size()
+                + provider.component_mesh_vertices( 2 ).size()
+            == nb_vertices,
+        "Wrong number of component vertices after batch" );
+}
+
+void test_set_unique_vertices_batch_after_deletion()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+
+    const auto& surface_id = builder.add_surface();
+    const auto& surface = provider.surface( surface_id );
+    auto surf_builder = builder.surface_mesh_builder( surface );
+    constexpr geode::index_t nb_unique_vertices{ 1000 };
+    constexpr geode::index_t nb_isolated{ 499 };
+    builder.create_unique_vertices( nb_unique_vertices );
+    surf_builder->create_vertices( 3 * nb_unique_vertices );
+    std::vector< geode::ComponentMeshVertex > component_vertices;
+    std::vector< geode::index_t > unique_vertices;
+    for( const auto uv : geode::Range{ nb_unique_vertices } )
+    {
+        component_vertices.emplace_back( surface.component_id(), uv );
+        unique_vertices.push_back( uv );
+    }
+    builder.set_unique_vertices( component_vertices, unique_vertices );
+    for( const auto uv : geode::Range{ nb_isolated } )
+    {
+        builder.unset_unique_vertex( { surface.component_id(), uv }, uv );
+    }
+    // Almost half of the buffer is now unused: growing the remaining unique
+    // vertices in a single batch exceeds the compaction threshold
+    builder.delete_isolated_vertices();
+    const auto nb_kept = nb_unique_vertices - nb_isolated;
+    component_vertices.clear();
+    unique_vertices.clear();
+    for( const auto uv : geode::Range{ nb_kept } )
+    {
+        for( const auto i : geode::LRange{ 1, 3 } )
+        {
+            component_vertices.emplace_back( surface.component_id(),
+                i * nb_unique_vertices + nb_isolated + uv );
+            unique_vertices.push_back( uv );
+        }
+    }
+    builder.set_unique_vertices( component_vertices, unique_vertices );
+    for( const auto uv : geode::Range{ nb_kept } )
+    {
+        const auto vertices = provider.component_mesh_vertices( uv );
+        geode::OpenGeodeModelException::test( vertices.size() == 3,
+            "Wrong number of component vertices after compacting batch" );
+        for( const auto i : geode::LRange{ 3 } )
+        {
+            geode::OpenGeodeModelException::test(
+                vertices[i].vertex
+                    == i * nb_unique_vertices + nb_isolated + uv,
+                "Wrong component vertex after compacting batch" );
+        }
+    }
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -274,6 +483,10 @@ void test()
     test_save_and_load_unique_vertices( vertex_identifier );
 
     test_update_unique_vertices();
+    test_update_unique_vertices_with_several_components();
+    test_many_component_vertices();
+    test_set_unique_vertices_batch();
+    test_set_unique_vertices_batch_after_deletion();
 
     builder.unregister_mesh_component( provider.corner( corner2_id ) );
     builder.register_mesh_component( provider.corner( corner2_id ) );